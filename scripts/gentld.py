@@ -13,6 +13,28 @@ for line in content.splitlines():
     tldlist.append(line)
 
 tldcount = len(tldlist)
+tldmaxlength = 0
+
+# must match tldHash() in src/core/io/qtldurl.cpp
+def tldhash(data):
+    result = 2166136261
+    for byte in data:
+        result ^= byte
+        result = (result * 16777619) & 0xffffffff
+    return result
+
+# open addressing with linear probing, kept at most 60% full
+hashsize = 1
+while hashsize * 6 < tldcount * 10:
+    hashsize *= 2
+hashtbl = [-1] * hashsize
+for index, tld in enumerate(tldlist):
+    encoded = tld.encode('utf-8')
+    tldmaxlength = max(tldmaxlength, len(encoded))
+    slot = tldhash(encoded) & (hashsize - 1)
+    while hashtbl[slot] != -1:
+        slot = (slot + 1) & (hashsize - 1)
+    hashtbl[slot] = index
 
 print('''static const char* TLDTbl[%d] = {''' % tldcount)
 
@@ -20,4 +42,14 @@ for tld in tldlist:
     print('    "%s",' % tld)
 
 print('''};
-static const qint16 TLDTblSize = %d;''' % tldcount)
+static const qint16 TLDTblSize = %d;
+static const int TLDMaxLength = %d;
+''' % (tldcount, tldmaxlength))
+
+print('''static const qint16 TLDHashTbl[%d] = {''' % hashsize)
+
+for i in range(0, hashsize, 16):
+    print('    %s,' % ', '.join(str(index) for index in hashtbl[i:i + 16]))
+
+print('''};
+static const int TLDHashTblSize = %d;''' % hashsize)
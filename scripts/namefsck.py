@@ -151,6 +151,7 @@ classlist = [
     "QFontMetricsF",
     "QFormLayout",
     "QFrame",
+    "QFuture",
     "QGenericArgument",
     "QGenericMatrix",
     "QGenericReturnArgument",
@@ -222,6 +223,7 @@ classlist = [
     "QItemSelectionModel",
     "QItemSelectionRange",
     "QJsonDocument",
+    "QJsonStreamReader",
     "QKeyEvent",
     "QKeySequence",
     "QLCDNumber",
@@ -332,6 +334,7 @@ classlist = [
     "QProcessEnvironment",
     "QProgressBar",
     "QProgressDialog",
+    "QPromise",
     "QPropertyAnimation",
     "QProxyModel",
     "QProxyStyle",
@@ -339,6 +342,8 @@ classlist = [
     "QQueue",
     "QRadialGradient",
     "QRadioButton",
+    "QReadLocker",
+    "QReadWriteLock",
     "QRect",
     "QRectF",
     "QRegExp",
@@ -348,6 +353,8 @@ classlist = [
     "QReturnArgument",
     "QRgb",
     "QRubberBand",
+    "QRunnable",
+    "QSaveFile",
     "QScopedPointer",
     "QScopedPointerPodDeleter",
     "QScopedValueRollback",
@@ -488,6 +495,7 @@ classlist = [
     "QTextTableCellFormat",
     "QTextTableFormat",
     "QThread",
+    "QThreadPool",
     "QTileRules",
     "QTime",
     "QTimeEdit",
@@ -544,6 +552,7 @@ classlist = [
     "QWindowsStyle",
     "QWizard",
     "QWizardPage",
+    "QWriteLocker",
     "QX11Info",
     "QXmlAttributes",
     "QXmlContentHandler",
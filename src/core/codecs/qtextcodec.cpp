@@ -38,9 +38,17 @@
 #include <ctype.h>
 #include <locale.h>
 #include <langinfo.h>
+#include <memory>
 #include <unicode/ucsdet.h>
 #include <unicode/uclean.h>
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#  include <arm_neon.h>
+#  define QT_HAVE_NEON64
+#endif
+
 QT_BEGIN_NAMESPACE
 
 // generated via genmib.py
@@ -1073,22 +1081,120 @@ QList<int> QTextCodecPrivate::allMibs()
     return allmibs;
 }
 
-QString QTextCodecPrivate::convertTo(const char *data, int length, const char* const codec)
+// opening a converter is expensive, idle converters are kept per-thread and reused
+class QTextConverterPool
+{
+public:
+    QTextConverterPool() { }
+    ~QTextConverterPool();
+
+    UConverter* acquire(const char *name);
+    void release(const char *name, UConverter *conv);
+
+private:
+    Q_DISABLE_COPY(QTextConverterPool);
+
+    QHash<QByteArray, QStdVector<UConverter*> > idle;
+};
+
+// the pool may be gone while converters owned by objects with static storage are released
+static thread_local bool converterPoolDestroyed = false;
+static thread_local std::unique_ptr<QTextConverterPool> converterPool(nullptr);
+
+// maximum number of idle converters per codec
+static const int QTextConverterPoolLimit = 4;
+
+QTextConverterPool::~QTextConverterPool()
 {
+    QHash<QByteArray, QStdVector<UConverter*> >::const_iterator it = idle.constBegin();
+    while (it != idle.constEnd()) {
+        foreach (UConverter *conv, it.value()) {
+            ucnv_close(conv);
+        }
+        ++it;
+    }
+    converterPoolDestroyed = true;
+}
+
+UConverter* QTextConverterPool::acquire(const char *name)
+{
+    QHash<QByteArray, QStdVector<UConverter*> >::iterator it = idle.find(
+        QByteArray::fromRawData(name, qstrlen(name)));
+    if (it != idle.end() && !it.value().isEmpty()) {
+        UConverter *conv = it.value().last();
+        it.value().pop_back();
+        return conv;
+    }
+
     UErrorCode error = U_ZERO_ERROR;
-    UConverter *conv = ucnv_open(codec, &error);
+    UConverter *conv = ucnv_open(name, &error);
     if (Q_UNLIKELY(U_FAILURE(error))) {
-        return QString();
+        return nullptr;
+    }
+    return conv;
+}
+
+void QTextConverterPool::release(const char *name, UConverter *conv)
+{
+    QHash<QByteArray, QStdVector<UConverter*> >::iterator it = idle.find(
+        QByteArray::fromRawData(name, qstrlen(name)));
+    if (it == idle.end()) {
+        it = idle.insert(QByteArray(name), QStdVector<UConverter*>());
+    }
+    if (it.value().size() >= QTextConverterPoolLimit) {
+        ucnv_close(conv);
+        return;
     }
 
+    // converters may come back with callbacks that refer to their previous owner
+    ucnv_reset(conv);
+    UErrorCode error = U_ZERO_ERROR;
+    ucnv_setToUCallBack(conv, UCNV_TO_U_CALLBACK_SUBSTITUTE, nullptr, nullptr, nullptr, &error);
     error = U_ZERO_ERROR;
+    ucnv_setFromUCallBack(conv, UCNV_FROM_U_CALLBACK_SUBSTITUTE, nullptr, nullptr, nullptr, &error);
+    it.value().append(conv);
+}
+
+static UConverter* qt_acquire_converter(const char *name)
+{
+    if (Q_UNLIKELY(converterPoolDestroyed)) {
+        UErrorCode error = U_ZERO_ERROR;
+        UConverter *conv = ucnv_open(name, &error);
+        return U_SUCCESS(error) ? conv : nullptr;
+    }
+    if (!converterPool) {
+        converterPool = std::make_unique<QTextConverterPool>();
+    }
+    return converterPool->acquire(name);
+}
+
+static void qt_release_converter(const char *name, UConverter *conv)
+{
+    if (Q_UNLIKELY(converterPoolDestroyed)) {
+        ucnv_close(conv);
+        return;
+    }
+    if (!converterPool) {
+        converterPool = std::make_unique<QTextConverterPool>();
+    }
+    converterPool->release(name, conv);
+}
+
+QString QTextCodecPrivate::convertTo(const char *data, int length, const char* const codec)
+{
+    UConverter *conv = qt_acquire_converter(codec);
+    if (Q_UNLIKELY(!conv)) {
+        return QString();
+    }
+
+    UErrorCode error = U_ZERO_ERROR;
     ucnv_setSubstString(conv, questionmarkchar, 1, &error);
 
     const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
     QStdVector<UChar> result(maxbytes);
     error = U_ZERO_ERROR;
     const int convresult = ucnv_toUChars(conv, result.data(), maxbytes, data, length, &error);
-    ucnv_close(conv);
+    qt_release_converter(codec, conv);
 
     if (Q_LIKELY(U_SUCCESS(error))) {
         return QString(reinterpret_cast<const QChar*>(result.constData()), convresult);
@@ -1099,13 +1205,12 @@ QString QTextCodecPrivate::convertTo(const char *data, int length, const char* c
 
 QByteArray QTextCodecPrivate::convertFrom(const QChar *unicode, int length, const char* const codec)
 {
-    UErrorCode error = U_ZERO_ERROR;
-    UConverter *conv = ucnv_open(codec, &error);
-    if (Q_UNLIKELY(U_FAILURE(error))) {
+    UConverter *conv = qt_acquire_converter(codec);
+    if (Q_UNLIKELY(!conv)) {
         return QByteArray();
     }
 
-    error = U_ZERO_ERROR;
+    UErrorCode error = U_ZERO_ERROR;
     ucnv_setSubstString(conv, questionmarkchar, 1, &error);
 
     const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
@@ -1113,7 +1218,7 @@ QByteArray QTextCodecPrivate::convertFrom(const QChar *unicode, int length, cons
     error = U_ZERO_ERROR;
     const int convresult = ucnv_fromUChars(conv, result.data(), maxbytes,
         reinterpret_cast<const UChar *>(unicode), length, &error);
-    ucnv_close(conv);
+    qt_release_converter(codec, conv);
 
     if (Q_LIKELY(U_SUCCESS(error))) {
         return QByteArray(result.constData(), convresult);
@@ -1122,6 +1227,313 @@ QByteArray QTextCodecPrivate::convertFrom(const QChar *unicode, int length, cons
     return QByteArray();
 }
 
+// native conversions for the encodings QString uses the most, they write straight into the
+// result storage and match the substitution ICU does (U+FFFD for each maximal invalid UTF-8
+// subpart, '?' for each code point that can not be encoded)
+static const ushort replacementchar = 0xFFFD;
+
+// unassigned default ignorable code points are skipped instead of substituted, as done by
+// UCNV_FROM_U_CALLBACK_SUBSTITUTE
+static inline bool qt_is_default_ignorable(uint ucs)
+{
+    return (ucs == 0x00AD || ucs == 0x034F || ucs == 0x061C
+        || ucs == 0x115F || ucs == 0x1160
+        || (ucs >= 0x17B4 && ucs <= 0x17B5)
+        || (ucs >= 0x180B && ucs <= 0x180F)
+        || (ucs >= 0x200B && ucs <= 0x200F)
+        || (ucs >= 0x202A && ucs <= 0x202E)
+        || (ucs >= 0x2060 && ucs <= 0x206F)
+        || ucs == 0x3164
+        || (ucs >= 0xFE00 && ucs <= 0xFE0F)
+        || ucs == 0xFEFF || ucs == 0xFFA0
+        || (ucs >= 0xFFF0 && ucs <= 0xFFF8)
+        || (ucs >= 0x1BCA0 && ucs <= 0x1BCA3)
+        || (ucs >= 0x1D173 && ucs <= 0x1D17A)
+        || (ucs >= 0xE0000 && ucs <= 0xE0FFF));
+}
+
+// converts leading ASCII bytes, returns how many were converted
+static inline int qt_from_ascii_block(const uchar *src, int length, ushort *dst)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; (i + 16) <= length; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(chunk)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+#elif defined(QT_HAVE_NEON64)
+    for (; (i + 16) <= length; i += 16) {
+        const uint8x16_t chunk = vld1q_u8(src + i);
+        if (vmaxvq_u8(chunk) >= 0x80) {
+            break;
+        }
+        vst1q_u16(dst + i, vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(dst + i + 8, vmovl_high_u8(chunk));
+    }
+#endif
+    while (i < length && src[i] < 0x80) {
+        dst[i] = src[i];
+        i++;
+    }
+    return i;
+}
+
+// converts leading UTF-16 code units that are not greater than mask, returns how many were
+// converted
+template <ushort mask>
+static inline int qt_to_8bit_block(const ushort *src, int length, uchar *dst)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i highbits = _mm_set1_epi16(short(~mask));
+    for (; (i + 16) <= length; i += 16) {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        const __m128i high = _mm_and_si128(_mm_or_si128(first, second), highbits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(first, second));
+    }
+#elif defined(QT_HAVE_NEON64)
+    for (; (i + 16) <= length; i += 16) {
+        const uint16x8_t first = vld1q_u16(src + i);
+        const uint16x8_t second = vld1q_u16(src + i + 8);
+        if (vmaxvq_u16(vorrq_u16(first, second)) > mask) {
+            break;
+        }
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(first), vmovn_u16(second)));
+    }
+#endif
+    while (i < length && src[i] <= mask) {
+        dst[i] = uchar(src[i]);
+        i++;
+    }
+    return i;
+}
+
+QString QTextCodecPrivate::fromLatin1(const char *data, int length)
+{
+    if (length <= 0) {
+        return QString(QLatin1String(""));
+    }
+    QString result(length, Qt::Uninitialized);
+    const uchar *src = reinterpret_cast<const uchar*>(data);
+    ushort *dst = reinterpret_cast<ushort*>(result.data());
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; (i + 16) <= length; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+#elif defined(QT_HAVE_NEON64)
+    for (; (i + 16) <= length; i += 16) {
+        const uint8x16_t chunk = vld1q_u8(src + i);
+        vst1q_u16(dst + i, vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(dst + i + 8, vmovl_high_u8(chunk));
+    }
+#endif
+    for (; i < length; i++) {
+        dst[i] = src[i];
+    }
+    return result;
+}
+
+QString QTextCodecPrivate::fromAscii(const char *data, int length)
+{
+    if (length <= 0) {
+        return QString(QLatin1String(""));
+    }
+    QString result(length, Qt::Uninitialized);
+    const uchar *src = reinterpret_cast<const uchar*>(data);
+    ushort *dst = reinterpret_cast<ushort*>(result.data());
+    int i = 0;
+    while (i < length) {
+        i += qt_from_ascii_block(src + i, length - i, dst + i);
+        if (i < length) {
+            dst[i] = replacementchar;
+            i++;
+        }
+    }
+    return result;
+}
+
+QString QTextCodecPrivate::fromUtf8(const char *data, int length)
+{
+    if (length <= 0) {
+        return QString(QLatin1String(""));
+    }
+    // every byte produces at most one UTF-16 code unit, four byte sequences produce two
+    QString result(length, Qt::Uninitialized);
+    const uchar *src = reinterpret_cast<const uchar*>(data);
+    ushort *start = reinterpret_cast<ushort*>(result.data());
+    ushort *dst = start;
+    int i = 0;
+    while (i < length) {
+        const int ascii = qt_from_ascii_block(src + i, length - i, dst);
+        i += ascii;
+        dst += ascii;
+        if (i >= length) {
+            break;
+        }
+
+        const uchar lead = src[i++];
+        uint ucs = 0;
+        int need = 0;
+        uchar lower = 0x80;
+        uchar upper = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            need = 1;
+            ucs = (lead & 0x1F);
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            need = 2;
+            ucs = (lead & 0x0F);
+            if (lead == 0xE0) {
+                // overlong
+                lower = 0xA0;
+            } else if (lead == 0xED) {
+                // surrogate
+                upper = 0x9F;
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            need = 3;
+            ucs = (lead & 0x07);
+            if (lead == 0xF0) {
+                // overlong
+                lower = 0x90;
+            } else if (lead == 0xF4) {
+                // beyond U+10FFFF
+                upper = 0x8F;
+            }
+        } else {
+            *dst++ = replacementchar;
+            continue;
+        }
+
+        while (need > 0) {
+            if (i >= length || src[i] < lower || src[i] > upper) {
+                // the maximal subpart is replaced, the offending byte is not consumed
+                break;
+            }
+            ucs = (ucs << 6) | (src[i] & 0x3F);
+            lower = 0x80;
+            upper = 0xBF;
+            need--;
+            i++;
+        }
+
+        if (need > 0) {
+            *dst++ = replacementchar;
+        } else if (QChar::requiresSurrogates(ucs)) {
+            *dst++ = QChar::highSurrogate(ucs);
+            *dst++ = QChar::lowSurrogate(ucs);
+        } else {
+            *dst++ = ushort(ucs);
+        }
+    }
+    result.truncate(dst - start);
+    return result;
+}
+
+QByteArray QTextCodecPrivate::toLatin1(const QChar *unicode, int length)
+{
+    if (length <= 0) {
+        return QByteArray("", 0);
+    }
+    QByteArray result(length, Qt::Uninitialized);
+    const ushort *src = reinterpret_cast<const ushort*>(unicode);
+    uchar *dst = reinterpret_cast<uchar*>(result.data());
+    int i = 0;
+    while (i < length) {
+        i += qt_to_8bit_block<0xff>(src + i, length - i, dst + i);
+        if (i < length) {
+            dst[i] = '?';
+            i++;
+        }
+    }
+    return result;
+}
+
+QByteArray QTextCodecPrivate::toAscii(const QChar *unicode, int length)
+{
+    if (length <= 0) {
+        return QByteArray("", 0);
+    }
+    QByteArray result(length, Qt::Uninitialized);
+    const ushort *src = reinterpret_cast<const ushort*>(unicode);
+    uchar *start = reinterpret_cast<uchar*>(result.data());
+    uchar *dst = start;
+    int i = 0;
+    while (i < length) {
+        const int ascii = qt_to_8bit_block<0x7f>(src + i, length - i, dst);
+        i += ascii;
+        dst += ascii;
+        if (i >= length) {
+            break;
+        }
+        // one substitute per code point, not per code unit
+        uint ucs = src[i++];
+        if (QChar::isHighSurrogate(ucs) && i < length && QChar::isLowSurrogate(src[i])) {
+            ucs = QChar::surrogateToUcs4(ushort(ucs), src[i++]);
+        }
+        if (!qt_is_default_ignorable(ucs)) {
+            *dst++ = '?';
+        }
+    }
+    result.truncate(dst - start);
+    return result;
+}
+
+QByteArray QTextCodecPrivate::toUtf8(const QChar *unicode, int length)
+{
+    if (length <= 0) {
+        return QByteArray("", 0);
+    }
+    // every UTF-16 code unit produces at most three bytes, surrogate pairs produce four
+    QByteArray result(length * 3, Qt::Uninitialized);
+    const ushort *src = reinterpret_cast<const ushort*>(unicode);
+    uchar *start = reinterpret_cast<uchar*>(result.data());
+    uchar *dst = start;
+    int i = 0;
+    while (i < length) {
+        const int ascii = qt_to_8bit_block<0x7f>(src + i, length - i, dst);
+        i += ascii;
+        dst += ascii;
+        if (i >= length) {
+            break;
+        }
+
+        uint ucs = src[i++];
+        if (ucs < 0x800) {
+            *dst++ = 0xC0 | uchar(ucs >> 6);
+            *dst++ = 0x80 | uchar(ucs & 0x3F);
+        } else if ((ucs & 0xF800) != 0xD800) {
+            *dst++ = 0xE0 | uchar(ucs >> 12);
+            *dst++ = 0x80 | uchar((ucs >> 6) & 0x3F);
+            *dst++ = 0x80 | uchar(ucs & 0x3F);
+        } else if (QChar::isHighSurrogate(ucs) && i < length && QChar::isLowSurrogate(src[i])) {
+            ucs = QChar::surrogateToUcs4(ushort(ucs), src[i++]);
+            *dst++ = 0xF0 | uchar(ucs >> 18);
+            *dst++ = 0x80 | uchar((ucs >> 12) & 0x3F);
+            *dst++ = 0x80 | uchar((ucs >> 6) & 0x3F);
+            *dst++ = 0x80 | uchar(ucs & 0x3F);
+        } else {
+            // unpaired surrogate
+            *dst++ = '?';
+        }
+    }
+    result.truncate(dst - start);
+    return result;
+}
+
 #ifndef QT_NO_TEXTCODEC
 static void icu_from_callback(
     const void* context,
@@ -1161,14 +1573,16 @@ QTextConverterPrivate::QTextConverterPrivate(const QByteArray &aname)
     : name(aname),
     flags(QTextConverter::DefaultConversion),
     conv(nullptr),
-    invalidchars(0)
+    invalidchars(0),
+    bomchecked(false)
 {
 }
 
 QTextConverterPrivate::QTextConverterPrivate(const int mib)
     : flags(QTextConverter::DefaultConversion),
     conv(nullptr),
-    invalidchars(0)
+    invalidchars(0),
+    bomchecked(false)
 {
     for (qint16 i = 0; i < MIBTblSize; i++) {
         if (mib == MIBTbl[i].mib) {
@@ -1182,9 +1596,7 @@ QTextConverterPrivate::QTextConverterPrivate(const int mib)
 
 QTextConverterPrivate::~QTextConverterPrivate()
 {
-    if (conv) {
-        ucnv_close(conv);
-    }
+    releaseConverter();
 }
 
 UConverter* QTextConverterPrivate::getConverter()
@@ -1193,25 +1605,36 @@ UConverter* QTextConverterPrivate::getConverter()
         return conv;
     }
 
-    UErrorCode error = U_ZERO_ERROR;
-    conv = ucnv_open(name.constData(), &error);
-    if (Q_UNLIKELY(U_FAILURE(error))) {
+    conv = qt_acquire_converter(name.constData());
+    if (Q_UNLIKELY(!conv)) {
         return nullptr;
     }
 
-    error = U_ZERO_ERROR;
+    UErrorCode error = U_ZERO_ERROR;
     if (flags & QTextConverter::ConvertInvalidToNull) {
         ucnv_setSubstString(conv, nullchar, 2, &error);
     } else {
         ucnv_setSubstString(conv, questionmarkchar, 1, &error);
     }
+    setCallbacks();
 
-    error = U_ZERO_ERROR;
+    return conv;
+}
+
+void QTextConverterPrivate::setCallbacks()
+{
+    UErrorCode error = U_ZERO_ERROR;
     ucnv_setToUCallBack(conv, icu_to_callback, this, nullptr, nullptr, &error);
     error = U_ZERO_ERROR;
     ucnv_setFromUCallBack(conv, icu_from_callback, this, nullptr, nullptr, &error);
+}
 
-    return conv;
+void QTextConverterPrivate::releaseConverter()
+{
+    if (conv) {
+        qt_release_converter(name.constData(), conv);
+        conv = nullptr;
+    }
 }
 
 void QTextConverterPrivate::invalidChars(int length) const
@@ -1847,6 +2270,7 @@ QTextConverter::QTextConverter()
     Constructs a QTextConverter copy of \a other.
 */
 QTextConverter::QTextConverter(const QTextConverter &other)
+    : d_ptr(new QTextConverterPrivate(other.d_ptr->name))
 {
     operator=(other);
 }
@@ -1914,6 +2338,7 @@ void QTextConverter::reset()
         ucnv_reset(d_ptr->conv);
     }
     d_ptr->invalidchars = 0;
+    d_ptr->bomchecked = false;
 }
 
 /*!
@@ -1924,20 +2349,21 @@ QTextConverter& QTextConverter::operator=(const QTextConverter &other)
     if (d_ptr == other.d_ptr) {
         return *this;
     }
-    if (d_ptr->conv) {
-        ucnv_close(d_ptr->conv);
-        d_ptr->conv = nullptr;
-    }
+    d_ptr->releaseConverter();
+    d_ptr->name = other.d_ptr->name;
+    d_ptr->flags = other.d_ptr->flags;
+    d_ptr->invalidchars = other.d_ptr->invalidchars;
+    d_ptr->bomchecked = other.d_ptr->bomchecked;
     if (other.d_ptr->conv) {
+        // the clone carries the conversion state over, the callbacks must refer to this object
         UErrorCode error = U_ZERO_ERROR;
         d_ptr->conv = ucnv_safeClone(other.d_ptr->conv, nullptr, nullptr, &error);
         if (Q_UNLIKELY(U_FAILURE(error))) {
             d_ptr->conv = nullptr;
+        } else {
+            d_ptr->setCallbacks();
         }
     }
-    d_ptr->name = other.d_ptr->name;
-    d_ptr->flags = other.d_ptr->flags;
-    d_ptr->invalidchars = other.d_ptr->invalidchars;
     return *this;
 }
 
@@ -1965,37 +2391,71 @@ QByteArray QTextConverter::fromUnicode(const QChar *data, int length) const
     Converts the first \a size characters from the \a data from the
     encoding of this codec to Unicode, and returns the result in a
     QString.
+
+    Incomplete multi-byte sequences at the end of \a data are kept in the
+    converter state and completed by the next call.
+
+    \sa reset()
 */
 QString QTextConverter::toUnicode(const char *data, int length) const
+{
+    QString result;
+    toUnicode(&result, data, length);
+    return result;
+}
+
+/*!
+    \since 4.12
+
+    Converts the first \a length bytes from the \a data from the
+    encoding of this codec to Unicode and appends the result to \a target.
+
+    Incomplete multi-byte sequences at the end of \a data are kept in the
+    converter state and completed by the next call, converting a stream in
+    chunks produces the same result as converting it at once.
+
+    \sa reset()
+*/
+void QTextConverter::toUnicode(QString *target, const char *data, int length) const
 {
     UConverter *conv = d_ptr->getConverter();
-    if (!conv) {
-        return QString();
+    if (Q_UNLIKELY(!conv)) {
+        return;
     }
 
-    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
-    QStdVector<UChar> result(maxbytes);
-    UErrorCode error = U_ZERO_ERROR;
-    const int convresult = ucnv_toUChars(conv, result.data(), maxbytes, data, length, &error);
-    // regardless if the data has BOM or not, BOMs shall be generated explicitly only by QTextStream
-    if (convresult >= 4 && qstrnicmp("UTF-32", d_ptr->name.constData(), 6) == 0) {
-        const uchar* resultuchar = reinterpret_cast<const uchar*>(result.constData());
-        Q_ASSERT(sizeof(qt_utf32le_bom) == sizeof(qt_utf32be_bom));
-        if (::memcmp(resultuchar, qt_utf32le_bom, sizeof(qt_utf32le_bom)) == 0
-            || ::memcmp(resultuchar, qt_utf32be_bom, sizeof(qt_utf32be_bom)) == 0) {
-            const int bomoffset = (sizeof(qt_utf32le_bom) / sizeof(QChar));
-            return QString(reinterpret_cast<const QChar*>(result.constData()) + bomoffset, convresult - bomoffset);
+    const int oldsize = target->size();
+    // most encodings produce at most one UTF-16 code unit per byte, pending bytes from the
+    // previous call may add a few
+    int capacity = oldsize + length + 4;
+    int written = oldsize;
+    const char *source = data;
+    const char *sourcelimit = data + length;
+    forever {
+        target->resize(capacity);
+        UChar *targetstart = reinterpret_cast<UChar*>(target->data());
+        UChar *targetpos = targetstart + written;
+        UErrorCode error = U_ZERO_ERROR;
+        ucnv_toUnicode(conv, &targetpos, targetstart + capacity,
+            &source, sourcelimit, nullptr, false, &error);
+        written = (targetpos - targetstart);
+        if (error != U_BUFFER_OVERFLOW_ERROR) {
+            break;
         }
-    } else if (convresult >= 2 && qstrnicmp("UTF-16", d_ptr->name.constData(), 6) == 0) {
-        const uchar* resultuchar = reinterpret_cast<const uchar*>(result.constData());
-        Q_ASSERT(sizeof(qt_utf16le_bom) == sizeof(qt_utf16be_bom));
-        if (::memcmp(resultuchar, qt_utf16le_bom, sizeof(qt_utf16le_bom)) == 0
-            || ::memcmp(resultuchar, qt_utf16be_bom, sizeof(qt_utf16be_bom)) == 0) {
-            const int bomoffset = (sizeof(qt_utf16le_bom) / sizeof(QChar));
-            return QString(reinterpret_cast<const QChar*>(result.constData()) + bomoffset, convresult - bomoffset);
+        capacity += qMax(int(sourcelimit - source), 16);
+    }
+    target->resize(written);
+
+    // regardless if the data has BOM or not, BOMs shall be generated explicitly only by QTextStream
+    if (!d_ptr->bomchecked && written > oldsize) {
+        d_ptr->bomchecked = true;
+        if (qstrnicmp("UTF-16", d_ptr->name.constData(), 6) == 0
+            || qstrnicmp("UTF-32", d_ptr->name.constData(), 6) == 0) {
+            const ushort first = target->at(oldsize).unicode();
+            if (first == 0xFEFF || first == 0xFFFE) {
+                target->remove(oldsize, 1);
+            }
         }
     }
-    return QString(reinterpret_cast<const QChar*>(result.constData()), convresult);
 }
 
 #endif // QT_NO_TEXTCODEC
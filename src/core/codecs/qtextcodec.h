@@ -56,6 +56,7 @@ public:
         { return toUnicode(ba.constData(), ba.size()); }
     inline QString toUnicode(const char* chars) const
         { return toUnicode(chars, qstrlen(chars)); }
+    void toUnicode(QString *target, const char *in, int length) const;
 
     QByteArray fromUnicode(const QChar *in, int length) const;
     inline QByteArray fromUnicode(const QString &uc) const
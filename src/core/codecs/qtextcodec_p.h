@@ -57,6 +57,14 @@ public:
     static QString convertTo(const char *data, int len, const char* const codec);
     static QByteArray convertFrom(const QChar *unicode, int len, const char* const codec);
 
+    // ICU-free conversions, used by QString
+    static QString fromLatin1(const char *data, int len);
+    static QString fromAscii(const char *data, int len);
+    static QString fromUtf8(const char *data, int len);
+    static QByteArray toLatin1(const QChar *unicode, int len);
+    static QByteArray toAscii(const QChar *unicode, int len);
+    static QByteArray toUtf8(const QChar *unicode, int len);
+
     QByteArray name;
 private:
     Q_DISABLE_COPY(QTextCodecPrivate);
@@ -71,12 +79,15 @@ public:
     ~QTextConverterPrivate();
 
     UConverter* getConverter();
+    void setCallbacks();
+    void releaseConverter();
     void invalidChars(int length) const;
 
     QByteArray name;
     QTextConverter::ConversionFlags flags;
     UConverter* conv;
     mutable int invalidchars;
+    bool bomchecked;
 private:
     Q_DISABLE_COPY(QTextConverterPrivate);
 };
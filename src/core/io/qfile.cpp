@@ -31,6 +31,8 @@
 #include "qcorecommon_p.h"
 #include "qcore_unix_p.h"
 
+#include <sys/mman.h>
+
 #ifdef QT_NO_QOBJECT
 #define tr(X) QString::fromLatin1(X)
 #endif
@@ -41,22 +43,41 @@ QT_BEGIN_NAMESPACE
 QFilePrivate::QFilePrivate()
     : error(QFile::NoError),
     fd(-1),
-    closeFileHandle(false)
+    closeFileHandle(false),
+    sequential(-1),
+    writeBuffer(nullptr),
+    writeBufferUsed(0),
+    writeBufferCapacity(QFILE_WRITEBUFFER_SIZE),
+    writeBuffering(-1)
 {
 }
 
 QFilePrivate::~QFilePrivate()
 {
+    unmapAll();
+    ::free(writeBuffer);
+}
+
+void QFilePrivate::unmapAll()
+{
+    QHash<uchar *, QPair<uchar *, size_t> >::const_iterator it = maps.constBegin();
+    while (it != maps.constEnd()) {
+        ::munmap(it.value().first, it.value().second);
+        ++it;
+    }
+    maps.clear();
 }
 
 bool QFilePrivate::doStat(QFileSystemMetaData::MetaDataFlags flags) const
 {
     if (!metaData.hasFlags(flags)) {
-        if (!fileEntry.isEmpty())
-            QFileSystemEngine::fillMetaData(fileEntry, metaData, metaData.missingFlags(flags));
-
-        if (metaData.missingFlags(flags) && fd != -1)
+        // an open file is asked first, the name may refer to another file
+        // by now or, for QSaveFile, to the one that is going to be replaced
+        if (fd != -1)
             QFileSystemEngine::fillMetaData(fd, metaData);
+
+        if (metaData.missingFlags(flags) && !fileEntry.isEmpty())
+            QFileSystemEngine::fillMetaData(fileEntry, metaData, metaData.missingFlags(flags));
     }
 
     return metaData.exists();
@@ -76,6 +97,7 @@ bool QFilePrivate::openExternalFile(QIODevice::OpenMode mode, int _fd, QFile::Fi
     fileEntry.clear();
     fd = _fd;
     metaData.clear();
+    sequential = -1;
 
     // Seek to the end when in Append mode.
     if (mode & QFile::Append) {
@@ -93,6 +115,68 @@ bool QFilePrivate::openExternalFile(QIODevice::OpenMode mode, int _fd, QFile::Fi
     return true;
 }
 
+bool QFilePrivate::bufferWrites()
+{
+    if (writeBuffering == -1) {
+        Q_Q(QFile);
+        // handles passed to open() may be written to behind our back
+        writeBuffering = (writeBufferCapacity > 0 && closeFileHandle && !fileEntry.isEmpty()
+            && !(q->openMode() & QIODevice::Unbuffered) && !q->isSequential());
+    }
+    return writeBuffering;
+}
+
+bool QFilePrivate::flushWriteBuffer()
+{
+    if (writeBufferUsed == 0)
+        return true;
+    return (writeThrough(nullptr, 0) >= 0);
+}
+
+/*
+    Writes out what is buffered followed by \a data with as few syscalls as
+    possible and empties the buffer, returns how much of \a data was written
+    or -1 if nothing of it was.
+*/
+qint64 QFilePrivate::writeThrough(const char *data, qint64 len)
+{
+    const qint64 pending = writeBufferUsed;
+    writeBufferUsed = 0;
+
+    struct iovec iov[2];
+    iov[0].iov_base = writeBuffer;
+    iov[0].iov_len = size_t(pending);
+    iov[1].iov_base = const_cast<char *>(data);
+    iov[1].iov_len = size_t(len);
+
+    int first = (pending > 0 ? 0 : 1);
+    const int last = (len > 0 ? 2 : 1);
+    qint64 written = 0;
+    while (first < last) {
+        const qint64 result = qt_safe_writev(fd, iov + first, last - first);
+        if (result <= 0)
+            break;
+        written += result;
+
+        qint64 remaining = result;
+        while (first < last && remaining >= qint64(iov[first].iov_len)) {
+            remaining -= iov[first].iov_len;
+            ++first;
+        }
+        if (first < last) {
+            iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + remaining;
+            iov[first].iov_len -= remaining;
+        }
+    }
+
+    if (first < last) {
+        setError(errno == ENOSPC ? QFile::ResourceError : QFile::WriteError, qt_error_string(errno));
+        if (written <= pending)
+            return -1;
+    }
+    return written - pending;
+}
+
 void QFilePrivate::setError(QFile::FileError err, const QString &errStr)
 {
     error = err;
@@ -135,6 +219,13 @@ void QFilePrivate::setError(QFile::FileError err, const QString &errStr)
     using seek(). If you've reached the end of the file, atEnd()
     returns true.
 
+    Small writes to a file opened by name are collected in a write
+    buffer and passed to the operating system together, see
+    setWriteBufferSize(). The buffer is written out by flush(), seek(),
+    close() and before reading, so other processes may not see the
+    data written before that. Errors of buffered writes are reported
+    by the call that writes the buffer out.
+
     \section1 Reading Files Directly
 
     The following example reads a text file line by line:
@@ -288,6 +379,27 @@ void QFilePrivate::setError(QFile::FileError err, const QString &errStr)
     closed by Qt. The application must ensure that close() is called.
  */
 
+/*!
+    \enum QFile::MemoryMapFlag
+    \since 4.14
+
+    This enum describes special options that may be used by the map()
+    function.
+
+    \value NoOptions No options.
+    \value MapPrivateOption The mapped memory will be private, so any
+    modifications will not be visible to other processes and will not
+    be written to disk. Any such modifications will be lost when the
+    memory is unmapped. It is unspecified whether modifications made to
+    the file after the mapping is created will be visible through the
+    mapped memory.
+    \value MapSequentialHint The mapped memory is expected to be read
+    from start to end, so the kernel may read ahead aggressively and drop
+    pages soon after they were accessed.
+    \value MapWillNeedHint The whole mapped range is expected to be
+    accessed soon, so the kernel may start reading it in right away.
+*/
+
 
 #ifdef QT_NO_QOBJECT
 QFile::QFile()
@@ -733,9 +845,17 @@ bool QFile::copy(const QString &fileName, const QString &newName)
 bool QFile::isSequential() const
 {
     Q_D(const QFile);
+    // the type of an open file does not change but QIODevice asks for
+    // it on every read and write, regular files lack the flag so the
+    // metadata cache alone would stat them each time
+    if (d->fd != -1 && d->sequential != -1)
+        return d->sequential;
+    bool result = true;
     if (d->doStat(QFileSystemMetaData::SequentialType))
-        return d->metaData.isSequential();
-    return true;
+        result = d->metaData.isSequential();
+    if (d->fd != -1)
+        d->sequential = result;
+    return result;
 }
 
 /*!
@@ -759,6 +879,7 @@ bool QFile::open(OpenMode mode)
         qWarning("QFile::open: File (%s) already open", qPrintable(fileName()));
         return false;
     }
+    d->unmapAll();
     d->setError(QFile::NoError, QString());
     if (mode & Append) {
         mode |= WriteOnly;
@@ -783,6 +904,7 @@ bool QFile::open(OpenMode mode)
         mode |= QFile::Truncate;
 
     d->metaData.clear();
+    d->sequential = -1;
     d->fd = -1;
 
     int flags = QT_OPEN_RDONLY;
@@ -891,6 +1013,7 @@ bool QFile::open(FILE *fh, OpenMode mode, FileHandleFlags handleFlags)
         qWarning("QFile::open: File (%s) already open", qPrintable(fileName()));
         return false;
     }
+    d->unmapAll();
     d->setError(QFile::NoError, QString());
     if (mode & Append) {
         mode |= WriteOnly;
@@ -956,6 +1079,7 @@ bool QFile::open(int fd, OpenMode mode, FileHandleFlags handleFlags)
         qWarning("QFile::open: File (%s) already open", qPrintable(fileName()));
         return false;
     }
+    d->unmapAll();
     d->setError(QFile::NoError, QString());
     if (mode & Append) {
         mode |= WriteOnly;
@@ -993,6 +1117,8 @@ bool QFile::open(int fd, OpenMode mode, FileHandleFlags handleFlags)
 
     If the file is not open, or there is an error, handle() returns -1.
 
+    Any buffered writes are written out before the handle is returned.
+
     \sa QSocketNotifier
 */
 int QFile::handle() const
@@ -1001,9 +1127,164 @@ int QFile::handle() const
     if (!isOpen()) {
         return -1;
     }
+    // whatever is done with the handle has to see the buffered writes
+    const_cast<QFilePrivate *>(d)->flushWriteBuffer();
     return d->fd;
 }
 
+/*!
+    \since 4.14
+
+    Sets the size of the write buffer to \a size bytes, writes smaller
+    than that are collected in the buffer and larger ones bypass it.
+    Setting it to 0 disables write buffering, so that every write()
+    goes to the operating system right away. Anything buffered is
+    written out first.
+
+    Only files opened by name and temporary files are buffered, not
+    files opened with Unbuffered, sequential files or handles passed to
+    open(). The default size is 16 kilobytes.
+
+    \sa writeBufferSize(), flush()
+*/
+void QFile::setWriteBufferSize(qint64 size)
+{
+    Q_D(QFile);
+    d->flushWriteBuffer();
+    ::free(d->writeBuffer);
+    d->writeBuffer = nullptr;
+    d->writeBufferCapacity = qMax(size, qint64(0));
+    d->writeBuffering = -1;
+}
+
+/*!
+    \since 4.14
+
+    Returns the size of the write buffer.
+
+    \sa setWriteBufferSize()
+*/
+qint64 QFile::writeBufferSize() const
+{
+    Q_D(const QFile);
+    return d->writeBufferCapacity;
+}
+
+/*!
+    \since 4.14
+
+    Maps \a size bytes of the file into memory starting at \a offset. The
+    file must be open for the map to succeed but it does not need to stay
+    open after the memory has been mapped. The file must be readable, the
+    memory is also writable if the file was opened with ReadWrite and
+    writes go to the file unless MapPrivateOption is passed in \a flags.
+    When the QFile is destroyed or a new file is opened with
+    this object, any maps that have not been unmapped will automatically
+    be unmapped.
+
+    The mapping can be used without copying it by wrapping it with
+    QByteArray::fromRawData(), for example to read it through a QBuffer or
+    a QXmlStreamReader, as long as the QByteArray does not outlive the
+    mapping.
+
+    Returns a pointer to the memory or 0 if there is an error, in which
+    case error() describes it. Mapping an empty range or a range past the
+    end of the file fails.
+
+    \sa unmap(), QByteArray::fromRawData()
+*/
+uchar *QFile::map(qint64 offset, qint64 size, MemoryMapFlags flags)
+{
+    Q_D(QFile);
+    if (!isOpen() || d->fd == -1) {
+        d->setError(QFile::PermissionsError, qt_error_string(EACCES));
+        return nullptr;
+    }
+    if (offset < 0 || size <= 0 || offset != qint64(QT_OFF_T(offset))
+        || quint64(size) > quint64(size_t(-1))) {
+        d->setError(QFile::UnspecifiedError, qt_error_string(EINVAL));
+        return nullptr;
+    }
+    // accessing pages past the end of the file raises SIGBUS
+    if (offset + size > QFile::size()) {
+        d->setError(QFile::UnspecifiedError, qt_error_string(EINVAL));
+        return nullptr;
+    }
+
+    int access = 0;
+    if (openMode() & QIODevice::ReadOnly)
+        access |= PROT_READ;
+    if (openMode() & QIODevice::WriteOnly)
+        access |= PROT_WRITE;
+    int sharing = MAP_SHARED;
+    if (flags & QFile::MapPrivateOption) {
+        // copy-on-write, the file is never written to
+        access |= PROT_WRITE;
+        sharing = MAP_PRIVATE;
+    }
+
+    // mmap() requires the offset to be a multiple of the page size
+    static const qint64 pageSize = ::sysconf(_SC_PAGESIZE);
+    const qint64 extra = offset % pageSize;
+    const size_t realSize = size_t(size + extra);
+    const QT_OFF_T realOffset = QT_OFF_T(offset - extra);
+
+    void *mapAddress = QT_MMAP(nullptr, realSize, access, sharing, d->fd, realOffset);
+    if (mapAddress == MAP_FAILED) {
+        switch (errno) {
+            case EACCES:
+                d->setError(QFile::PermissionsError, qt_error_string(errno));
+                break;
+            case ENFILE:
+            case ENOMEM:
+            case EAGAIN:
+                d->setError(QFile::ResourceError, qt_error_string(errno));
+                break;
+            default:
+                d->setError(QFile::UnspecifiedError, qt_error_string(errno));
+                break;
+        }
+        return nullptr;
+    }
+
+    // the hints are advisory, failing to apply them is not an error
+    if (flags & QFile::MapSequentialHint)
+        ::posix_madvise(mapAddress, realSize, POSIX_MADV_SEQUENTIAL);
+    if (flags & QFile::MapWillNeedHint)
+        ::posix_madvise(mapAddress, realSize, POSIX_MADV_WILLNEED);
+
+    uchar *address = static_cast<uchar *>(mapAddress) + extra;
+    d->maps.insert(address, qMakePair(static_cast<uchar *>(mapAddress), realSize));
+    d->setError(QFile::NoError, QString());
+    return address;
+}
+
+/*!
+    \since 4.14
+
+    Unmaps the memory \a address previously returned by map().
+
+    Returns true if the unmap succeeds; false otherwise.
+
+    \sa map()
+*/
+bool QFile::unmap(uchar *address)
+{
+    Q_D(QFile);
+    QHash<uchar *, QPair<uchar *, size_t> >::iterator it = d->maps.find(address);
+    if (it == d->maps.end()) {
+        d->setError(QFile::PermissionsError, qt_error_string(EACCES));
+        return false;
+    }
+    if (::munmap(it.value().first, it.value().second) == -1) {
+        d->setError(QFile::UnspecifiedError, qt_error_string(errno));
+        return false;
+    }
+    d->maps.erase(it);
+    d->setError(QFile::NoError, QString());
+    return true;
+}
+
 /*!
     \fn QString QFile::name() const
 
@@ -1027,6 +1308,9 @@ int QFile::handle() const
 bool QFile::resize(qint64 sz)
 {
     Q_D(QFile);
+    if (!d->flushWriteBuffer()) {
+        return false;
+    }
     if (isOpen() && QT_LSEEK(d->fd, 0, SEEK_CUR) > sz) {
         seek(sz);
     }
@@ -1134,7 +1418,7 @@ bool QFile::flush()
         d->setError(QFile::WriteError, QString());
         return false;
     }
-    return true;
+    return d->flushWriteBuffer();
 }
 
 /*!
@@ -1147,9 +1431,19 @@ void QFile::close()
     Q_D(QFile);
     if(!isOpen())
         return;
-    const bool flushed = flush();
+    bool flushed = flush();
     QIODevice::close();
 
+    // receivers of aboutToClose(), QTextStream for one, write what they hold
+    if (!d->flushWriteBuffer()) {
+        flushed = false;
+    }
+    ::free(d->writeBuffer);
+    d->writeBuffer = nullptr;
+    d->writeBufferUsed = 0;
+    d->writeBuffering = -1;
+    d->sequential = -1;
+
     if (d->fd == -1) {
         d->setError(QFile::UnspecifiedError, QString());
         return;
@@ -1187,6 +1481,7 @@ void QFile::close()
 qint64 QFile::size() const
 {
     Q_D(const QFile);
+    const_cast<QFilePrivate *>(d)->flushWriteBuffer();
     d->metaData.clear();
     if (!d->doStat(QFileSystemMetaData::SizeAttribute))
         return 0;
@@ -1242,6 +1537,10 @@ bool QFile::seek(qint64 off)
         return false;
     }
 
+    if (!d->flushWriteBuffer()) {
+        return false;
+    }
+
     if (Q_UNLIKELY(QT_LSEEK(d->fd, QT_OFF_T(off), SEEK_SET) == -1)) {
         qWarning("QFile::seek: Cannot set file position %lld", off);
         d->setError(QFile::PositionError, qt_error_string(errno));
@@ -1261,6 +1560,9 @@ bool QFile::seek(qint64 off)
 qint64 QFile::readLineData(char *data, qint64 maxlen)
 {
     Q_D(QFile);
+    if (!d->flushWriteBuffer()) {
+        return -1;
+    }
     qint64 readSoFar = 0;
     while (readSoFar < maxlen) {
         char c;
@@ -1288,6 +1590,10 @@ qint64 QFile::readData(char *data, qint64 len)
         return -1;
     }
 
+    if (!d->flushWriteBuffer()) {
+        return -1;
+    }
+
     qint64 readBytes = 0;
     bool eof = false;
 
@@ -1322,24 +1628,31 @@ qint64 QFile::writeData(const char *data, qint64 len)
         return -1;
     }
 
-    qint64 writtenBytes = 0;
-
-    if (d->fd != -1) {
-        ssize_t result;
-        do {
-            result = QT_WRITE(d->fd, data + writtenBytes, size_t(len - writtenBytes));
-        } while ((result == -1 && errno == EINTR)
-                || (result > 0 && (writtenBytes += result) < len));
-    }
-
-    if (len && writtenBytes == 0) {
-        writtenBytes = -1;
-        d->setError(errno == ENOSPC ? QFile::ResourceError : QFile::WriteError, qt_error_string(errno));
+    if (d->fd == -1) {
+        if (len) {
+            d->setError(QFile::WriteError, qt_error_string(EBADF));
+            return -1;
+        }
+        return 0;
     }
 
     d->metaData.clearFlags(QFileSystemMetaData::SizeAttribute);
 
-    return writtenBytes;
+    // coalesce small writes, larger ones go out along with what is buffered
+    if (len < d->writeBufferCapacity && d->bufferWrites()) {
+        if (len > d->writeBufferCapacity - d->writeBufferUsed && !d->flushWriteBuffer()) {
+            return -1;
+        }
+        if (!d->writeBuffer) {
+            d->writeBuffer = static_cast<char *>(::malloc(d->writeBufferCapacity));
+            Q_CHECK_PTR(d->writeBuffer);
+        }
+        ::memcpy(d->writeBuffer + d->writeBufferUsed, data, len);
+        d->writeBufferUsed += len;
+        return len;
+    }
+
+    return d->writeThrough(data, len);
 }
 
 /*!
@@ -76,6 +76,14 @@ public:
     };
     Q_DECLARE_FLAGS(FileHandleFlags, FileHandleFlag)
 
+    enum MemoryMapFlag {
+        NoOptions = 0x0000,
+        MapPrivateOption = 0x0001,
+        MapSequentialHint = 0x0002,
+        MapWillNeedHint = 0x0004
+    };
+    Q_DECLARE_FLAGS(MemoryMapFlags, MemoryMapFlag)
+
     QFile();
     QFile(const QString &name);
 #ifndef QT_NO_QOBJECT
@@ -134,6 +142,12 @@ public:
 
     int handle() const;
 
+    void setWriteBufferSize(qint64 size);
+    qint64 writeBufferSize() const;
+
+    uchar *map(qint64 offset, qint64 size, MemoryMapFlags flags = NoOptions);
+    bool unmap(uchar *address);
+
 protected:
 #ifdef QT_NO_QOBJECT
     QFile(QFilePrivate &dd);
@@ -150,6 +164,7 @@ private:
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QFile::Permissions)
+Q_DECLARE_OPERATORS_FOR_FLAGS(QFile::MemoryMapFlags)
 
 QT_END_NAMESPACE
 
@@ -36,9 +36,12 @@
 #include "qiodevice_p.h"
 #include "qfilesystementry_p.h"
 #include "qfilesystemmetadata_p.h"
+#include "qhash.h"
 
 QT_BEGIN_NAMESPACE
 
+#define QFILE_WRITEBUFFER_SIZE qint64(16384)
+
 class QFilePrivate : public QIODevicePrivate
 {
     Q_DECLARE_PUBLIC(QFile)
@@ -49,12 +52,25 @@ protected:
 
     bool openExternalFile(QIODevice::OpenMode mode, int fd, QFile::FileHandleFlags handleFlags);
     bool doStat(QFileSystemMetaData::MetaDataFlags flags) const;
+    void unmapAll();
+    bool bufferWrites();
+    bool flushWriteBuffer();
+    qint64 writeThrough(const char *data, qint64 len);
 
     QFile::FileError error;
     QFileSystemEntry fileEntry;
     mutable QFileSystemMetaData metaData;
+    // -1 until isSequential() was asked while the file is open
+    mutable int sequential;
     int fd;
     bool closeFileHandle;
+    // from the address handed out by map() to the page aligned mapping
+    QHash<uchar *, QPair<uchar *, size_t> > maps;
+    // write-behind buffer, writes are buffered only for files QFile owns
+    char *writeBuffer;
+    qint64 writeBufferUsed;
+    qint64 writeBufferCapacity;
+    int writeBuffering; // -1 until decided on the first write after open
 
     void setError(QFile::FileError err, const QString &errorString);
 };
@@ -25,22 +25,83 @@
 #ifndef QT_NO_FILESYSTEMWATCHER
 
 #include "qdebug.h"
+#include "qfile.h"
+#include "qsocketnotifier.h"
+
+#ifdef QT_HAVE_INOTIFY_INIT1
+#  include <sys/inotify.h>
+#  include <sys/vfs.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
+#ifdef QT_HAVE_INOTIFY_INIT1
+static const uint QT_INOTIFY_FILE_MASK = (IN_ATTRIB | IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF);
+static const uint QT_INOTIFY_DIRECTORY_MASK = (QT_INOTIFY_FILE_MASK | IN_CREATE | IN_DELETE
+    | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+
+// changes made by other machines are not reported for network filesystems, those are polled
+static bool isInotifyReliable(const QByteArray &nativepath)
+{
+    struct statfs statfsbuf;
+    if (::statfs(nativepath.constData(), &statfsbuf) != 0) {
+        return false;
+    }
+    switch (quint32(statfsbuf.f_type)) {
+        case 0x6969: // NFS_SUPER_MAGIC
+        case 0x517B: // SMB_SUPER_MAGIC
+        case 0xFF534D42: // CIFS_MAGIC_NUMBER
+        case 0xFE534D42: // SMB2_MAGIC_NUMBER
+        case 0x73757245: // CODA_SUPER_MAGIC
+        case 0x5346414F: // AFS_SUPER_MAGIC
+        case 0x01021997: // V9FS_MAGIC
+        case 0x65735546: { // FUSE_SUPER_MAGIC
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 QFileSystemWatcherPrivate::QFileSystemWatcherPrivate()
     : interval(1000),
     timer(q_ptr)
+#ifdef QT_HAVE_INOTIFY_INIT1
+    , inotifyfd(-1),
+    inotifynotifier(nullptr)
+#endif
 {
 }
 
+QFileSystemWatcherPrivate::~QFileSystemWatcherPrivate()
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    if (inotifyfd >= 0) {
+        qt_safe_close(inotifyfd);
+    }
+#endif
+}
+
 QStringList QFileSystemWatcherPrivate::addPaths(const QStringList &paths)
 {
     QStringList p = paths;
     foreach (const QString &path, paths) {
-        const QStatInfo fi(path, true);
-        if (fi.isDir() || path.endsWith(QLatin1Char('/'))) {
-            directories.insert(path, fi);
+#ifdef QT_HAVE_INOTIFY_INIT1
+        if (inotifyfiles.contains(path) || inotifydirectories.contains(path)) {
+            p.removeAll(path);
+            continue;
+        }
+#endif
+        const QStatInfo fi(path);
+        const bool isdir = (fi.isDir() || path.endsWith(QLatin1Char('/')));
+#ifdef QT_HAVE_INOTIFY_INIT1
+        if (fi.exists() && addInotifyPath(path, isdir)) {
+            p.removeAll(path);
+            continue;
+        }
+#endif
+        if (isdir) {
+            directories.insert(path, QStatInfo(path, true));
         } else {
             files.insert(path, fi);
         }
@@ -61,6 +122,15 @@ QStringList QFileSystemWatcherPrivate::removePaths(const QStringList &paths)
         } else if (files.remove(path)) {
             p.removeAll(path);
         }
+#ifdef QT_HAVE_INOTIFY_INIT1
+        else if (inotifydirectories.contains(path)) {
+            removeInotifyPath(path, inotifydirectories.value(path));
+            p.removeAll(path);
+        } else if (inotifyfiles.contains(path)) {
+            removeInotifyPath(path, inotifyfiles.value(path));
+            p.removeAll(path);
+        }
+#endif
     }
     if (files.isEmpty() && directories.isEmpty()) {
         timer.stop();
@@ -68,6 +138,157 @@ QStringList QFileSystemWatcherPrivate::removePaths(const QStringList &paths)
     return p;
 }
 
+#ifdef QT_HAVE_INOTIFY_INIT1
+bool QFileSystemWatcherPrivate::addInotifyPath(const QString &path, const bool isdir)
+{
+    // stat() polling is used as fallback if inotify is not usable or not wanted
+    static const bool noinotify = !qgetenv("QT_NO_INOTIFY").isNull();
+    if (noinotify) {
+        return false;
+    }
+
+    if (inotifyfd == -1) {
+        Q_Q(QFileSystemWatcher);
+        inotifyfd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (Q_UNLIKELY(inotifyfd == -1)) {
+            // do not try again for every path
+            inotifyfd = -2;
+            return false;
+        }
+        inotifynotifier = new QSocketNotifier(inotifyfd, QSocketNotifier::Read, q);
+        QObject::connect(inotifynotifier, SIGNAL(activated(int)), q, SLOT(_q_readInotify()));
+    } else if (inotifyfd < 0) {
+        return false;
+    }
+
+    const QByteArray nativepath = QFile::encodeName(path);
+    if (!isInotifyReliable(nativepath)) {
+        return false;
+    }
+
+    const int wd = ::inotify_add_watch(inotifyfd, nativepath.constData(),
+        isdir ? QT_INOTIFY_DIRECTORY_MASK : QT_INOTIFY_FILE_MASK);
+    if (wd == -1) {
+        return false;
+    }
+    if (isdir) {
+        inotifydirectories.insert(path, wd);
+    } else {
+        inotifyfiles.insert(path, wd);
+    }
+    // the same watch descriptor is returned for paths to the same inode
+    QStringList &wdpaths = inotifypaths[wd];
+    if (!wdpaths.contains(path)) {
+        wdpaths.append(path);
+    }
+    return true;
+}
+
+void QFileSystemWatcherPrivate::removeInotifyPath(const QString &path, const int wd)
+{
+    inotifyfiles.remove(path);
+    inotifydirectories.remove(path);
+    QHash<int, QStringList>::iterator it = inotifypaths.find(wd);
+    if (it == inotifypaths.end()) {
+        return;
+    }
+    it.value().removeAll(path);
+    if (it.value().isEmpty()) {
+        inotifypaths.erase(it);
+        // fails if the kernel already removed the watch, that is fine
+        ::inotify_rm_watch(inotifyfd, wd);
+    }
+}
+#endif
+
+void QFileSystemWatcherPrivate::_q_readInotify()
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    Q_Q(QFileSystemWatcher);
+
+    // all queued events are read at once and the signal is emitted once per path
+    QStdVector<int> changedwds;
+    QHash<int, bool> invalidwds;
+    bool overflow = false;
+    alignas(struct inotify_event) char buffer[16384];
+    while (true) {
+        const qint64 readsize = qt_safe_read(inotifyfd, buffer, sizeof(buffer));
+        if (readsize <= 0) {
+            break;
+        }
+
+        const char *ptr = buffer;
+        const char *end = buffer + readsize;
+        while (ptr < end) {
+            const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+            ptr += (sizeof(struct inotify_event) + event->len);
+            if (event->mask & IN_Q_OVERFLOW) {
+                overflow = true;
+                continue;
+            }
+            QHash<int, bool>::iterator it = invalidwds.find(event->wd);
+            if (it == invalidwds.end()) {
+                changedwds.push_back(event->wd);
+                it = invalidwds.insert(event->wd, false);
+            }
+            if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT)) {
+                it.value() = true;
+            }
+        }
+    }
+
+    if (Q_UNLIKELY(overflow)) {
+        // events were dropped by the kernel, anything may have changed
+        foreach (const int wd, inotifypaths.keys()) {
+            if (!invalidwds.contains(wd)) {
+                changedwds.push_back(wd);
+                invalidwds.insert(wd, true);
+            }
+        }
+    }
+
+    QStringList changedfiles;
+    QStringList changeddirectories;
+    for (int i = 0; i < changedwds.size(); i++) {
+        const int wd = changedwds.at(i);
+        const bool invalid = invalidwds.value(wd);
+        foreach (const QString &path, inotifypaths.value(wd)) {
+            const bool isdir = inotifydirectories.contains(path);
+            if (isdir) {
+                changeddirectories.append(path);
+            } else {
+                changedfiles.append(path);
+            }
+            const QStatInfo fi(path);
+            if (!invalid && fi.exists()) {
+                continue;
+            }
+
+            // the path was removed or the watch went away with the inode, if the path was
+            // replaced watch the new inode
+            removeInotifyPath(path, wd);
+            if (fi.exists() && fi.isDir() == isdir && !addInotifyPath(path, isdir)) {
+                if (isdir) {
+                    directories.insert(path, QStatInfo(path, true));
+                } else {
+                    files.insert(path, fi);
+                }
+                if (!timer.isActive()) {
+                    timer.start(interval);
+                }
+            }
+        }
+    }
+
+    foreach (const QString &path, changedfiles) {
+        emit q->fileChanged(path);
+    }
+    foreach (const QString &path, changeddirectories) {
+        emit q->directoryChanged(path);
+    }
+#endif
+}
+
 void QFileSystemWatcherPrivate::_q_timeout()
 {
     Q_Q(QFileSystemWatcher);
@@ -80,6 +301,11 @@ void QFileSystemWatcherPrivate::_q_timeout()
         if (x.value() != fi) {
             if (!fi.exists()) {
                 fit.remove();
+#ifdef QT_HAVE_INOTIFY_INIT1
+            } else if (addInotifyPath(path, false)) {
+                // the path was created, no need to poll it anymore
+                fit.remove();
+#endif
             } else {
                 files[path] = fi;
             }
@@ -94,12 +320,19 @@ void QFileSystemWatcherPrivate::_q_timeout()
         if (!fi.dirEquals(x.value())) {
             if (!fi.exists()) {
                 dit.remove();
+#ifdef QT_HAVE_INOTIFY_INIT1
+            } else if (addInotifyPath(path, true)) {
+                dit.remove();
+#endif
             } else {
                 directories[path] = fi;
             }
             emit q->directoryChanged(path);
         }
     }
+    if (files.isEmpty() && directories.isEmpty()) {
+        timer.stop();
+    }
 }
 
 /*!
@@ -127,6 +360,12 @@ void QFileSystemWatcherPrivate::_q_timeout()
     they have been renamed or removed from disk, and directories once
     they have been removed from disk.
 
+    On Linux, existing paths are watched with inotify and changes are
+    reported as soon as the event loop runs. Paths that do not exist yet,
+    paths on network filesystems and all paths when inotify is not
+    available are polled every interval(). Setting the \c QT_NO_INOTIFY
+    environment variable disables inotify.
+
     \sa QFile, QDir
 */
 
@@ -251,7 +490,11 @@ void QFileSystemWatcher::removePaths(const QStringList &paths)
 QStringList QFileSystemWatcher::directories() const
 {
     Q_D(const QFileSystemWatcher);
+#ifdef QT_HAVE_INOTIFY_INIT1
+    return (d->directories.keys() + d->inotifydirectories.keys());
+#else
     return d->directories.keys();
+#endif
 }
 
 /*!
@@ -262,11 +505,15 @@ QStringList QFileSystemWatcher::directories() const
 QStringList QFileSystemWatcher::files() const
 {
     Q_D(const QFileSystemWatcher);
+#ifdef QT_HAVE_INOTIFY_INIT1
+    return (d->files.keys() + d->inotifyfiles.keys());
+#else
     return d->files.keys();
+#endif
 }
 
 /*!
-    Returns the interval on which files and directories are checked.
+    Returns the interval on which polled files and directories are checked.
 
     \since 4.14
     \sa setInterval()
@@ -278,7 +525,7 @@ int QFileSystemWatcher::interval() const
 }
 
 /*!
-    Sets the interval on which files and directories are checked.
+    Sets the interval on which polled files and directories are checked.
 
     \since 4.14
     \sa interval()
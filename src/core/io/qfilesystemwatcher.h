@@ -59,6 +59,7 @@ Q_SIGNALS:
 
 private:
     Q_PRIVATE_SLOT(d_func(), void _q_timeout())
+    Q_PRIVATE_SLOT(d_func(), void _q_readInotify())
 };
 
 QT_END_NAMESPACE
@@ -44,20 +44,36 @@
 
 QT_BEGIN_NAMESPACE
 
+class QSocketNotifier;
+
 class QFileSystemWatcherPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QFileSystemWatcher)
 
 public:
     QFileSystemWatcherPrivate();
+    ~QFileSystemWatcherPrivate();
 
     QStringList addPaths(const QStringList &paths);
     QStringList removePaths(const QStringList &paths);
 
     int interval;
     QTimer timer;
+    // paths that are polled
     QHash<QString, QStatInfo> files, directories;
 
+#ifdef QT_HAVE_INOTIFY_INIT1
+    bool addInotifyPath(const QString &path, const bool isdir);
+    void removeInotifyPath(const QString &path, const int wd);
+
+    int inotifyfd;
+    QSocketNotifier *inotifynotifier;
+    // paths that are watched via inotify, mapped to and from their watch descriptors
+    QHash<QString, int> inotifyfiles, inotifydirectories;
+    QHash<int, QStringList> inotifypaths;
+#endif
+
+    void _q_readInotify();
     void _q_timeout();
 };
 
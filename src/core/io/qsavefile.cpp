@@ -0,0 +1,412 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsavefile.h"
+#include "qplatformdefs.h"
+#include "qfile_p.h"
+#include "qfilesystemengine_p.h"
+#include "qdebug.h"
+#include "qcore_unix_p.h"
+
+#include <errno.h>
+
+QT_BEGIN_NAMESPACE
+
+//************* QSaveFilePrivate
+class QSaveFilePrivate : public QFilePrivate
+{
+    Q_DECLARE_PUBLIC(QSaveFile)
+
+protected:
+    QSaveFilePrivate();
+
+    bool createTemporary(const QT_STATBUF *targetinfo);
+    bool linkTemporary();
+    void discard();
+
+    // the file that is replaced, symbolic links are written through
+    QByteArray targetName;
+    // empty while the file can only be reached through the handle
+    QByteArray tempName;
+    // write() clears the error of the previous call, commit() needs all
+    QFile::FileError writeError;
+    QString writeErrorString;
+};
+
+QSaveFilePrivate::QSaveFilePrivate()
+    : writeError(QFile::NoError)
+{
+}
+
+static QByteArray qt_save_file_name(const QByteArray &target)
+{
+    static const char tmpnamechars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    QByteArray result = target + ".XXXXXX";
+    char *data = result.data() + target.size() + 1;
+    for (int i = 0; i < 6; i++) {
+        data[i] = tmpnamechars[qrand() % 52];
+    }
+    return result;
+}
+
+static inline int qt_safe_datasync(int fd)
+{
+    int ret;
+#ifdef QT_HAVE_FDATASYNC
+    Q_EINTR_LOOP(ret, ::fdatasync(fd));
+#else
+    Q_EINTR_LOOP(ret, ::fsync(fd));
+#endif
+    return ret;
+}
+
+bool QSaveFilePrivate::createTemporary(const QT_STATBUF *targetinfo)
+{
+    tempName.clear();
+    fd = -1;
+
+#ifdef O_TMPFILE
+    // an unnamed file is not left behind by a crash, it is given a name
+    // through /proc when committed
+    static const bool haveprocfd = (::access("/proc/self/fd", F_OK) == 0);
+    if (haveprocfd) {
+        const int slash = targetName.lastIndexOf('/');
+        QByteArray dir;
+        if (slash == -1) {
+            dir = ".";
+        } else if (slash == 0) {
+            dir = "/";
+        } else {
+            dir = targetName.left(slash);
+        }
+        // not every filesystem supports it, the named file is the fallback
+        fd = qt_safe_open(dir.constData(), O_TMPFILE | QT_OPEN_RDWR, 0666);
+    }
+#endif
+
+    if (fd == -1) {
+        for (int i = 0; i < 100; i++) {
+            tempName = qt_save_file_name(targetName);
+            fd = qt_safe_open(tempName.constData(), QT_OPEN_CREAT | O_EXCL | QT_OPEN_RDWR, 0666);
+            if (fd != -1 || errno != EEXIST) {
+                break;
+            }
+        }
+        if (fd == -1) {
+            tempName.clear();
+            setError(errno == EMFILE ? QFile::ResourceError : QFile::OpenError,
+                     qt_error_string(errno));
+            return false;
+        }
+    }
+
+    if (targetinfo) {
+        // keep the mode and the owner of the file that is replaced, only the
+        // superuser can give files away so failing to is not an error
+        ::fchmod(fd, targetinfo->st_mode & 07777);
+        if (targetinfo->st_uid != ::geteuid() || targetinfo->st_gid != ::getegid()) {
+            const int ret = ::fchown(fd, targetinfo->st_uid, targetinfo->st_gid);
+            Q_UNUSED(ret);
+        }
+    }
+
+    return true;
+}
+
+bool QSaveFilePrivate::linkTemporary()
+{
+    const QByteArray procpath = "/proc/self/fd/" + QByteArray::number(fd);
+    for (int i = 0; i < 100; i++) {
+        tempName = qt_save_file_name(targetName);
+        if (::linkat(AT_FDCWD, procpath.constData(), AT_FDCWD, tempName.constData(), AT_SYMLINK_FOLLOW) == 0) {
+            return true;
+        } else if (errno != EEXIST) {
+            break;
+        }
+    }
+    tempName.clear();
+    return false;
+}
+
+void QSaveFilePrivate::discard()
+{
+    Q_Q(QSaveFile);
+    const QFile::FileError err = error;
+    const QString errstr = errorString;
+    q->QFile::close();
+    if (!tempName.isEmpty()) {
+        ::unlink(tempName.constData());
+        tempName.clear();
+    }
+    setError(err, errstr);
+}
+
+//************* QSaveFile
+
+/*!
+    \class QSaveFile
+    \reentrant
+    \since 4.14
+    \brief The QSaveFile class is an I/O device for writing files safely.
+
+    \ingroup io
+
+    QSaveFile writes to a temporary file next to the file that is saved
+    and replaces that file only when commit() is called. The data is
+    synced to the disk and the temporary file is renamed to the target,
+    so the file is either the old or the new one even if the application
+    or the system crashes in between, and readers never see a partially
+    written file. If something goes wrong while writing, the old file is
+    left untouched.
+
+    Usage is like that of QFile, except that commit() has to be called
+    when done writing instead of close(). Destroying the object without
+    calling commit() discards the data written.
+
+    Where supported the temporary file has no name until it is committed,
+    so that nothing is left behind by a crash. Otherwise it is named
+    after the target with a random suffix. The permissions and the owner
+    (if possible) of an existing file are kept and symbolic links are
+    written through, replacing the file they point to.
+
+    \sa QFile, QTemporaryFile
+*/
+
+/*!
+    Constructs a new file object to represent the file with the given \a name.
+*/
+QSaveFile::QSaveFile(const QString &name)
+    : QFile(*new QSaveFilePrivate, nullptr)
+{
+    Q_D(QSaveFile);
+    d->fileEntry = QFileSystemEntry(name);
+}
+
+/*!
+    Constructs a new file object with the given \a parent.
+*/
+QSaveFile::QSaveFile(QObject *parent)
+    : QFile(*new QSaveFilePrivate, parent)
+{
+}
+
+/*!
+    Constructs a new file object with the given \a parent to represent the
+    file with the specified \a name.
+*/
+QSaveFile::QSaveFile(const QString &name, QObject *parent)
+    : QFile(*new QSaveFilePrivate, parent)
+{
+    Q_D(QSaveFile);
+    d->fileEntry = QFileSystemEntry(name);
+}
+
+/*!
+    Destroys the file object, discarding the data written unless commit()
+    was called.
+*/
+QSaveFile::~QSaveFile()
+{
+    Q_D(QSaveFile);
+    if (isOpen()) {
+        d->discard();
+    }
+}
+
+/*!
+    Opens a temporary file for the file set by setFileName() using
+    OpenMode \a mode, returning true if successful; otherwise false.
+
+    The \a mode must contain QIODevice::WriteOnly, QIODevice::Append is
+    not supported. The file that is saved is not touched until commit().
+
+    \sa commit(), QFile::open()
+*/
+bool QSaveFile::open(OpenMode mode)
+{
+    Q_D(QSaveFile);
+    if (Q_UNLIKELY(isOpen())) {
+        qWarning("QSaveFile::open: File (%s) already open", qPrintable(fileName()));
+        return false;
+    }
+    d->unmapAll();
+    d->setError(QFile::NoError, QString());
+    d->writeError = QFile::NoError;
+    d->writeErrorString.clear();
+    if (Q_UNLIKELY(!(mode & WriteOnly) || (mode & Append))) {
+        qWarning("QSaveFile::open: Open mode not supported");
+        return false;
+    }
+
+    if (Q_UNLIKELY(d->fileEntry.isEmpty())) {
+        qWarning("QSaveFile::open: No file name specified");
+        d->setError(QFile::OpenError, QLatin1String("No file name specified"));
+        return false;
+    }
+
+    // write through symbolic links instead of replacing them
+    d->targetName = d->fileEntry.nativeFilePath();
+    QT_STATBUF statbuf;
+    if (QT_LSTAT(d->targetName.constData(), &statbuf) == 0 && S_ISLNK(statbuf.st_mode)) {
+        QFileSystemMetaData metadata;
+        QFileSystemEntry resolved = QFileSystemEngine::canonicalName(d->fileEntry, metadata);
+        if (resolved.isEmpty()) {
+            resolved = QFileSystemEntry(QFileSystemEngine::linkTarget(d->fileEntry, metadata));
+        }
+        d->targetName = resolved.nativeFilePath();
+    }
+
+    const bool exists = (QT_STAT(d->targetName.constData(), &statbuf) == 0);
+    if (exists && S_ISDIR(statbuf.st_mode)) {
+        d->setError(QFile::OpenError, QLatin1String("file to open is a directory"));
+        return false;
+    }
+    // a file that can not be written to must not be replaced either
+    if (exists && ::access(d->targetName.constData(), W_OK) != 0) {
+        d->setError(QFile::OpenError, qt_error_string(errno));
+        return false;
+    }
+
+    d->metaData.clear();
+    d->sequential = -1;
+    if (!d->createTemporary(exists ? &statbuf : nullptr)) {
+        return false;
+    }
+    d->closeFileHandle = true;
+
+    if (!(mode & ReadOnly)) {
+        mode |= Truncate;
+    }
+    QIODevice::open(mode);
+    return true;
+}
+
+/*!
+    Replaces the file with what was written and closes it. Returns true
+    if successful; otherwise returns false and the file is left as it
+    was.
+
+    Calling commit() after an error while writing or after
+    cancelWriting() discards the data written and returns false, error()
+    tells what went wrong.
+
+    \sa cancelWriting()
+*/
+bool QSaveFile::commit()
+{
+    Q_D(QSaveFile);
+    if (Q_UNLIKELY(!isOpen())) {
+        qWarning("QSaveFile::commit: File (%s) is not open", qPrintable(fileName()));
+        return false;
+    }
+
+    // QTextStream and the like write what they hold when told so, the
+    // data has to be on the disk before the name refers to it otherwise a
+    // crash may leave an empty file in place of the old one
+    emit aboutToClose();
+    if (d->writeError != QFile::NoError || !flush()) {
+        if (d->writeError != QFile::NoError) {
+            d->setError(d->writeError, d->writeErrorString);
+        }
+        d->discard();
+        return false;
+    }
+    if (qt_safe_datasync(d->fd) != 0) {
+        d->setError(QFile::WriteError, qt_error_string(errno));
+        d->discard();
+        return false;
+    }
+    if (d->tempName.isEmpty() && !d->linkTemporary()) {
+        d->setError(QFile::RenameError, qt_error_string(errno));
+        d->discard();
+        return false;
+    }
+
+    QFile::close();
+    if (error() != QFile::NoError) {
+        ::unlink(d->tempName.constData());
+        d->tempName.clear();
+        return false;
+    }
+
+    if (::rename(d->tempName.constData(), d->targetName.constData()) != 0) {
+        d->setError(QFile::RenameError, qt_error_string(errno));
+        ::unlink(d->tempName.constData());
+        d->tempName.clear();
+        return false;
+    }
+    d->tempName.clear();
+    return true;
+}
+
+/*!
+    Makes the next commit() discard what was written, for an example when
+    the data to be saved turns out to be incomplete. The file is left as
+    it was.
+
+    \sa commit()
+*/
+void QSaveFile::cancelWriting()
+{
+    Q_D(QSaveFile);
+    if (!isOpen()) {
+        return;
+    }
+    d->writeError = QFile::WriteError;
+    d->writeErrorString = QLatin1String("Writing canceled by the application");
+}
+
+/*!
+    \reimp
+*/
+qint64 QSaveFile::writeData(const char *data, qint64 len)
+{
+    Q_D(QSaveFile);
+    if (d->writeError != QFile::NoError) {
+        return -1;
+    }
+
+    const qint64 written = QFile::writeData(data, len);
+    if (d->error != QFile::NoError) {
+        d->writeError = d->error;
+        d->writeErrorString = d->errorString;
+    }
+    return written;
+}
+
+/*!
+    \internal
+
+    Closing discards what was written, commit() saves it.
+*/
+void QSaveFile::close()
+{
+    Q_D(QSaveFile);
+    if (!isOpen()) {
+        return;
+    }
+    qWarning("QSaveFile::close: Discarding %s, use commit() to save it", qPrintable(fileName()));
+    d->discard();
+}
+
+#include "moc_qsavefile.h"
+
+QT_END_NAMESPACE
@@ -0,0 +1,62 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSAVEFILE_H
+#define QSAVEFILE_H
+
+#include <QtCore/qfile.h>
+
+#ifdef open
+#error qsavefile.h must be included before any header file that defines open
+#endif
+
+
+QT_BEGIN_NAMESPACE
+
+
+class QSaveFilePrivate;
+
+class Q_CORE_EXPORT QSaveFile : public QFile
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QSaveFile)
+
+public:
+    explicit QSaveFile(const QString &name);
+    explicit QSaveFile(QObject *parent = nullptr);
+    QSaveFile(const QString &name, QObject *parent);
+    ~QSaveFile();
+
+    bool open(OpenMode flags);
+    bool commit();
+    void cancelWriting();
+
+protected:
+    qint64 writeData(const char *data, qint64 len);
+
+private:
+    void close();
+    Q_DISABLE_COPY(QSaveFile)
+};
+
+QT_END_NAMESPACE
+
+
+#endif // QSAVEFILE_H
@@ -30,6 +30,7 @@
 
 #include "qsettings_p.h"
 #include "qfile.h"
+#include "qsavefile.h"
 #include "qdir.h"
 
 QT_BEGIN_NAMESPACE
@@ -177,7 +178,7 @@ void QSettingsPrivate::read()
         qWarning("QSettingsPrivate::read: failed to open %s", filename.toLocal8Bit().constData());
         return;
     }
-    qt_lock_fd(readfile.handle(), true);
+    // no lock, write() replaces the file as a whole
 
     if (Q_UNLIKELY(!ini_settings_read(readfile, map))) {
         status = QSettings::FormatError;
@@ -192,31 +193,46 @@ void QSettingsPrivate::write()
         return;
     }
 
+    // writers take turns through a lock on the file they replace, readers
+    // are not held up by it since they get either the old or the new file
+    const QByteArray nativefilename = QFile::encodeName(filename);
     QSettingsMap mergemap;
-    {
-        QFile readfile(filename);
-        if (readfile.open(QFile::ReadOnly)) {
-            qt_lock_fd(readfile.handle(), true);
+    QFile readfile(filename);
+    while (readfile.open(QFile::ReadOnly)) {
+        qt_lock_fd(readfile.handle(), false);
+        // another writer may have replaced it while waiting for the lock
+        QT_STATBUF lockedinfo;
+        QT_STATBUF currentinfo;
+        if (QT_FSTAT(readfile.handle(), &lockedinfo) != 0
+            || QT_STAT(nativefilename.constData(), &currentinfo) != 0
+            || (lockedinfo.st_dev == currentinfo.st_dev && lockedinfo.st_ino == currentinfo.st_ino)) {
             ini_settings_read(readfile, mergemap);
+            break;
         }
-        foreach(const QString &key, map.keys()) {
-            mergemap.insert(key, map.value(key));
-        }
+        readfile.close();
+    }
+    foreach(const QString &key, map.keys()) {
+        mergemap.insert(key, map.value(key));
     }
 
-    QFile writefile(filename);
+    QSaveFile writefile(filename);
     if (Q_UNLIKELY(!writefile.open(QFile::WriteOnly))) {
         status = QSettings::AccessError;
         qWarning("QSettingsPrivate::write: failed to open %s", filename.toLocal8Bit().constData());
         return;
     }
-    qt_lock_fd(writefile.handle(), false);
 
     if (Q_UNLIKELY(!ini_settings_write(writefile, mergemap))) {
         status = QSettings::FormatError;
         qWarning("QSettingsPrivate::write: could not write %s", filename.toLocal8Bit().constData());
         return;
     }
+
+    if (Q_UNLIKELY(!writefile.commit())) {
+        status = QSettings::AccessError;
+        qWarning("QSettingsPrivate::write: could not save %s", filename.toLocal8Bit().constData());
+        return;
+    }
 }
 
 QString QSettingsPrivate::toGroupKey(const QString &key) const
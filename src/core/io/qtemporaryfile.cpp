@@ -266,6 +266,7 @@ bool QTemporaryFile::open()
     d->fileEntry = QFileSystemEntry(filename, QFileSystemEntry::FromNativePath());
     d->closeFileHandle = true;
     d->metaData.clear();
+    d->sequential = -1;
 
     QIODevice::open(QIODevice::ReadWrite);
 
@@ -441,8 +441,8 @@ bool QTextStreamPrivate::fillReadBuffer(qint64 maxBytes)
 
     int oldReadBufferSize = readBuffer.size();
 #ifndef QT_NO_TEXTCODEC
-    // convert to unicode
-    readBuffer += readConverter.toUnicode(buffer.constData(), bytesRead);
+    // convert to unicode, multi-byte sequences split between reads are kept by the converter
+    readConverter.toUnicode(&readBuffer, buffer.constData(), bytesRead);
 #else
     readBuffer += QString::fromAscii(buffer.constData());
 #endif
@@ -21,6 +21,7 @@
 
 #include "qtldurl_p.h"
 #include "qstringlist.h"
+#include "qcorecommon_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -9723,12 +9724,1118 @@ static const char* TLDTbl[9691] = {
     "enterprisecloud.nu",
 };
 static const qint16 TLDTblSize = 9691;
+static const int TLDMaxLength = 57;
 
-static inline bool containsTLDEntry(const QString &entry)
+static const qint16 TLDHashTbl[16384] = {
+    6313, 2513, 4611, 3746, 7507, 7722, 9310, -1, -1, -1, 8156, 232, 7736, -1, -1, 6532,
+    9402, -1, 1819, 5816, -1, 1093, 1100, 1279, 4595, 9582, -1, -1, -1, -1, -1, 5176,
+    -1, 345, -1, -1, -1, 2753, 3639, -1, -1, -1, -1, -1, -1, 3633, 3679, 5495,
+    5745, 6159, 816, 1970, -1, 444, 6960, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 256, -1, -1, 5019, 9167, 1702, -1, -1, -1, 2227, -1, -1, 2507, -1,
+    3657, 5346, -1, -1, -1, 9506, -1, 349, 3813, 8626, -1, 7046, 1101, 2157, 877, 5824,
+    5427, -1, -1, -1, -1, 1252, 5754, -1, -1, 5823, -1, 8367, 3918, 8582, 9250, -1,
+    -1, 9560, -1, -1, 5846, 6689, 696, 1900, 7613, 8183, -1, -1, -1, 2518, 3272, -1,
+    -1, 3417, -1, 3244, 3075, 4386, 7002, -1, -1, 8240, 6710, -1, 4081, -1, 3134, 3785,
+    -1, -1, -1, 7185, 5842, 503, 1987, -1, 1026, 5920, 6352, 7026, 5016, 8106, 5572, -1,
+    7807, 8633, -1, -1, 3175, -1, -1, 6222, -1, -1, -1, 5706, 8729, -1, 4719, 7718,
+    -1, -1, 8089, 7850, 4603, 9138, 1949, 257, 2756, 3383, 4726, -1, 993, 859, -1, 4814,
+    2692, -1, 5113, -1, 1590, 3945, 6845, -1, 5973, -1, 140, 3292, 6738, -1, 7417, -1,
+    -1, -1, 4016, -1, 6302, -1, 6378, -1, 8166, -1, 2816, 6905, 6497, -1, -1, -1,
+    1608, 2610, -1, -1, 6102, 9674, -1, -1, 7319, 5677, 8482, -1, 9142, -1, -1, 4941,
+    -1, 7097, -1, -1, -1, 1477, 7827, -1, 941, 1964, 6698, 7322, -1, -1, 1633, 3920,
+    6806, 6922, -1, 3491, -1, 9660, -1, -1, -1, 6195, 2822, 2912, 4739, 1331, 4301, 9658,
+    5593, 110, 5703, 6858, -1, -1, -1, 8779, 5079, -1, -1, 6186, 749, 1128, -1, -1,
+    -1, -1, -1, 5879, 5467, -1, -1, -1, 4290, -1, -1, 6167, -1, -1, -1, 7930,
+    -1, 7229, -1, 3127, 4883, 1621, 4913, 1395, -1, -1, -1, -1, 5875, 8723, -1, 7877,
+    -1, 3868, 3279, 1596, 2117, 2430, 2770, 3405, 5470, 1479, 1013, 3106, 1939, 4042, 5942, 6740,
+    8308, -1, -1, -1, -1, -1, 7503, 245, 4783, 212, -1, -1, 7570, -1, 4360, -1,
+    -1, -1, -1, 6946, 1067, 687, 7956, -1, -1, 6631, 2255, -1, -1, 1960, -1, 9419,
+    -1, 5170, 6648, -1, -1, 7337, -1, -1, -1, -1, -1, -1, -1, 7443, 7974, 5819,
+    1347, -1, -1, 2428, 8595, -1, 1912, -1, 6499, 7269, -1, -1, 893, -1, -1, 7331,
+    -1, 5036, -1, -1, 5077, -1, 218, 7068, 8561, 1892, 8572, 660, -1, -1, -1, -1,
+    8872, -1, -1, -1, -1, -1, 6025, -1, 2156, -1, 6249, 2118, 7248, -1, -1, -1,
+    -1, -1, -1, 4344, 3297, 5740, -1, -1, -1, -1, 8523, 7633, -1, -1, -1, -1,
+    -1, 3962, 3878, 2924, 7893, -1, -1, -1, -1, 7847, -1, -1, 430, 448, 4082, 4633,
+    6769, 912, 3148, 7899, -1, 8338, 2368, -1, 5047, 1962, 3632, -1, -1, 2727, 8958, 1428,
+    -1, 2835, -1, 5561, 5208, 8177, 2911, 4454, 6411, 7036, 359, 6705, -1, -1, -1, -1,
+    -1, 9070, -1, 4399, 6888, 7624, 1815, 8894, 5434, 8641, 9151, -1, -1, 3537, 1690, 3783,
+    -1, -1, 7506, -1, 5611, -1, -1, 2420, -1, 702, 8098, 984, 8, 7345, 79, -1,
+    -1, -1, -1, -1, 3380, 4066, 8660, 4576, 9404, 3831, 1580, 4513, -1, 8341, 8775, 9330,
+    -1, -1, -1, -1, -1, 5212, 1076, 527, -1, 8684, -1, -1, -1, -1, 5658, 9208,
+    -1, 3903, 5375, -1, 4397, 8646, 2220, 7151, 867, 1817, 2837, 4766, -1, 382, 2531, 1034,
+    6901, -1, -1, -1, 8250, -1, -1, 1481, -1, 5452, -1, -1, 7344, 2762, -1, 8028,
+    -1, -1, -1, 5347, -1, 6114, 8585, 698, 9248, 2302, 5245, 3153, -1, -1, 1923, -1,
+    -1, -1, -1, -1, 7869, 652, -1, 2711, 8182, -1, 9072, -1, 3603, 7946, -1, 7378,
+    -1, 1025, 3342, 4121, 4778, -1, 3715, 6909, 437, 8404, -1, 647, 4383, 8490, -1, 6685,
+    1816, 3839, 4892, 3230, 6833, 8360, -1, -1, 9005, -1, 3083, 3389, 5184, 8137, -1, -1,
+    -1, -1, 7575, 7104, 632, 5757, 9198, -1, -1, 3168, -1, -1, -1, 8842, -1, -1,
+    -1, 9684, -1, 4298, 6750, 7212, -1, -1, -1, -1, -1, 8732, -1, -1, -1, 6031,
+    6071, -1, -1, 4054, -1, -1, 2473, 6079, -1, -1, -1, -1, 1937, -1, 718, -1,
+    706, 415, 8430, 8989, 9625, 33, 3781, 1787, 6481, 9300, -1, 4223, -1, -1, -1, 7524,
+    7312, -1, 2729, 2555, 7470, 7343, -1, -1, 885, -1, -1, 2104, 9052, 197, 7357, 6294,
+    5822, 7310, 8943, -1, -1, 8616, 1484, 7672, -1, 4010, -1, 3951, 931, 8435, 7518, -1,
+    -1, 9626, -1, -1, -1, 8609, -1, 4392, 720, 6126, 284, 8179, 8492, 4622, -1, -1,
+    -1, -1, 4781, 7568, -1, 2516, -1, -1, 9548, -1, 5736, 1934, 6521, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 6330, -1, 1982, 2785, 2880, 7249, -1, -1, -1, 2402,
+    3366, -1, 540, 3675, 5058, 7789, 8190, 5070, -1, 3865, -1, -1, 5799, -1, 5374, -1,
+    8487, -1, 6870, 7458, 568, 7854, 7052, 6956, 5042, 7250, 6356, -1, 1641, 3741, -1, -1,
+    4255, 2298, -1, -1, 1418, -1, 5348, -1, -1, -1, -1, 6782, 7015, -1, 6112, -1,
+    -1, 4184, -1, -1, -1, 8696, 5692, 3236, -1, -1, 2772, 7059, 1950, -1, 2143, -1,
+    8763, -1, 2160, 2980, 6038, 5608, -1, -1, -1, 7914, -1, 5031, 2508, 3625, 6458, 7934,
+    5531, -1, -1, 4632, 7069, 2128, 2234, 2617, -1, 7581, -1, -1, -1, 361, 461, 3495,
+    -1, -1, -1, -1, 856, -1, -1, -1, 6075, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 4049, -1, -1, -1, 2179, -1, -1, -1, -1, 9060, -1, 1784, 150, -1,
+    -1, 204, 4837, -1, -1, -1, -1, -1, -1, -1, 9380, 8426, -1, 1144, 8888, 9325,
+    6711, -1, 4124, -1, -1, 4246, -1, 2750, -1, 6863, -1, -1, -1, -1, 5254, -1,
+    -1, -1, 7926, -1, -1, -1, -1, 4067, -1, -1, -1, -1, 5813, -1, 6726, -1,
+    6561, -1, -1, -1, 6362, 8514, -1, -1, 4213, -1, -1, -1, -1, 4956, -1, -1,
+    7783, 1800, 5787, 913, 6485, 6662, 1530, -1, 5471, -1, -1, 2307, -1, 8164, 9170, -1,
+    216, -1, 8733, 1449, 3320, 7209, -1, -1, -1, -1, -1, 6014, 3832, -1, -1, 3619,
+    -1, -1, -1, -1, 3341, 4972, 3062, 5238, 5328, 7995, -1, 2759, -1, -1, 1762, 373,
+    1116, 2199, 684, 4762, -1, 506, 4924, -1, -1, 6530, -1, -1, -1, -1, -1, 3873,
+    4757, 7461, -1, -1, -1, -1, -1, -1, -1, 3496, 1488, 6065, 615, 8858, -1, -1,
+    -1, -1, 991, 3758, 5591, 7863, 2705, 3527, 558, 4091, 1890, 8022, 1091, -1, 5057, -1,
+    7213, -1, -1, -1, 3944, 312, -1, 2070, 3340, 7994, -1, 6945, 1944, 5312, 5948, 1070,
+    5694, -1, -1, 712, 5928, -1, -1, 2097, -1, 4868, 8372, 4849, 9543, 3020, -1, 7866,
+    -1, -1, -1, 8033, -1, -1, 1978, 5222, -1, 1689, -1, -1, 2978, -1, -1, -1,
+    -1, -1, 480, 4624, 8235, -1, 3925, 2278, 8352, -1, 3044, 1290, 3917, 4346, 2587, 5878,
+    9003, 9635, 2053, 4471, 5921, 9186, -1, 9650, 7136, 1895, 9557, 4074, 4903, 291, 1684, 5793,
+    6921, 6961, 7090, 7595, -1, -1, 342, -1, -1, 2208, -1, -1, 6015, 1354, -1, -1,
+    -1, -1, -1, -1, 9173, -1, 2733, 2422, 6577, 5896, -1, 4017, 46, -1, 7278, -1,
+    6450, 7094, 416, 886, 2126, 371, 5884, 7199, 7537, 7817, 5053, 8289, 3685, 7145, 9028, 9349,
+    4327, 7125, -1, 5983, -1, 5946, 8010, -1, 6407, 6424, 6768, -1, 1212, 3462, 4447, 7404,
+    7532, 8413, -1, 1898, 9450, 3140, -1, -1, -1, 3804, 7837, -1, -1, 5336, 967, 1097,
+    4817, 386, 2620, 51, 3408, 6119, 8133, 4243, -1, -1, 5041, -1, -1, 2454, 2099, 241,
+    2601, 5395, -1, -1, -1, 6930, -1, 8111, -1, 3933, 8313, 87, -1, 4722, -1, -1,
+    5525, -1, 6042, 6640, 1289, 6767, 9686, 2203, 9407, -1, 511, 7480, 4212, -1, 4840, -1,
+    -1, 2481, -1, -1, -1, 490, 9025, 862, 7566, 6391, 5977, 9439, 5448, -1, 7554, 5742,
+    8839, 5117, 5614, -1, 1975, -1, -1, -1, 8643, -1, -1, 2645, -1, -1, -1, 5364,
+    8897, -1, -1, -1, -1, -1, -1, -1, 7626, -1, -1, -1, 2721, 1654, -1, -1,
+    9406, 2046, 7283, -1, -1, 3759, 6994, 5088, 9522, -1, 2409, 7917, 8529, 8949, 9283, 8645,
+    4930, 9319, 5646, 8712, -1, 5143, -1, -1, -1, 548, -1, 6199, 5411, 6019, 9416, 4533,
+    -1, -1, 8315, -1, -1, 7009, 2121, 9024, -1, -1, -1, 762, 3905, -1, 7183, 9405,
+    4983, 5901, -1, 2538, 4565, 6683, 896, 3518, 7076, 4465, 6944, 868, 8884, 3717, 9053, -1,
+    6756, -1, -1, -1, -1, 714, -1, -1, -1, 351, -1, -1, -1, -1, -1, 8091,
+    -1, -1, 8454, -1, -1, 4310, -1, 5183, 3354, -1, -1, -1, -1, -1, 7485, 4265,
+    -1, -1, -1, -1, 8321, -1, 2529, 3874, 4761, 5233, 9498, -1, 3108, -1, -1, -1,
+    -1, 1436, -1, 6681, 8896, -1, -1, -1, -1, -1, 5246, 1729, 4044, 2003, 5865, 402,
+    4120, 6134, 7270, 3855, 6248, 7951, 5643, 9232, 2391, 9238, 2338, -1, -1, -1, -1, 1057,
+    3102, 6009, 670, 6002, 6050, 6773, 7818, -1, -1, 5802, 4271, 6940, -1, -1, -1, -1,
+    -1, -1, -1, 7890, -1, 364, 5161, 293, 7005, 6156, 7014, -1, -1, 6080, 4199, 6622,
+    7215, 8603, -1, -1, 2127, 9292, 7206, 3339, -1, 6594, 6482, 5933, -1, 363, 891, 1238,
+    -1, 6316, 8147, 348, 7625, 7785, 3016, 4827, 8985, 9230, 5594, 9218, -1, -1, 933, -1,
+    2114, 6090, -1, -1, 7272, -1, -1, -1, -1, -1, -1, 747, 8612, -1, 705, 5862,
+    -1, -1, -1, -1, -1, 259, -1, -1, 3268, -1, -1, 3994, -1, -1, 3335, -1,
+    -1, -1, 3294, 4355, -1, -1, 7830, 9410, -1, -1, 1598, 8702, 6259, -1, 1810, 1929,
+    3041, -1, -1, -1, 9266, -1, -1, -1, -1, 3912, 5078, 9309, -1, 3463, -1, 4419,
+    8407, 7808, -1, -1, 8270, 5906, -1, -1, -1, -1, 1783, 2261, 2618, 2719, 4667, 5029,
+    6053, 453, 6671, 9249, 9302, 7688, 9473, 9510, -1, 3505, 6303, 8334, -1, 1381, 7824, -1,
+    -1, -1, 1105, -1, -1, 807, 1367, 4200, 661, 6465, 8715, -1, -1, 3835, -1, 3838,
+    5135, -1, -1, -1, -1, -1, 5509, -1, 4425, 6440, 6468, 4594, 6760, 7474, -1, 7333,
+    -1, 5023, 3859, 3052, 6456, -1, -1, -1, -1, -1, -1, 4477, 8802, 2784, 8740, 5351,
+    8726, 53, 9213, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4051, 2144, 648, 6138,
+    9555, 5537, 998, 6484, 628, 5999, 7374, 3531, 3450, 1678, -1, 4302, 2933, -1, 3792, 4547,
+    8812, 4058, 8959, 8993, 9240, 115, 2268, 6386, 1681, 3058, 7144, 8097, 4372, 8692, 5115, 8961,
+    4638, 6504, 7100, -1, 6819, 6749, 2870, -1, -1, -1, -1, 5302, 7523, 9459, -1, 4702,
+    -1, -1, 9659, -1, -1, 5528, 8588, -1, 570, -1, -1, -1, 544, 7324, 9162, 5134,
+    -1, -1, 449, 4540, 8440, 3218, 3284, 4462, 8460, 9290, 1675, 1352, 8944, -1, 118, -1,
+    3018, 6824, 4112, 7864, -1, 1087, -1, -1, 3830, 904, 717, 2774, 4193, 4473, 7552, 4012,
+    1587, 4806, 5334, 2218, 7377, 6840, 8584, 460, 8699, -1, 5587, -1, -1, -1, 1142, 1881,
+    -1, -1, -1, -1, -1, 3592, -1, -1, 3247, -1, 645, 4872, 7889, -1, -1, -1,
+    1461, -1, -1, 551, 8208, 2384, -1, 2299, 1079, 4552, -1, -1, 1725, -1, 5750, -1,
+    -1, -1, -1, -1, -1, 1272, -1, -1, -1, 85, 6285, 9617, -1, -1, -1, -1,
+    -1, 6033, 665, 3315, 1510, 5321, 8970, -1, -1, -1, -1, -1, 3182, 0, 3534, 8011,
+    -1, 3857, 1038, -1, 1727, 2867, -1, 2098, -1, -1, -1, -1, -1, 6062, 468, -1,
+    -1, -1, 1686, -1, -1, 7298, -1, -1, -1, 1668, 4689, -1, 5748, -1, -1, 4938,
+    1260, 1779, 5337, 5680, 7172, 6003, 5560, 9337, 9422, 7308, 1473, 5696, 2715, 7742, 4581, -1,
+    -1, -1, 3187, 6731, -1, -1, -1, 493, 3068, 4204, 7317, -1, -1, 1507, 8001, 9203,
+    5012, -1, -1, 566, 3695, 1563, 4130, 2606, -1, -1, 3138, 7652, 9323, 1931, 4700, 3635,
+    5654, 707, 6563, -1, 1796, -1, 5429, 3501, -1, -1, -1, -1, -1, 8459, -1, -1,
+    8840, 4483, 5902, -1, 1409, -1, 8335, 4997, -1, 9102, -1, -1, -1, 4033, 7676, 8823,
+    8598, -1, -1, -1, -1, -1, 9088, 8516, -1, -1, -1, 4149, -1, 4821, 5378, -1,
+    -1, 6779, -1, -1, -1, -1, -1, 1695, 1191, 4086, 4682, 190, -1, -1, 5304, -1,
+    2893, -1, 8204, -1, 1882, -1, -1, 3221, 8336, 5329, -1, 4297, 6379, -1, 477, 6437,
+    -1, -1, -1, 1848, 4007, 1114, 2244, 6398, 8635, 1304, -1, 7491, -1, -1, 7976, -1,
+    5119, -1, 4140, 228, -1, 2547, 6288, -1, 5867, -1, 7444, 3847, -1, -1, 1185, -1,
+    -1, -1, -1, -1, 1651, 5073, -1, -1, -1, -1, -1, -1, 4119, 4485, -1, -1,
+    -1, -1, -1, -1, -1, 4720, 3465, 2520, 6217, 9475, -1, 8032, 1527, -1, 9618, -1,
+    -1, -1, 6838, 4456, 3885, -1, -1, 3734, 5848, 6639, -1, 947, 3444, 3281, 5027, -1,
+    5527, -1, 3727, 8198, 7745, -1, -1, -1, -1, 3651, -1, -1, -1, -1, -1, -1,
+    -1, 3733, -1, -1, -1, -1, 1121, 3774, -1, 4612, 1463, 6646, 4002, 7441, 6770, 7567,
+    2539, 6847, 7911, 3254, 6168, 9120, -1, 6895, 1856, 5492, 7771, -1, -1, 2124, 3544, 414,
+    3409, 4122, 2737, 7170, 9612, 9655, -1, -1, -1, 8141, -1, 9092, 8624, 8901, 5566, 3123,
+    8663, 9374, 9680, -1, 5631, 7726, 6568, -1, -1, -1, -1, 2257, 699, 889, -1, -1,
+    8396, 875, -1, 2898, 4801, 5592, 7163, 4670, -1, 3711, -1, 5388, -1, -1, -1, -1,
+    -1, 537, -1, 1278, 4789, 205, 7816, 9414, 3644, -1, 2598, -1, -1, -1, 3136, 4880,
+    9118, 9039, -1, -1, -1, -1, 555, 2175, 2242, -1, -1, -1, 4537, -1, 4949, 464,
+    -1, -1, -1, -1, 7494, -1, -1, -1, -1, 4329, 4519, -1, 4090, -1, -1, 7618,
+    8605, -1, 3485, 7383, 8764, 620, -1, -1, -1, -1, 59, 4273, 9355, -1, -1, -1,
+    1996, 3626, 4944, 7304, 4587, 7429, -1, 5040, 5220, 7556, -1, -1, -1, -1, -1, 3615,
+    5853, 6183, 4137, -1, -1, 5849, -1, -1, 3162, 8224, -1, 6785, -1, -1, 74, -1,
+    -1, -1, 4889, 3194, 4009, -1, -1, 1660, 1247, 3766, 7398, 8080, 6576, 3329, 8176, -1,
+    -1, -1, 6376, -1, 898, 1010, 2877, 2427, 3806, 5771, 1844, 6734, 6765, -1, -1, 2875,
+    3824, 7327, 8136, 8290, 8682, 9014, 557, -1, -1, 7375, 7058, -1, -1, -1, 7904, 7027,
+    1597, 8611, 3645, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6365,
+    -1, -1, -1, -1, -1, -1, 4315, 5770, 3858, 8999, 4432, -1, -1, 6459, 516, -1,
+    -1, 8400, 8479, 3025, 6085, 6113, 7910, 8599, -1, 1324, 8480, -1, -1, -1, -1, 21,
+    -1, 4162, -1, -1, -1, 6885, -1, 8542, 1519, 6097, 8036, 3522, 8363, -1, 8074, 4910,
+    8497, -1, -1, -1, 5069, 6883, -1, -1, 2828, 6324, 6369, 7251, 2247, 9526, -1, -1,
+    -1, -1, 69, 774, 2063, 1612, 3228, 8154, 3573, 5961, 8238, 9270, -1, -1, 3889, 418,
+    3008, 8389, 2147, 1460, 8478, 8392, 237, 3255, 7727, 9021, -1, -1, 5497, 2541, 2061, 434,
+    7844, 1055, 7075, -1, 9299, -1, -1, 5059, -1, -1, 2967, 6562, 8324, 8415, 8664, -1,
+    6242, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    389, -1, -1, 5198, 5457, -1, 42, 1139, 7410, 5830, 471, 9426, 3386, 8540, 2331, 2449,
+    3435, 3169, 9580, 4283, -1, -1, -1, -1, -1, 1880, -1, 3740, -1, -1, 4430, 8530,
+    -1, 2935, 4375, 6409, 6969, -1, -1, 1799, -1, -1, 1955, -1, -1, -1, -1, 8955,
+    1470, 5056, -1, -1, -1, -1, 536, -1, -1, 6029, 2048, 3276, -1, -1, -1, 7192,
+    5554, -1, -1, 6364, 8846, -1, -1, -1, 4516, 1728, 1836, 6987, 5426, 5358, 9360, -1,
+    -1, 5679, -1, -1, -1, 5160, 7927, -1, 659, -1, -1, 489, 5356, 6453, 1392, 704,
+    895, 6469, 5636, -1, 860, -1, 5071, 4772, 5873, -1, 3147, -1, -1, -1, -1, -1,
+    -1, -1, -1, 6853, 8309, -1, -1, -1, 9610, 1980, 1885, -1, -1, -1, -1, 5431,
+    813, 4885, 5247, 6578, -1, -1, 403, 2894, 4110, 4828, 9086, -1, 709, 438, 2517, 9256,
+    -1, 5153, -1, -1, -1, -1, -1, -1, 2644, -1, 6968, 9556, -1, -1, -1, -1,
+    -1, -1, 9521, -1, -1, 2908, 3477, -1, -1, -1, 7682, 1411, 1551, 7697, 6442, 2594,
+    7039, 829, 7859, 3638, 9528, -1, 974, -1, 3237, 1871, 2718, 9336, 1373, -1, -1, 170,
+    3731, -1, -1, -1, 9204, -1, 6591, 2944, -1, 5904, 7007, 7167, 8533, 9224, 6860, -1,
+    6630, -1, 5062, -1, -1, 2917, 2560, 4898, 1957, -1, 4978, -1, 5632, 7223, -1, 9359,
+    3428, 8548, -1, 2465, -1, 6434, -1, 906, 2145, 4201, 1759, 3400, 9584, 3071, 4235, 6894,
+    -1, 7591, -1, -1, -1, -1, 8911, -1, 2412, 8974, -1, -1, -1, -1, -1, 9257,
+    -1, 7091, -1, -1, 8613, -1, -1, -1, -1, 9493, -1, -1, 5726, -1, -1, -1,
+    8099, -1, -1, 1838, -1, 2997, 7702, 8466, 3238, -1, 8833, 4532, -1, -1, -1, -1,
+    -1, -1, 7321, -1, -1, -1, -1, 7881, -1, -1, -1, 2726, -1, 5093, -1, -1,
+    -1, 4488, -1, 5324, 9289, 2919, -1, 2490, 6661, 7111, 7431, 7962, 88, -1, 7096, 3805,
+    5045, -1, -1, -1, -1, -1, 3318, 5076, 4560, -1, -1, -1, -1, -1, 7707, 6314,
+    9094, -1, -1, -1, 6815, 158, 7289, 1685, 1425, 5166, 7825, 3574, 5794, 8356, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 7055, 1732, 4260, 994, 7797, 5929, 1710, 3770,
+    -1, -1, -1, 2974, 3954, 2397, 6209, -1, -1, -1, 5050, 309, 3637, 4831, -1, -1,
+    -1, -1, 215, 9595, -1, -1, 6989, -1, -1, 6744, -1, 9656, -1, -1, 2339, -1,
+    2802, 9057, 3295, 907, 1575, 5197, 2942, 9596, 3955, -1, 6092, 5724, 1246, 6706, 8920, 2161,
+    8929, 9200, -1, -1, 5103, -1, -1, 5704, 6180, 6629, -1, -1, -1, 347, 6241, 3690,
+    7836, 7925, 8991, -1, 1307, -1, 5503, 2957, -1, 2948, 3703, -1, -1, 2166, 6827, 7089,
+    7134, 5224, 6005, 360, 935, 4151, 5049, 2914, 3989, 4914, 6852, 7187, 8125, 8885, 5493, 1920,
+    5598, 1811, 2600, 6743, 5858, 3277, 7113, 4270, 7384, 7685, 7459, 7805, 8518, 6371, 9034, 9095,
+    1532, 9187, 9205, -1, 6508, -1, -1, 781, -1, 3900, -1, -1, -1, -1, -1, -1,
+    -1, -1, 881, 2709, -1, -1, -1, 854, 4713, 8209, 3949, 7666, 2652, 8903, 6018, 2421,
+    7362, 2559, 2811, 8703, -1, 305, 2510, 2640, -1, -1, -1, -1, 4746, 4234, 7695, 4476,
+    -1, 531, 596, 2616, 3364, 3431, 4804, 2580, 4896, 6239, 1679, 7285, 3668, 7857, 598, 1092,
+    5401, -1, 3960, -1, 4966, 9019, -1, -1, -1, 3502, -1, 7985, 5886, 7520, 8780, -1,
+    -1, -1, -1, -1, 7924, -1, -1, -1, 2971, 1420, 4406, -1, 874, -1, 8654, -1,
+    -1, -1, 7762, -1, -1, -1, 3647, -1, -1, 956, 1804, 5653, -1, -1, -1, 5407,
+    8193, 9587, 1535, 5812, -1, 3594, -1, 1174, 1181, 9494, 9662, -1, -1, 8815, -1, -1,
+    -1, 6967, 7093, -1, 4668, -1, -1, -1, 4952, 3987, -1, -1, -1, -1, -1, -1,
+    -1, -1, 4180, 9188, 2810, 9403, -1, -1, 6260, -1, 2359, -1, -1, -1, -1, 2558,
+    -1, 2909, 2970, 3976, 4150, 5102, 3607, 5835, 8025, -1, -1, -1, -1, -1, 8084, -1,
+    -1, 6204, -1, 6581, 7623, 3039, -1, 1782, 2001, 9638, -1, 2821, -1, 1513, -1, 2779,
+    5626, 4347, 3013, 8029, 6428, 7611, 8288, 6359, 9228, 9165, -1, -1, 5286, 5406, 4545, 3556,
+    5747, -1, 6274, -1, -1, 8695, -1, -1, 6257, 6857, -1, 6543, 2092, -1, -1, -1,
+    -1, -1, 398, -1, 556, 770, -1, -1, 2469, -1, -1, -1, 5916, -1, 798, -1,
+    -1, 7030, 1618, 7724, 8118, 8528, -1, 3146, -1, -1, 7273, -1, 1012, -1, 1499, -1,
+    1049, 4968, 919, 3902, 6764, 9260, 5445, 3371, 9435, 1567, -1, -1, -1, 7302, 3575, 352,
+    1887, 4990, 2069, 5043, -1, 64, 3817, -1, -1, -1, 6735, -1, 3552, 8071, -1, -1,
+    3977, 930, 5342, 7282, -1, 3687, -1, -1, -1, 2868, 1323, 6238, -1, 5048, 1385, 3629,
+    8798, -1, 1663, -1, -1, -1, -1, -1, -1, 8642, -1, -1, -1, -1, 1813, 2415,
+    1555, 4504, 9476, -1, -1, -1, 1744, -1, -1, 922, 5199, -1, 8391, -1, -1, 6109,
+    2602, 6284, 979, 6621, 927, 1977, 2492, 1447, 3560, 3698, 3879, 5634, 1294, 8217, 8995, 969,
+    -1, -1, -1, -1, 8618, -1, -1, -1, 6813, 2081, 3173, 8390, -1, -1, -1, 9262,
+    -1, 9538, 3794, 1571, 7180, 4866, 2628, 5075, 298, 3850, 2337, 32, 4031, 4294, 8883, -1,
+    4415, -1, 2184, 4950, 6307, 399, 9125, 2638, 7629, -1, -1, -1, -1, -1, 135, 3105,
+    8207, -1, 2474, 9646, 631, 7964, -1, -1, 7135, -1, 130, 4152, 5655, 4389, 5699, 5620,
+    5810, 6724, 8116, 1421, 8311, 690, 888, -1, 1526, -1, 9388, 3998, 4176, 4627, 7743, 6755,
+    -1, -1, -1, 9620, -1, 5371, -1, 2475, 7997, -1, -1, -1, 1556, 7442, 8351, -1,
+    6912, 3634, 7711, -1, 1132, 1178, 3426, 1604, -1, -1, 3267, 5987, -1, -1, -1, -1,
+    4166, -1, 1099, -1, 8005, 4528, -1, 4975, 7961, -1, 1151, 1719, 3796, -1, -1, -1,
+    7064, 9211, 7354, -1, -1, -1, 2710, -1, -1, 189, 1379, -1, -1, -1, -1, -1,
+    -1, -1, -1, 2646, -1, -1, 466, -1, 4102, -1, 976, 2826, 5836, 2425, 6148, 6574,
+    3064, 5126, 2962, 240, 2357, 7123, -1, -1, 3642, 8509, 5154, 4569, 9217, 2151, -1, -1,
+    -1, -1, -1, -1, -1, 7449, -1, 5629, -1, 2168, 2288, 492, 3357, 4953, -1, 7011,
+    4291, 7309, 2148, 7551, 9456, 7938, 5064, 8549, 9481, -1, -1, -1, -1, -1, 3319, 4832,
+    6925, -1, 3483, -1, 5217, -1, 4756, 3225, 6390, 3621, 8131, -1, -1, 5786, 4404, -1,
+    7628, 153, 7690, -1, -1, -1, -1, -1, 1516, 5744, -1, 669, -1, 799, 5837, 5412,
+    7179, 8725, -1, -1, 5730, 8305, 3391, 4279, 1004, 9000, 8052, -1, -1, 6202, -1, -1,
+    43, 9579, -1, 1932, -1, 6720, 4699, -1, -1, -1, -1, -1, 6761, 8622, 6545, -1,
+    -1, 9035, 505, 2345, 5517, 4690, 2101, 1310, 4205, 4285, 2757, 1637, 3048, 4809, 3699, 5087,
+    5833, 6714, 6799, 1508, 7032, 7511, 5700, 7671, 809, 7776, 8299, 9344, 7232, 5054, 7468, 7673,
+    2881, -1, -1, 7872, 270, 2262, 2022, 3507, 3479, 5894, 6401, 5889, 7598, 7841, 8853, -1,
+    183, 630, 2524, 3577, 9261, -1, -1, -1, -1, -1, -1, -1, 9073, -1, -1, -1,
+    1655, 2323, 6137, 2026, 9168, -1, 937, 3372, 7932, 7674, 6881, 9255, 769, 9417, -1, -1,
+    5697, 7751, -1, -1, 254, -1, -1, 713, -1, -1, 8143, 2889, -1, 4486, -1, -1,
+    2364, 100, 8039, -1, -1, -1, 4991, -1, -1, -1, -1, -1, 5635, 8939, -1, 9123,
+    2329, 5514, 6598, 3345, 2625, -1, -1, 3124, 8907, -1, 1213, 8822, -1, -1, -1, 1643,
+    -1, -1, 721, 4662, -1, 8790, 4542, 8399, -1, -1, 7505, 2562, 5147, 5298, 8215, -1,
+    -1, -1, -1, 1397, 9056, 9081, -1, -1, -1, 5063, -1, 3763, 7799, -1, -1, 8500,
+    -1, 8581, -1, -1, 5500, -1, -1, 5430, -1, 1164, 6529, 8836, 6839, 811, -1, -1,
+    5936, 4526, 9559, 9357, 4108, 6682, -1, -1, 3956, -1, 2235, -1, -1, 122, 768, 8796,
+    5164, 1736, 9134, 9448, 8092, -1, -1, -1, -1, 255, 419, 3735, 6116, 7203, 5202, 4585,
+    8657, 8967, -1, -1, -1, -1, 1084, 6425, -1, 6667, 6328, 863, -1, -1, -1, 8434,
+    5052, 6296, -1, -1, 7415, -1, 7390, -1, -1, -1, 539, -1, 4771, 8820, 5433, -1,
+    7791, -1, 543, 5883, 672, 1109, 1602, 6802, 7853, 8591, 341, 4959, 569, 1180, -1, -1,
+    -1, -1, -1, 13, -1, 8354, -1, -1, -1, -1, -1, -1, 5585, 5762, 1951, 9155,
+    424, -1, -1, -1, -1, -1, 6298, 6589, 266, 3782, -1, -1, 209, 960, 6489, 951,
+    7081, -1, -1, -1, -1, 5130, 8639, 6214, 2704, -1, 1106, 1430, -1, -1, 7621, -1,
+    2295, -1, -1, -1, -1, -1, 6101, -1, 7884, -1, -1, -1, -1, 9069, 1282, 4945,
+    -1, 2682, 9400, -1, 4394, -1, 3511, -1, 2376, 2817, 3423, 4368, 4666, 8566, 9566, -1,
+    855, -1, -1, 1412, -1, -1, 5299, -1, -1, -1, 4093, 7641, -1, -1, 5557, -1,
+    2573, 2848, -1, 3775, 175, 3975, 5872, -1, -1, 9178, 6664, 5306, 8307, -1, 3606, 2838,
+    4227, 627, 1852, 5590, 6067, 9353, -1, -1, -1, -1, -1, -1, 641, -1, -1, -1,
+    -1, -1, -1, 5535, 1713, 3833, 4758, -1, -1, 2654, 1648, -1, 214, 1257, 9103, 6220,
+    9192, -1, -1, -1, 2178, -1, -1, 8427, 4610, -1, -1, -1, -1, 9158, 2501, 4663,
+    6125, 8296, 8397, 2697, 3280, 1709, 2860, 4085, 4385, 7196, 8772, 7975, 8937, 3826, -1, 3080,
+    5095, 6665, 6686, -1, 6377, 2448, 5279, 4724, 8945, 5251, 9234, 3487, -1, 4799, 6008, 7667,
+    7564, -1, 3661, 8175, 3583, 8246, 5001, 8670, 6854, -1, -1, -1, -1, -1, 2011, -1,
+    9621, 1415, -1, -1, 9491, 9122, -1, 166, 2017, 2462, 7900, 3892, 6971, -1, -1, 2080,
+    -1, -1, -1, 5080, -1, 3646, -1, 5226, -1, 8769, 3198, 176, 4032, 1058, 4721, 5713,
+    7756, 9375, 1749, 9429, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6690, 9371,
+    -1, -1, 1981, -1, -1, -1, 7264, -1, -1, -1, -1, -1, 3313, 5472, 9544, -1,
+    -1, -1, -1, 4715, -1, -1, -1, 763, 2614, 3861, -1, -1, -1, -1, 6904, -1,
+    2796, -1, -1, 1841, 975, 9258, -1, -1, 2025, -1, 425, 6228, 5555, 3677, 4798, 463,
+    8710, 9536, 9551, -1, -1, 8422, 4198, -1, -1, -1, -1, 5761, 8522, -1, -1, 8058,
+    -1, -1, -1, -1, 4509, -1, -1, -1, -1, -1, 6355, -1, -1, -1, -1, 2264,
+    5316, -1, -1, 1529, 2687, 2589, 4993, -1, -1, -1, 4605, -1, 5408, 1537, -1, 4725,
+    2380, -1, 4865, 149, 4765, 5460, 5976, 949, 146, 4269, 4257, 673, 9037, -1, -1, 3678,
+    -1, -1, 2039, -1, -1, 6043, -1, 1232, -1, -1, 5157, 6505, 6859, 1148, 4942, 4802,
+    -1, 7933, 9386, -1, -1, 495, -1, 623, -1, -1, 3937, 560, 4325, 4523, -1, 1865,
+    5743, 7160, 9133, 5686, 8788, -1, 1862, -1, 9062, -1, 6171, 2093, 2990, 7681, 4779, 3728,
+    -1, -1, -1, 9440, -1, 1334, 2274, 3489, 4268, 3772, 1378, 4351, 4579, 1520, 7225, 7635,
+    227, 9594, -1, -1, 8436, -1, -1, -1, -1, 481, -1, -1, -1, -1, -1, -1,
+    4146, 5804, 6896, 7780, -1, 6129, 2954, 2907, 4388, 3881, -1, 7438, -1, 2314, 4089, 4209,
+    -1, 4951, -1, 3539, -1, 3170, 9420, -1, 4607, 271, 6341, -1, 518, 1558, 4070, 4451,
+    2904, 7217, 7834, 864, 8547, 9044, 2020, -1, -1, 571, -1, 1127, -1, 2728, 4191, 3063,
+    -1, 3264, 9418, -1, -1, 3193, 6483, 1320, 778, 8320, 4487, 3245, 6974, -1, -1, -1,
+    -1, 1269, -1, 584, 2792, 3057, 6603, 9433, -1, 2824, -1, -1, -1, -1, 4320, 8055,
+    8015, -1, 5307, 9156, -1, -1, 4661, 2940, 4586, 2653, 3870, 6933, 8266, 1990, -1, -1,
+    -1, -1, 1160, -1, -1, -1, 8700, 9489, -1, 1992, -1, 3498, -1, 561, -1, 5121,
+    -1, -1, -1, 4056, 1657, -1, 7534, 793, 3671, 221, 7481, 8778, 4629, 2804, 5595, 7392,
+    9446, -1, -1, -1, -1, 3982, -1, -1, -1, 3908, -1, -1, -1, -1, 6304, 73,
+    2163, 2886, 91, 1002, 3090, 3967, 8784, 3588, 9563, -1, -1, -1, -1, -1, -1, -1,
+    -1, 3799, 5094, 6828, 6879, 6941, -1, 1146, 5415, 6236, 5422, 1642, 1956, 5534, 8718, 2399,
+    -1, -1, -1, 1583, -1, 2861, -1, -1, 1382, 3590, 8374, 9279, 8317, 6299, -1, -1,
+    -1, 4249, -1, 5028, 5967, -1, 1330, 4514, 3439, 1671, 5399, 6192, 8405, 3418, -1, 6447,
+    1264, 6208, 945, 2577, 9315, -1, -1, -1, 1656, 1390, 7419, -1, 3269, 4591, 6081, 6836,
+    5993, 4333, 2301, 357, 1202, 4057, 4103, 7842, 723, 1853, 5719, 3790, 1050, 9396, 9401, -1,
+    -1, -1, 4222, -1, 3368, -1, -1, -1, -1, 9356, -1, -1, 8019, 8644, -1, -1,
+    -1, -1, -1, -1, -1, -1, 1072, 222, 3863, 3206, 1301, 2735, 5521, -1, -1, -1,
+    -1, -1, 4013, -1, -1, -1, -1, -1, -1, -1, -1, 2249, 5396, 6916, 6979, 2853,
+    6479, -1, 9298, 144, 8220, 5885, 1716, 8491, 8953, 9020, -1, -1, 1228, 7348, -1, -1,
+    -1, 1861, 4219, 4474, 5672, 7012, -1, -1, 4244, -1, -1, 5235, 6970, 7130, -1, 4369,
+    8114, 8477, -1, 1797, -1, -1, 4536, 409, 7645, -1, 2631, 5709, -1, -1, -1, -1,
+    5006, 5290, 515, 8134, 6903, -1, -1, 1434, 4550, 2159, 617, 4681, 2358, 8511, 2780, 4515,
+    9363, -1, 2668, 5553, 4022, -1, 954, -1, -1, -1, -1, 6163, -1, -1, -1, -1,
+    1638, -1, -1, 1647, 1699, 3506, 1908, 8773, -1, -1, -1, 2569, -1, -1, -1, -1,
+    6751, 8278, 210, 3019, 1979, 9623, 18, -1, -1, -1, -1, -1, 4164, -1, -1, 8558,
+    9259, 339, 6210, 9583, 4014, -1, -1, -1, -1, 2382, 486, 4906, -1, -1, -1, -1,
+    -1, -1, -1, 6550, 4961, -1, 2798, 5231, 5701, 760, 2066, 9015, -1, 8219, -1, 6593,
+    -1, 2254, 4289, -1, -1, -1, -1, -1, -1, 9050, 2519, -1, -1, 1557, 6822, -1,
+    3541, 2669, -1, 2959, 5927, -1, 1603, 3370, 545, 5870, 7699, -1, -1, -1, 577, 5211,
+    9598, 5974, 8848, -1, -1, 7723, -1, -1, 3360, -1, 9539, 8536, -1, -1, 2304, 8094,
+    1831, 9001, 4100, -1, -1, -1, -1, -1, -1, 4584, 7174, 5350, 2639, 9637, 9685, -1,
+    1475, 6317, 7000, 7642, 8461, 8935, -1, -1, -1, -1, 2366, -1, 3882, 920, 677, 1834,
+    4319, 5284, 5124, -1, -1, -1, 27, 3139, 966, 2165, -1, -1, 1674, -1, 1533, 6059,
+    8178, -1, 9110, 5449, 6139, 1803, 8232, 9537, -1, -1, -1, -1, -1, 6672, 910, -1,
+    3748, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3597, 1518, 8216, 4381, 2934, 1905,
+    8508, 2905, -1, 4506, 728, 5693, -1, -1, 286, -1, -1, 1432, -1, 7540, 7916, -1,
+    -1, -1, -1, 1316, 5494, -1, -1, 8467, -1, -1, -1, 3586, 56, 7325, 7469, -1,
+    -1, 2567, -1, -1, 7418, 2327, 7740, 9207, 3262, 5393, -1, 9561, -1, 5807, 6934, 7708,
+    6337, -1, 894, 3322, 6430, -1, -1, -1, -1, -1, 3946, 4101, 6678, 8685, 6103, 3328,
+    5721, 31, 8982, -1, -1, 1763, 5542, -1, -1, -1, 381, 722, 125, 7397, 8662, -1,
+    -1, -1, 5751, 7261, -1, -1, -1, 6253, 1613, -1, -1, -1, -1, -1, 5670, -1,
+    -1, -1, 5627, -1, -1, -1, 7679, 1614, 4468, 6927, 6266, 7162, 8167, 3287, 8406, 9351,
+    5619, 5168, 3798, 9558, -1, 7686, 268, 2938, 4229, 6245, -1, 653, 5727, 7255, -1, -1,
+    -1, -1, -1, -1, -1, -1, 7547, -1, 6184, -1, 3851, -1, -1, -1, 24, 4835,
+    1245, 716, 3640, 7529, 2556, 4686, -1, -1, 9348, 4555, 4620, 6696, -1, -1, -1, -1,
+    625, -1, -1, 8376, 4264, 7796, 5764, 982, 3911, 6471, 6570, 9505, 4039, 5283, 7126, 2982,
+    -1, -1, -1, 192, 1967, 3379, 3714, 5009, 6041, 6861, -1, -1, -1, 8206, -1, -1,
+    -1, -1, 1859, 8044, 9507, -1, -1, -1, -1, -1, -1, 2015, 3332, 484, 8150, 2941,
+    -1, 1404, 4226, 6410, 7820, 3259, 8724, 9469, 1233, -1, -1, -1, 6488, -1, 9209, -1,
+    1325, 8119, -1, -1, -1, -1, 3233, 5417, 8650, 6252, 5398, 8794, -1, 7182, 7222, 7871,
+    3723, 4335, 1562, 1248, 4752, 6176, 7164, 2977, -1, 7848, 934, -1, -1, 2190, -1, 2406,
+    2116, 5282, 5844, 35, 7631, -1, 7445, 4969, 1778, 3528, 2927, 5667, -1, -1, 6431, 8300,
+    5133, 8486, -1, -1, 9578, -1, 7873, 4295, 1422, 2976, 2383, 253, 2433, -1, -1, -1,
+    7530, 7323, -1, -1, -1, 2939, -1, 2233, -1, 752, 3220, 435, 8987, -1, 772, 4338,
+    5451, 300, 2966, 4448, 5228, 2745, 3205, 7437, 7840, 567, 8214, 8287, 9534, -1, -1, -1,
+    -1, 7082, -1, -1, -1, -1, 8556, -1, 1355, 9586, 7865, -1, 6478, 4763, -1, -1,
+    -1, -1, 8754, -1, 3973, 6793, -1, 203, 3059, 6693, -1, 9046, 8472, -1, -1, -1,
+    -1, -1, -1, 3561, -1, 525, 8813, -1, -1, -1, -1, -1, -1, -1, -1, 4106,
+    5319, -1, -1, 8873, -1, 2672, -1, 3970, 4300, -1, -1, 5446, 3242, 5410, -1, 7387,
+    -1, 902, 8910, -1, 3500, -1, -1, -1, 387, 7694, 8274, -1, 1348, 3612, 7099, 4188,
+    783, 4657, -1, 8524, 8571, 4497, 8688, -1, 250, 383, 4011, 4567, 7617, -1, -1, -1,
+    -1, -1, 8829, 2222, 2426, 1549, 924, 6869, 3324, -1, -1, 1223, 5123, 9677, 3622, 3786,
+    1599, 1374, -1, -1, -1, 3151, 2584, -1, -1, -1, 2836, -1, -1, -1, 3455, -1,
+    -1, -1, 2693, -1, 2075, 3172, 54, 6036, -1, -1, -1, 89, 6507, 9324, -1, 181,
+    6558, 4650, -1, 985, -1, -1, -1, -1, -1, -1, -1, 9497, -1, -1, 1776, 4228,
+    5536, 9329, -1, -1, -1, -1, -1, 5970, -1, -1, -1, -1, 1143, 8832, 1894, -1,
+    187, 3969, 5188, 2355, 5931, 5038, 7793, 340, 1495, 3519, 7367, 1539, 4380, 7922, 8462, 8627,
+    8355, -1, -1, -1, -1, 6354, -1, 565, -1, -1, -1, -1, 7328, -1, 6718, -1,
+    -1, -1, 5232, -1, -1, 5597, -1, 3126, 8455, -1, 3034, 2981, 3499, 6642, 5010, -1,
+    -1, 4580, 7862, -1, -1, -1, -1, -1, -1, -1, 1177, 2499, 2007, 78, 1649, 1857,
+    4541, 1617, 4202, 671, 6070, 6963, 8855, -1, 5777, -1, 80, 5550, -1, -1, 522, -1,
+    2197, -1, -1, -1, -1, 7414, 4676, -1, 5167, 2994, 3753, 8444, -1, -1, 2572, -1,
+    -1, -1, 2082, 4361, 7121, 8850, 3110, 9172, 3186, 7454, 9591, -1, 3215, -1, -1, -1,
+    6326, 8261, -1, 9312, -1, -1, -1, -1, -1, 307, 5215, 2472, 2267, 5501, 5630, 5732,
+    6474, 4937, 5439, 6891, -1, -1, 2827, 7486, 167, 6290, -1, -1, -1, 9641, -1, 4261,
+    5091, -1, 7527, -1, -1, 4452, -1, 7154, 147, 5416, 6327, 7252, 7315, 2527, 5808, -1,
+    9634, 607, -1, 7025, 8914, 3213, -1, -1, -1, -1, 4954, -1, -1, 2797, 7035, 775,
+    -1, -1, -1, -1, -1, -1, -1, 4926, -1, -1, -1, 2805, 869, 4596, -1, -1,
+    410, 1394, 8704, -1, -1, 3219, 4775, 2929, 6862, 6947, 23, -1, -1, 2695, -1, 3046,
+    119, 5971, 1298, 1965, 2613, 4129, 3113, 3762, 5664, 7758, -1, 2857, 587, -1, -1, -1,
+    9144, -1, 2667, 9146, -1, 5518, 1201, 1189, 3720, 5458, 7141, 8078, 8331, 9627, 626, -1,
+    -1, -1, 8507, 5714, -1, -1, -1, 4215, -1, 9297, 2936, 6219, 7471, -1, -1, -1,
+    -1, -1, 6959, 852, 3984, -1, 4566, -1, 5112, 9236, -1, -1, -1, -1, 9210, 1337,
+    2238, 6388, 8038, 4382, -1, 4021, -1, 3811, 7588, 6353, 8228, 7757, 8017, 4543, -1, 667,
+    3837, 5489, -1, -1, 8952, 4373, -1, 1401, 1751, 5441, 1867, 7150, 7452, 3696, 9018, -1,
+    3543, -1, 5273, -1, -1, -1, 1652, 8924, -1, -1, 275, 733, 5380, -1, 310, -1,
+    -1, 1845, -1, -1, -1, -1, 3336, -1, 4322, 8713, -1, -1, 9032, 2825, -1, 5122,
+    8279, 3609, 6610, 1222, 4489, 9254, 9376, -1, -1, -1, -1, -1, 4855, -1, 9499, -1,
+    432, 3446, -1, -1, 8023, 2432, -1, -1, 9135, -1, -1, -1, 5734, 1005, -1, -1,
+    -1, -1, -1, -1, 2183, -1, 977, 3503, -1, 5269, -1, -1, 8474, -1, -1, 3739,
+    -1, -1, -1, 2347, 1545, 2094, -1, -1, 1943, -1, -1, 8218, 8998, -1, -1, -1,
+    -1, -1, -1, 1485, 3572, -1, -1, 4079, 4642, 7311, -1, -1, -1, -1, -1, -1,
+    3035, 3429, -1, 8586, -1, -1, 7860, -1, 7475, -1, 248, 3627, -1, -1, 2658, 3158,
+    3871, 7653, 9495, -1, 5409, -1, -1, 7394, -1, 6191, 6463, -1, 208, 9063, -1, -1,
+    -1, -1, -1, -1, -1, -1, 1952, -1, -1, 156, 7908, 7608, -1, 3845, 3757, -1,
+    -1, 8483, 6169, 1665, 5136, 6596, 612, 2699, -1, 496, 5276, 6082, -1, -1, -1, 395,
+    5025, 2136, 2809, 5387, 6212, 6448, 547, 5278, 8661, 6663, 8816, -1, 3888, 5385, 9059, -1,
+    6432, 824, -1, 9513, 3103, 7963, 7107, -1, -1, 5731, -1, -1, -1, 3047, 3337, -1,
+    -1, 5618, -1, -1, 1795, 8898, 1568, 5285, 6120, -1, -1, -1, 2808, -1, -1, -1,
+    710, 450, 37, 4919, 5096, -1, -1, 2563, 6011, 6044, -1, 66, 173, -1, 601, 2689,
+    3390, -1, -1, 9678, -1, -1, -1, 4220, 6516, -1, -1, -1, -1, 8248, -1, 6261,
+    -1, 1319, 9593, -1, 98, -1, 338, 692, 2125, 282, 408, 6643, -1, 4960, -1, 6997,
+    5733, -1, 6942, 6617, 2915, 8027, -1, -1, 3385, -1, -1, 1371, 4908, 3749, 6655, -1,
+    3234, -1, 4920, 1271, 9661, -1, -1, -1, -1, 1263, 9215, 2424, 2847, 1573, 4460, 766,
+    4979, 7896, 8834, -1, 753, -1, -1, -1, -1, -1, -1, -1, 4114, -1, -1, 588,
+    -1, 247, -1, -1, 3820, -1, -1, 6088, 7020, -1, 8921, 48, -1, 8649, 681, -1,
+    4240, 200, -1, -1, -1, -1, -1, 6722, 5106, -1, -1, -1, 5466, -1, 8291, 8597,
+    5219, -1, 7281, 1468, 2730, 3361, 4794, 6145, 4995, -1, 901, -1, -1, 1167, 3031, 9061,
+    -1, 3316, -1, 3653, 6984, 8706, 7119, -1, -1, -1, 4712, 8161, 3049, 9160, -1, 5128,
+    6305, 4480, 5481, 6193, 938, 1270, 5146, 892, 8621, 6964, 5765, 6571, 1757, 6010, 8913, 1326,
+    8950, 8428, 1046, -1, 4653, 4980, 6871, 9114, -1, 8301, 5447, -1, 5908, 5651, 8681, -1,
+    -1, -1, -1, -1, -1, -1, 2230, 4352, 678, 5159, 9294, 9461, 9564, 1190, 2703, 2016,
+    3980, 2223, 4904, 5288, 4390, 6282, -1, -1, 3750, 8418, 154, 1615, 6717, 5825, 4207, 7902,
+    8121, -1, 4518, -1, -1, 5882, -1, 6737, 6310, -1, 4153, -1, -1, 5567, 7070, 6787,
+    8722, -1, 972, -1, -1, -1, -1, -1, 3732, 964, -1, 52, 3992, 9530, 5496, 5603,
+    -1, 4649, -1, -1, 730, -1, 6834, -1, -1, -1, -1, 1170, 2466, 7795, 7594, 9113,
+    1772, 2152, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3256, -1, -1, -1, -1,
+    -1, -1, 4705, -1, -1, 1531, 8189, -1, 7538, 4496, 3721, 5381, 4738, -1, -1, -1,
+    -1, 1791, 5505, 447, 2395, 8647, 9588, 7710, -1, -1, 4413, -1, -1, -1, 5899, -1,
+    -1, 9333, -1, -1, -1, -1, -1, -1, 5461, -1, 4643, 2417, 1327, 1494, 2691, 2922,
+    3593, -1, -1, 5918, 6462, 6237, 8108, -1, -1, -1, 592, 908, 3965, -1, 6215, -1,
+    -1, -1, -1, -1, -1, 1486, -1, 3248, 4679, 8323, 7457, -1, 4563, 3818, -1, -1,
+    3393, 4173, 6613, 7102, 2158, 1250, 5953, 4221, 375, 7729, 4503, 8152, 8762, 1458, 5240, 4398,
+    6187, 3963, 7352, -1, -1, 3296, 2688, 6273, 7077, -1, -1, -1, 4292, -1, 8606, 1107,
+    -1, -1, -1, 3738, -1, 8265, 3494, 7197, 3862, 4094, 1616, 3412, 6784, 7267, 1482, -1,
+    -1, -1, -1, 2192, 6791, 2932, 7300, 9519, 3791, 5625, -1, -1, -1, 8353, 9048, 2180,
+    -1, -1, -1, 2004, 5483, -1, 9077, 2416, 2470, 1768, 1584, 1582, 4135, 2509, 4391, 1014,
+    4976, 5185, 7737, 8716, -1, 785, 1437, -1, 3488, 2540, -1, -1, -1, -1, -1, 2050,
+    7767, 1251, 876, 5657, 5905, 2041, -1, -1, 6627, 4332, 4933, 7612, -1, -1, -1, 7019,
+    -1, -1, -1, -1, 6123, -1, -1, -1, -1, 99, 2902, -1, 3184, 2313, 7083, 8761,
+    1308, 1179, 585, 1462, 3183, 4059, 3005, 1850, 304, 4631, 7221, 7399, -1, 1761, 44, 1998,
+    5266, -1, -1, -1, -1, -1, 4797, 7260, 9464, -1, 1244, 2450, -1, 5660, 4428, -1,
+    3015, -1, -1, 5092, 2603, -1, 3376, 6106, 8759, 844, 1219, -1, -1, -1, -1, -1,
+    2129, 5897, 2209, 6445, -1, -1, 8742, 4688, -1, -1, -1, -1, -1, 199, 818, 172,
+    4493, 6091, 5108, 7388, 2754, 7455, 9058, -1, -1, -1, 8037, 5480, -1, 6914, 5464, -1,
+    -1, 501, 4367, 7713, -1, -1, -1, 6035, 9568, 4962, 8859, 8502, 4911, 1152, 4764, 4521,
+    -1, 2864, 1524, 6524, -1, -1, -1, -1, -1, -1, -1, 473, 5972, -1, -1, 6334,
+    2010, 3010, 3961, 6728, -1, 5104, 2014, -1, -1, -1, -1, -1, -1, -1, 2413, 8249,
+    -1, -1, -1, 374, -1, -1, -1, 7042, -1, -1, 5806, -1, -1, -1, 9197, -1,
+    -1, 4707, -1, -1, -1, -1, 3779, 8104, 1540, 4424, 8652, 7244, 2661, -1, -1, 5613,
+    -1, 3664, 6049, 9447, 1157, 1788, 6300, 7528, 8149, -1, -1, -1, -1, 9369, -1, -1,
+    -1, 6795, 4000, 4331, 6831, -1, 1521, -1, 77, 8551, -1, 3972, 3706, 1423, 4847, 7092,
+    7687, -1, -1, -1, 5716, -1, 6360, 6920, 9347, 2375, 1858, 3795, 2077, 7971, -1, -1,
+    9321, -1, 2447, -1, -1, -1, 9265, -1, -1, 9651, -1, -1, -1, -1, -1, 1141,
+    4750, 5264, 174, 3939, 476, 3072, 2410, 2315, 2890, 2456, 5067, 5456, 2040, 914, 5463, 6419,
+    3648, 6569, 7909, 7106, 4400, 4531, 6590, 6975, 8359, 4577, 5305, 71, 8545, 8738, 8800, 9518,
+    -1, 4092, -1, 6224, -1, 5034, -1, 4641, -1, 3516, 8201, -1, 401, 5507, 8669, 9600,
+    -1, -1, -1, -1, -1, 8181, 7216, -1, -1, -1, 9149, 5476, 5339, -1, -1, 198,
+    -1, 1606, -1, 5573, 1283, -1, 5687, -1, -1, 4851, -1, -1, 1601, -1, 4131, -1,
+    9409, -1, 353, -1, -1, -1, 7108, -1, -1, -1, -1, 1919, -1, -1, -1, 8658,
+    -1, 207, 3211, 3582, -1, -1, -1, -1, -1, -1, -1, -1, 740, 3208, 6953, -1,
+    -1, 3909, 4340, 4618, 3033, 5357, 5015, 5857, -1, -1, 9514, -1, 439, 9654, -1, 4925,
+    5717, -1, 3398, 4977, -1, 8140, 6618, -1, -1, -1, -1, 3478, 4619, 1543, 3378, 3959,
+    5558, 6347, 3081, 5978, 1309, 6405, 456, 1237, 6763, 7401, 3995, 7800, 8506, 633, 7543, 2996,
+    8857, 1003, 8817, 8925, -1, 777, 3688, -1, -1, -1, -1, -1, -1, 4343, 9276, -1,
+    1807, 2112, 5923, 9161, -1, -1, -1, -1, -1, 6185, 7895, -1, -1, 9515, -1, -1,
+    -1, -1, 6063, 8575, -1, -1, 784, -1, 3109, 4773, 6624, 1126, 2548, 8615, 8517, 8227,
+    -1, 178, 1509, -1, -1, -1, -1, -1, 1698, 5512, 2423, 2871, 6147, 6494, 2840, 4463,
+    8087, -1, -1, -1, -1, 1995, 2394, -1, -1, -1, -1, -1, 9387, -1, -1, 606,
+    826, 3769, -1, -1, -1, -1, 7680, -1, -1, 1351, 7202, -1, -1, 883, 5487, -1,
+    -1, -1, -1, -1, -1, -1, -1, 8938, 1752, 3545, 1287, 4873, 4443, 7813, 2043, 8770,
+    -1, -1, 4524, -1, 2678, -1, 1258, 321, 1688, 6404, 1828, 2055, 6993, 7968, 3209, 8912,
+    3655, 4304, 5544, 1184, 7787, 7819, 9589, 737, 6733, 5223, 3581, 8403, 3893, 9436, -1, -1,
+    127, -1, 5838, -1, -1, 5511, -1, 8766, -1, 2370, 95, -1, 9454, -1, 7502, 1068,
+    2794, 8009, 4573, -1, -1, 4973, 7473, -1, -1, 9101, -1, 2031, -1, -1, 344, -1,
+    -1, -1, -1, -1, 3673, 5515, -1, -1, -1, 5965, 724, 2963, 6628, 7849, 8042, 2782,
+    4064, 8972, 9466, -1, -1, 7084, 4414, 2952, 8981, 9274, -1, 1503, 8552, -1, 9365, -1,
+    5377, 7993, 8481, -1, -1, -1, -1, -1, -1, 3427, 2293, 2177, 3303, 3843, 8795, 9284,
+    9424, 2716, 7883, 4734, -1, 6907, 2205, -1, 5774, -1, -1, 6115, 4457, 6226, 9085, -1,
+    7882, -1, 1626, 3860, 9023, 9622, -1, -1, -1, 8145, 6301, -1, 6258, -1, -1, 2058,
+    4254, 3613, -1, 4062, 8546, -1, -1, 7189, 7305, 1610, 8442, -1, -1, 177, -1, -1,
+    -1, -1, -1, -1, -1, 5100, 485, 6040, -1, -1, -1, -1, 2023, 7792, 9269, 541,
+    6660, 9585, 3416, 3227, 6046, 1165, -1, 1664, 9332, -1, 4996, -1, -1, 5292, -1, 405,
+    8687, 497, 1207, 8417, 1062, 1288, 1687, 9087, 8748, -1, 1595, -1, -1, -1, -1, -1,
+    -1, 8139, -1, -1, -1, 2841, -1, -1, -1, -1, -1, 6502, 5129, -1, -1, -1,
+    1505, 9126, -1, 101, 3349, 3587, 5758, 2740, 6514, 2851, 2945, 3535, -1, 7056, 7878, -1,
+    3719, -1, -1, 8423, -1, 5562, -1, 2221, 3884, 9068, 2232, -1, 4714, 1628, 4755, -1,
+    -1, -1, 3438, -1, 5755, 3829, -1, 4935, 3564, 7657, 1450, -1, 3403, 2557, 2289, 1802,
+    8851, -1, 8180, -1, -1, 8739, -1, 583, 5621, -1, -1, -1, -1, -1, -1, -1,
+    5984, -1, -1, 2332, 5943, 8129, -1, 4988, -1, -1, 1389, 2037, 132, 3171, 5589, 7658,
+    4859, 8342, 9547, -1, -1, -1, -1, -1, 8797, 2858, -1, 6143, -1, 5322, 3028, 4034,
+    7649, -1, -1, 139, 9367, -1, 2626, 8031, -1, -1, 1825, -1, 6669, 4242, 5163, -1,
+    -1, 5127, 6766, 8117, 148, -1, -1, 4330, 6216, 517, 2056, 6866, 1546, 7018, 7188, 8667,
+    7132, 2964, 7858, 582, 4410, 6039, 2903, 9529, -1, 5991, 2111, 1765, 8262, 4117, 6017, -1,
+    6913, -1, 9546, 7492, 4395, 4967, -1, -1, -1, 1629, 605, 1074, 4118, 2259, 3240, 4359,
+    4648, 4857, -1, -1, 6572, -1, 1032, 7053, 2526, 6372, 9608, 573, 3553, -1, 1234, -1,
+    -1, -1, -1, -1, -1, -1, -1, 4232, 6515, 1670, 327, 1341, 9434, -1, -1, -1,
+    5980, 2330, -1, -1, -1, 5504, -1, 4197, -1, 1405, 1717, 3722, 5137, -1, -1, -1,
+    -1, -1, 939, 133, 1229, 2803, 6583, 6957, 8781, -1, 2280, -1, 2921, -1, -1, 7829,
+    7482, 2706, 8277, -1, 2632, 3404, 6054, 8532, 4730, 5715, 1873, 4377, 5685, 8385, 217, 508,
+    6536, 9471, 6811, 2783, -1, 1431, 4824, 2237, 3684, 6554, -1, 5869, -1, -1, 1042, 6373,
+    6250, 8559, -1, -1, -1, 658, -1, -1, -1, 6923, 8109, 6393, 103, 2108, 8294, -1,
+    -1, 1407, -1, -1, -1, -1, 102, 2064, 4087, 8619, 5174, 1363, -1, 4467, -1, 1673,
+    5419, -1, -1, -1, 6496, 5391, 8432, 9193, 1550, -1, 9281, 502, 1854, 3958, 4822, 9633,
+    8919, -1, -1, 8362, -1, -1, -1, 4387, 2633, 6534, 9076, 9432, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 4084, 3667, 6420, 5926, -1, 6796, 213, 4525, 5099, 4236, -1,
+    -1, 4050, 657, -1, 356, 1016, -1, 2969, -1, -1, -1, 7749, 2100, 4409, 61, 3536,
+    5414, 5516, 1011, 7054, 3421, 7735, 7759, 4494, 7960, 2418, 5529, 6348, 2324, 564, 3278, 6539,
+    8445, 8505, 8854, 4281, 9613, -1, 1000, 5826, 6573, 3701, -1, -1, -1, -1, 9358, -1,
+    8680, 5179, 6633, -1, -1, -1, -1, 8531, -1, -1, -1, 4626, -1, -1, 962, -1,
+    -1, -1, -1, -1, -1, -1, -1, 141, 3591, 4437, -1, -1, 4427, -1, 1154, 6374,
+    2396, 9619, -1, -1, -1, -1, -1, -1, -1, 2225, 7456, -1, -1, 7301, 9399, -1,
+    -1, -1, 4217, -1, -1, 4745, 7074, 3009, 4659, -1, -1, 2008, 3570, 5610, 8602, -1,
+    -1, 1609, 2495, 3916, 8225, -1, 2900, -1, 8960, -1, 3466, 5855, -1, 2109, 2201, 5986,
+    7139, -1, 4635, -1, -1, -1, -1, -1, -1, -1, 1060, 6771, 9124, 549, -1, 126,
+    2407, 2464, 7347, 2367, 8165, 2196, 5814, -1, 4376, 7558, 3309, 8348, -1, 5152, 7178, -1,
+    -1, -1, 8567, -1, 8969, -1, 2030, 2342, -1, 4061, 1627, 3930, 5101, -1, -1, 2876,
+    4805, 4113, 5394, 6803, 1534, 3598, 3043, 165, 2649, 3953, -1, 2019, 8990, 3921, 3091, 2561,
+    3348, 4231, 4751, 3894, 6503, 8057, -1, -1, -1, 2217, -1, 1183, -1, 1924, 1605, 96,
+    -1, 7582, 3660, 3014, 554, 8419, -1, 1591, 5252, 7072, 4272, 1267, 9361, 9472, -1, -1,
+    -1, -1, -1, 879, -1, -1, -1, -1, 3919, 6611, 6281, -1, 4077, 754, 1313, 2910,
+    -1, 9169, -1, -1, -1, -1, 6083, -1, 4529, 2411, -1, -1, -1, 335, 169, 4616,
+    905, 1396, 3002, 3191, 5061, 7385, 7753, 6349, 1274, 2146, 2542, 4694, 7949, 726, 8304, 961,
+    1646, 5243, 5996, 7294, 9631, 6566, -1, -1, -1, 2344, -1, -1, 1574, -1, -1, 8750,
+    9231, 5876, -1, 8047, 2723, 1471, -1, 918, 2748, -1, -1, -1, -1, 5622, -1, -1,
+    686, 3362, 5952, 9090, 3290, 1173, 3441, 2102, 1775, 4678, 6140, 4238, 4109, -1, 400, 2813,
+    9307, 5, 4309, -1, -1, -1, -1, -1, 6061, 9185, 2028, 5523, -1, -1, -1, -1,
+    -1, -1, -1, 3841, 2187, 5359, 2271, -1, -1, 4696, -1, 1476, 7346, 4728, -1, -1,
+    -1, -1, -1, -1, -1, 5574, 6814, -1, 6155, -1, 6692, 1145, 6160, 6919, 7326, 5997,
+    9462, -1, 3135, 7049, 7761, 731, 1186, 1925, 6952, 7781, 7804, 211, -1, -1, 5255, 3713,
+    7358, 2926, 90, -1, 4511, 776, -1, -1, -1, -1, 7292, -1, 1777, -1, 4520, -1,
+    -1, -1, 7732, -1, 6491, 1726, 4280, 1906, 6893, 7079, 9002, -1, -1, 390, 1299, 6557,
+    -1, 155, -1, -1, 9282, 746, -1, -1, 3424, 5455, -1, -1, -1, -1, -1, 5779,
+    804, 4370, 5256, -1, -1, 739, 9311, 5484, -1, 958, 5502, 7870, 9628, -1, 3077, 3203,
+    4288, 6429, 4446, -1, 6256, 5985, 7423, 5454, 4582, 186, -1, -1, -1, 6607, -1, -1,
+    4703, 1329, 3475, -1, -1, 7721, 8978, 9278, -1, 9540, 142, 3610, 2343, 4609, 1206, 5272,
+    9296, 9601, -1, 4278, 337, 2901, 6342, -1, 1017, 3514, 5609, 9649, 4776, 3021, -1, -1,
+    6704, -1, 6292, 8230, 9431, -1, -1, -1, -1, -1, 7063, -1, 1869, 4999, 3555, -1,
+    6026, 7425, 7775, -1, -1, -1, -1, 55, 3415, 3834, 5795, -1, 7400, -1, 4741, -1,
+    8007, 7320, -1, 2284, -1, -1, 1753, -1, 3567, 6774, -1, 1203, 7733, 2455, 5000, 4336,
+    8172, 9163, 6810, 534, -1, 4239, 4860, -1, -1, 6077, 529, -1, -1, 1742, 589, 1930,
+    8429, -1, 5326, -1, 8386, -1, -1, 4252, -1, -1, -1, -1, 2191, -1, -1, -1,
+    6938, 6867, -1, 2795, 3302, -1, -1, -1, 1220, 2596, 3118, 3226, -1, 2445, -1, -1,
+    8906, -1, 6518, 8806, -1, -1, 2764, 2381, 5559, 8983, -1, -1, 2291, 9602, 2895, -1,
+    -1, -1, 4546, -1, 8439, 2326, 7569, 8877, -1, -1, -1, 5004, 180, 8414, -1, -1,
+    -1, -1, 8258, 2477, -1, -1, -1, -1, -1, 4901, 6843, -1, -1, -1, 8245, -1,
+    -1, 1122, 3562, 4894, 8447, 6107, 3844, 6179, -1, 3896, -1, 4174, 3232, 4736, -1, 8988,
+    3282, 4323, 6045, 897, 2038, 5563, 6902, 7356, 9370, -1, 9442, 3082, 3086, 6188, -1, 58,
+    -1, 2372, 2789, 3558, 5390, 978, 3202, 7659, 7764, 7129, 8283, 9667, -1, 3196, 9690, 5785,
+    -1, -1, -1, 7453, -1, -1, -1, 3656, -1, 1446, -1, 4282, 8236, 9272, 833, 9010,
+    -1, -1, -1, 1332, 1221, 2444, -1, -1, 3480, 1747, 5981, -1, 7230, 510, 7777, -1,
+    7892, 4915, -1, 8881, -1, -1, 7615, -1, -1, -1, 7017, 4902, 5871, 6955, 7986, 9253,
+    -1, -1, 2012, 4665, -1, 2240, -1, -1, -1, -1, -1, 2103, 1946, 639, 2174, 2498,
+    3971, 9379, 1680, 7193, 7888, 1085, 3596, 8456, 7973, -1, -1, 3289, 421, 5850, 3743, 6339,
+    4654, 1236, 4927, 4417, -1, 376, 3252, 5801, 4455, 2696, -1, -1, 7600, 7705, 4262, 9670,
+    7574, 3512, 2972, 7630, 6164, 8340, -1, 1870, -1, -1, 4314, 8984, 3670, 936, 1818, 5752,
+    6117, 2107, 3084, 5773, 887, 3107, 3344, 5705, 5907, 7200, 7661, 396, 7838, 8387, 3190, 8890,
+    9143, 9606, 365, -1, -1, 1369, 3530, 5475, 8728, 7513, -1, 5486, 7051, 4825, 2812, 1120,
+    7023, 4433, 7086, 1693, 3481, 8168, -1, -1, 4617, 5392, 952, 8501, -1, -1, 1086, 1640,
+    -1, -1, -1, -1, 2400, 6099, -1, -1, 2458, 6715, 9575, 1198, 1339, 5600, -1, -1,
+    242, 3665, 5776, -1, 2844, 5107, -1, 1619, -1, -1, -1, -1, -1, 164, 3623, 8852,
+    9049, 6366, 9105, 2800, 5389, -1, -1, 3137, -1, 1020, -1, -1, 9672, 5418, 4161, 5669,
+    -1, -1, 5519, -1, -1, -1, 7338, 8377, -1, 2830, 6579, 3326, 6889, 5257, 2486, 8229,
+    -1, -1, 9443, -1, 8895, 9373, 7369, 3497, 4841, -1, -1, -1, -1, -1, 7531, 9241,
+    -1, -1, -1, 2680, 4753, 6178, -1, 3890, 1632, 6034, 9067, -1, -1, -1, -1, 4850,
+    1864, -1, 2565, -1, 4354, -1, -1, -1, -1, -1, -1, 8381, -1, -1, 4600, -1,
+    -1, 590, 9567, -1, -1, 4183, -1, 2373, -1, -1, -1, 1973, 7176, 8394, 8557, -1,
+    -1, -1, 755, 7843, -1, -1, -1, -1, 2194, -1, 5085, -1, 530, -1, 1054, 2892,
+    9487, 2488, 8004, 1798, -1, -1, -1, 2744, 878, 2241, 2956, 3265, 4684, 5547, -1, 7115,
+    7336, -1, -1, 6265, 3736, -1, 2663, 8191, 8409, -1, -1, -1, -1, -1, 526, 6528,
+    -1, -1, 4777, 1095, 2319, 5165, 6758, 8807, 9503, 870, 8594, -1, -1, -1, -1, 8535,
+    -1, -1, -1, -1, 899, 3566, -1, 5008, -1, -1, -1, -1, -1, -1, -1, 3334,
+    6144, 9038, -1, 2736, 5695, 6762, 2403, 4613, 8221, 8234, 8527, 9501, 9362, 2651, 9079, -1,
+    -1, 1133, 6541, 8062, 6841, 9017, 3568, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    1483, 7085, -1, -1, -1, -1, 8495, 8499, 93, 442, 9460, -1, -1, -1, -1, 4453,
+    6694, 2484, -1, 4984, 5400, -1, 2273, 2769, 2666, 6441, 4132, 3474, 243, 3270, 6601, 7127,
+    7359, 8319, -1, -1, -1, 6812, -1, 16, 4105, -1, -1, 3001, 4345, 6201, 2335, 6336,
+    -1, 8814, 2973, -1, 6133, -1, 8127, 7533, -1, -1, -1, -1, -1, 3789, 6790, -1,
+    -1, -1, -1, 3288, 7284, -1, -1, 1525, -1, 8450, -1, 1225, 1490, 7809, 8411, 234,
+    -1, 1321, 9084, 8470, 9488, 9665, 5343, 7211, 5297, -1, -1, -1, 465, 7231, 8900, 3012,
+    2312, 4356, 6759, 629, 9121, -1, -1, -1, -1, 2788, 4929, -1, -1, 4435, -1, 6122,
+    7945, 6976, 6875, 7316, -1, -1, -1, 2451, 2947, -1, -1, -1, -1, 4337, -1, -1,
+    -1, -1, -1, 1901, 7539, 8755, -1, 2823, -1, 7734, -1, -1, -1, -1, 5066, 5491,
+    -1, 7228, 9075, -1, -1, 4658, -1, -1, -1, -1, 5749, -1, -1, 4909, 5994, 8286,
+    -1, 3216, -1, -1, -1, -1, 3073, -1, 8197, 2188, -1, -1, 8655, 9681, 7979, 9607,
+    8608, 236, 3365, 297, 2000, 3662, 4004, -1, 4856, -1, -1, 9614, 1089, 2446, -1, 2322,
+    2578, 3331, 2052, 3773, 7277, 2546, 2515, 4936, 1376, 5144, 5689, 8163, 1544, 8980, -1, 3542,
+    -1, -1, 1592, 5295, 8942, -1, -1, 5545, 6263, 7066, 4334, 8721, 611, 6251, 6582, 1826,
+    9645, 8519, 4986, -1, -1, -1, -1, -1, 343, 7512, 3346, 8241, -1, 8550, -1, 8284,
+    1487, 7476, -1, -1, 837, 1879, 1889, 3152, 1832, 8787, -1, 4905, -1, 5187, 7342, 8157,
+    -1, -1, -1, 4946, 1774, -1, -1, -1, -1, 5711, 2297, -1, 4026, -1, 5958, -1,
+    9286, -1, -1, -1, 618, 6052, -1, 1538, -1, 4412, -1, -1, 2500, -1, -1, 2829,
+    6804, 182, 950, 594, 3991, 5210, 4445, 5331, 4823, 6519, 6606, 4190, 3784, 8861, -1, 4083,
+    4557, -1, -1, 9346, 6527, 6547, -1, 7779, -1, 7619, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 3682, 1255, 5990, 2087, 4517, 3011, 4717, 8066, -1, -1, -1, -1,
+    -1, -1, -1, 8889, 3312, -1, 7747, 9136, 3460, -1, 2685, -1, -1, 8593, -1, 4072,
+    -1, 9444, 7361, 4692, -1, -1, -1, -1, 1029, 1907, 4708, -1, -1, 4141, 8239, -1,
+    -1, 4538, 6149, -1, 4138, 5586, 488, 7297, 8344, -1, -1, 1137, 2463, -1, 8845, -1,
+    2502, 5209, 5524, 6094, 1169, 708, 7548, 7942, 1740, 2088, 1451, -1, -1, 1440, 1876, 120,
+    8791, -1, -1, 5172, 5538, -1, -1, -1, 2635, -1, -1, 8837, 7057, 2489, 2597, -1,
+    -1, 2579, 5180, 7959, 8045, 7207, -1, -1, 996, -1, -1, -1, -1, -1, -1, 5571,
+    6535, -1, 6206, 8563, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    8768, 4123, 7947, -1, -1, 8963, 6384, -1, -1, -1, -1, -1, -1, 6493, 1081, -1,
+    6977, 4218, 3924, 2773, 5947, 6311, 2550, 3308, 5649, 5262, 6924, 2200, 4055, 5582, 7987, 8956,
+    5728, 4710, 225, 9502, 5998, 3128, 6584, 915, 7263, -1, -1, -1, -1, 538, 1342, 6821,
+    7874, 7984, 2308, 3420, 8673, -1, -1, 1833, 2775, 7698, 9511, 6309, 8880, -1, -1, -1,
+    -1, -1, 3683, 3787, 5638, 5360, 4170, 675, 2712, 4158, 5768, 3352, 4559, 5462, 9055, 685,
+    -1, -1, 1915, 2504, 2623, 5214, 1623, -1, 393, 3482, -1, 3550, 9423, -1, -1, -1,
+    805, 3434, 4981, 7683, 6055, 9140, 9624, -1, -1, 806, 7128, 3853, -1, -1, 2349, 1947,
+    2670, 6272, 3188, 7504, 5729, 6982, 2787, 5818, -1, -1, 2873, 3089, 9013, -1, -1, 3306,
+    -1, -1, 2181, -1, 1053, -1, 246, -1, -1, -1, -1, -1, 4601, 9553, -1, 5372,
+    -1, 4876, -1, -1, 5960, -1, 9030, 1823, 3809, -1, -1, -1, 7607, 1275, -1, 9492,
+    1083, -1, 7138, -1, -1, 6492, 2992, 8932, 5376, -1, -1, -1, -1, -1, -1, 616,
+    -1, 3751, 744, -1, 1040, 380, 2763, 3549, 4998, 5309, 7467, 6078, -1, 7078, 9317, -1,
+    -1, -1, -1, 433, -1, 5584, 429, 513, 842, 2285, 4815, 34, 1059, 520, 4621, 2389,
+    832, 3554, 6057, 6197, 4671, 7024, 7599, 8574, 9398, -1, 6175, 6986, -1, -1, -1, -1,
+    -1, -1, 968, 5957, 8346, 4574, 1009, 663, 736, 8077, -1, -1, 462, 8512, 5354, -1,
+    -1, 2054, 3872, 4495, 8917, -1, -1, 1883, -1, -1, -1, -1, 314, 1416, 2051, -1,
+    -1, -1, -1, 9554, 168, 2049, 4843, 6438, 2946, -1, 5498, 6537, -1, -1, 871, -1,
+    -1, 9117, -1, -1, 1792, 6225, -1, -1, 2766, 7146, -1, 779, 5568, -1, -1, -1,
+    8580, 4706, 7572, 5628, 2746, 5617, 7155, -1, -1, 1188, 7368, 2739, 6699, -1, 9391, 6637,
+    5874, -1, 1195, -1, -1, 3676, 3999, 4735, 6757, 2316, -1, 1041, 3513, -1, 6293, -1,
+    4256, -1, 4813, 2958, 4553, 4168, 7427, 9112, 1839, 542, -1, -1, 2135, 4181, 2850, 6585,
+    -1, 2497, -1, -1, 5532, 1239, 8242, 1733, 4718, -1, 6973, -1, -1, -1, 1226, 1814,
+    4599, 8876, 206, -1, -1, -1, 1578, 6234, 9679, -1, -1, -1, 2279, -1, 7643, 3777,
+    -1, -1, 1069, -1, -1, -1, 4245, -1, 6713, -1, -1, 7579, -1, 8420, -1, -1,
+    5301, -1, 1356, -1, 4111, 445, 2714, 1262, -1, -1, 6161, -1, -1, -1, -1, -1,
+    7928, 6451, -1, -1, 8878, -1, 2392, 3204, -1, -1, 9042, -1, 2588, 8333, 8280, 8553,
+    -1, -1, 3214, 3752, 8441, -1, -1, -1, 3686, 9031, -1, 2480, -1, -1, 8587, 6308,
+    2511, 7114, -1, 9666, -1, -1, -1, -1, 8024, 3274, 928, 4807, 5722, 7227, -1, 3038,
+    5488, -1, 8366, 4095, 2089, 2204, 5425, 5551, -1, -1, -1, 1406, 4358, 2799, 827, 2896,
+    4921, 6132, 4604, 6936, 6421, 3672, 7307, 1402, 7381, 8082, 4507, 5811, 7424, 9490, 9573, -1,
+    1496, 2336, 5702, 9508, 1467, 6754, 3674, 8257, 8371, -1, 3887, 9630, 3411, -1, -1, 2832,
+    6887, 7821, 3901, 6023, 6244, 2141, 2537, 7602, 2435, 3087, 6498, -1, 229, 822, 7233, 8330,
+    2621, 5086, 4819, -1, -1, 6037, -1, 825, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 2113, 2590, 3778, -1, 8159, 8931, 244, -1, -1, -1, -1, -1, -1,
+    2820, 6900, 7041, -1, 8962, -1, -1, 2916, -1, 2767, -1, -1, -1, -1, -1, 436,
+    -1, -1, -1, -1, -1, 3525, -1, -1, -1, 6323, 1891, -1, 6668, 3085, 6030, 6932,
+    -1, -1, 622, -1, 973, -1, -1, 1028, 5014, -1, -1, -1, 2657, 2707, -1, 6194,
+    3464, 8887, -1, 6346, 8666, 7519, -1, -1, -1, -1, 2582, 4241, 1769, 4308, 1253, 7706,
+    -1, -1, -1, 4685, 3546, -1, 3469, 6151, 6808, -1, 2363, 4274, -1, 1388, 4, 4475,
+    5979, 8489, 1171, 1739, 1492, 2091, 4852, 2855, 5615, 7148, 608, 2998, 7201, -1, 6291, 4922,
+    5579, -1, -1, 420, -1, -1, 7237, 8838, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 7087, 1265, 3943, 8776, 909, 124, 8860, 6588, 9099, -1, -1, 8041, -1, 7365, 1666,
+    1808, 6013, 2067, 8160, -1, 8908, 751, -1, -1, -1, -1, 6177, 7983, -1, -1, 2918,
+    3251, 2300, 8292, 9455, 7583, 7149, 9082, -1, 1576, -1, -1, -1, 1722, -1, -1, 137,
+    -1, 6400, -1, 4711, 5150, 3964, -1, 3291, 1261, -1, 7105, 8452, 9040, -1, 1077, 3239,
+    4893, 5596, 7306, 6069, -1, 3797, 6084, 9415, 4754, 6227, 8902, -1, 550, 4069, -1, 882,
+    -1, -1, 5645, 6073, 5485, 7769, 7218, 9305, -1, 8048, 7034, -1, 8957, 2305, 3880, 4041,
+    474, -1, 4732, -1, -1, 1706, 3932, -1, 2245, 6709, 152, 4589, -1, 4570, 5098, 1636,
+    6999, 431, 2306, 6650, 5805, 7271, 8275, -1, 2637, -1, 2045, 5081, 5003, 6564, 3224, 7991,
+    2176, 5140, -1, 1565, 6846, 8757, -1, -1, -1, -1, -1, 7606, 4615, -1, 4697, 676,
+    -1, 5832, -1, 9033, -1, -1, -1, 9509, 2683, -1, 8006, 3125, -1, 5478, -1, -1,
+    -1, 3611, -1, -1, 9343, 9247, 4867, 5032, -1, -1, -1, 8345, -1, -1, 3382, 8107,
+    9004, 3414, 1734, 940, 8016, -1, -1, -1, 331, 5854, -1, 8869, -1, -1, 313, -1,
+    -1, 2365, -1, -1, -1, -1, 2702, 6028, -1, 782, 796, -1, -1, -1, -1, 4374,
+    5300, 8449, -1, 6805, -1, -1, -1, -1, 231, 3694, -1, -1, 4598, -1, -1, -1,
+    -1, -1, -1, -1, 4379, 7790, -1, -1, 7604, 1569, 3691, 5915, -1, 267, 1211, 8526,
+    -1, -1, 3697, -1, 562, 5975, -1, -1, 4551, 4522, 5148, 6506, 7147, 7832, 9221, 3156,
+    4127, 7245, 8295, 1398, -1, 986, 5988, 9051, 7510, -1, 3923, 4321, -1, -1, -1, 9275,
+    -1, -1, 817, 261, -1, -1, -1, -1, -1, -1, 196, -1, 223, 808, 2664, 9535,
+    948, 2132, 9616, 4469, 8714, -1, -1, -1, -1, 523, 336, 635, 7169, 355, -1, 983,
+    -1, 8947, -1, 533, 3161, 9486, 4421, 4481, 5781, 2021, 6745, 8194, 407, 6898, 8693, -1,
+    -1, 2629, -1, -1, -1, 668, 9366, 8620, -1, 3310, 264, 9107, -1, 1875, -1, 3263,
+    1277, -1, 2968, 3942, -1, 4165, 7522, 36, 4408, 9202, 2140, 6517, 3842, 5379, -1, -1,
+    -1, -1, 8578, -1, -1, 1291, 5291, 9271, 929, 4854, -1, -1, 5856, -1, 3718, 9320,
+    -1, -1, 369, 4053, 7578, -1, -1, 3471, -1, -1, 6358, 5366, -1, 613, -1, -1,
+    2514, -1, -1, 5267, 2294, -1, -1, -1, 7477, -1, -1, -1, 609, 459, 3129, 5438,
+    5583, 6520, 8847, 7557, 9465, 6674, -1, -1, -1, -1, -1, 94, -1, -1, 1877, 4498,
+    7186, 959, 3343, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1542, -1, 7696, -1,
+    -1, 767, 1983, 900, 6864, 8973, -1, -1, -1, 2543, 9541, 3200, -1, -1, 1480, 265,
+    5171, -1, 7585, -1, 8473, -1, 8592, -1, 5753, 640, 7553, 600, 3472, 4206, 7714, 8678,
+    -1, 1208, 3520, 6654, 281, 1338, 7826, -1, 3166, 8570, 4742, -1, -1, -1, 7720, 4740,
+    82, 1033, 2334, 7435, 7755, 7898, 4853, 9590, 25, -1, 7654, -1, -1, -1, 8751, -1,
+    -1, -1, 3548, -1, -1, -1, -1, -1, -1, -1, 7280, 6399, -1, -1, -1, 1888,
+    -1, -1, 1353, 2634, 8976, 3986, -1, 3768, -1, -1, -1, 1426, 1241, 2309, 8736, -1,
+    -1, -1, -1, -1, 6829, -1, -1, 3199, 3493, 4625, -1, -1, -1, 1156, 7689, 8521,
+    -1, 3742, 272, 6592, 6196, -1, -1, -1, 578, 1136, 2333, 4695, -1, -1, -1, -1,
+    1322, 6632, -1, -1, 1661, -1, 4672, 2882, 5581, 3201, 7597, 1552, 9104, 5760, -1, 1001,
+    -1, -1, 8105, 7831, 5607, 1986, 354, 4126, 5011, 5968, 6892, 325, -1, 6246, 4018, 454,
+    -1, 1424, -1, 2360, -1, 7609, -1, -1, 2226, -1, -1, -1, 1176, 2630, 5789, 6730,
+    7647, 4350, 4636, 662, 3095, 5940, -1, -1, -1, 8081, 3716, 1721, 8544, -1, -1, 9463,
+    9644, -1, 5181, 7140, -1, -1, -1, -1, 610, 5690, 8273, 4590, 8899, 427, 655, 1760,
+    524, 5149, 6684, 8151, 3563, 9007, -1, -1, 2528, 6553, 4311, -1, -1, -1, -1, -1,
+    2681, -1, 823, 7265, -1, 2503, 3307, 599, 3388, 3849, 3941, 2467, 4407, 4634, 4812, 6599,
+    6395, 8379, 8402, 220, 820, 6072, 7436, 2676, 8930, 8936, 6868, 9154, 3614, 9438, 9496, 7754,
+    -1, -1, -1, 1746, 1386, 4864, 7561, 7748, 1872, 3160, 7712, 7812, 4434, 9304, 7181, 5945,
+    9326, 4080, 2452, -1, -1, 5315, -1, -1, 1066, 1044, 1766, -1, -1, -1, -1, -1,
+    8144, 8808, -1, -1, -1, 1600, 4186, 1384, 3145, 6427, 1976, 3026, 4328, 1075, 5005, 6198,
+    3602, 6848, 9115, 6753, -1, -1, 1916, 2248, 3045, 5132, -1, -1, 1878, 5989, 4899, 6190,
+    509, 3788, -1, 1015, -1, 2206, -1, 1691, 3074, 6559, 3947, 6510, 8849, 9669, 7488, 4955,
+    8886, -1, 3210, 7855, 11, -1, -1, 5182, 7389, 9174, 7586, 1393, 5959, 743, 9328, -1,
+    -1, 4324, 9190, -1, -1, 5311, 7501, 5341, 7616, 711, 1793, 8628, 2468, -1, -1, 614,
+    -1, -1, 4449, 8785, 1743, 9226, -1, 2521, 8979, 1140, -1, -1, 67, 7894, 2483, -1,
+    6851, -1, -1, -1, -1, -1, -1, 3968, 4233, 1855, 2153, 8332, -1, -1, 2995, 5131,
+    -1, 4071, -1, -1, 4505, 6943, -1, 1837, 4211, 4512, 5601, 6048, -1, 4230, 8002, 2212,
+    5142, 8247, -1, -1, -1, -1, 4548, -1, 851, -1, 2627, 5756, 8327, 2346, -1, -1,
+    62, 1427, 6556, 4492, 1984, 812, 3523, 4606, 8035, 8891, -1, -1, 3141, -1, -1, 2215,
+    848, 7977, 3636, 138, -1, 890, -1, -1, -1, -1, 6604, 6136, -1, -1, -1, 8210,
+    4312, 6673, 7814, 3311, 9229, 7703, -1, -1, 1018, 6068, -1, 12, 6110, 8997, 7542, 9668,
+    4040, -1, 5111, -1, 2171, 5083, 5473, -1, -1, 4647, 7402, -1, 703, -1, -1, 5216,
+    -1, 4175, 4994, 4693, 2207, 7941, -1, 1723, 2442, 6060, 3492, 7403, 9314, -1, -1, -1,
+    4115, 384, 5384, 6415, -1, -1, -1, 792, 2186, 3816, -1, 6548, -1, -1, 3823, 2999,
+    -1, 9029, -1, -1, -1, 7120, 9604, -1, -1, -1, 117, 3669, -1, 5024, 5949, -1,
+    -1, 3883, 7887, -1, -1, 2839, -1, -1, 4155, -1, -1, -1, -1, -1, 319, 26,
+    -1, -1, -1, -1, 2441, -1, -1, 4210, 6392, -1, -1, 3866, 9237, -1, -1, -1,
+    -1, 5683, -1, 478, -1, 3099, -1, 3257, -1, 8375, -1, -1, -1, 5995, -1, 276,
+    3222, 8401, 3979, 2535, 5917, 1961, 5440, 3358, 6020, -1, -1, 980, -1, 4145, 7639, -1,
+    9683, -1, -1, -1, -1, -1, -1, 3571, -1, -1, -1, -1, 2671, -1, -1, -1,
+    -1, -1, 819, 3906, 4918, 238, 1359, 7833, -1, -1, -1, -1, -1, -1, 1209, -1,
+    3241, 3658, 3802, 5162, 5941, 8760, -1, -1, -1, -1, -1, 4192, 8126, 9430, -1, 3599,
+    -1, 8433, 3692, 4048, 688, 6991, 8730, 3504, 1902, -1, -1, -1, -1, 5250, 5308, 6580,
+    7366, 7998, -1, -1, -1, 2690, -1, 6983, -1, -1, 4147, 4167, 1007, 6213, -1, 5533,
+    3914, 1163, 1366, 3461, 4987, -1, -1, -1, 2564, 815, 5453, 6325, 7525, -1, -1, -1,
+    8864, 5007, 2122, 3618, 2986, 4844, 5790, -1, -1, -1, -1, -1, 2713, 5520, -1, -1,
+    -1, -1, 1266, 5437, 8065, 8771, 8964, -1, 5840, 8579, 2636, 280, 2833, 3314, 4830, 7314,
+    7472, 202, 693, 4970, 3704, 4075, 1130, 7919, 7929, 8994, 9605, -1, -1, 9220, 65, 1215,
+    3620, -1, -1, -1, -1, 2863, 1528, 4148, 1491, 5367, 5482, 7116, 7875, 8758, 6118, 7335,
+    8260, -1, 57, 1812, 2720, 1868, 3760, 5046, 6460, 5114, -1, -1, -1, -1, 3069, -1,
+    1293, -1, -1, -1, 4583, -1, -1, 7355, -1, -1, 857, 366, 404, 2619, 3132, -1,
+    5938, 7422, -1, -1, -1, -1, 2167, 761, 8370, -1, -1, 4250, -1, 5950, 1659, 191,
+    -1, -1, -1, -1, -1, -1, 3286, -1, 4401, -1, 5642, 1948, 4287, 1830, -1, -1,
+    7450, 9341, -1, -1, -1, -1, -1, 3524, 8100, 4943, 9273, 8110, -1, -1, 8569, -1,
+    -1, -1, -1, 849, 1052, 1972, -1, -1, 160, 7563, 3004, -1, 5969, 5490, 6985, 5800,
+    159, 7739, -1, -1, 680, 1368, 9437, -1, 3526, 7143, 8707, -1, -1, 1078, 107, 2258,
+    2032, 3521, 2951, 4744, 5186, 2350, 4159, 6058, 7802, 2694, 6832, 9141, -1, 9251, -1, -1,
+    1006, 3803, -1, 5271, -1, -1, -1, -1, -1, 7515, -1, 8835, -1, 3490, 7022, 9408,
+    5612, -1, 8564, -1, -1, -1, -1, -1, -1, -1, -1, 60, 7246, -1, 6089, -1,
+    -1, -1, 5030, -1, -1, -1, 8302, 9385, 1162, -1, 2318, 4931, 8554, -1, -1, 1217,
+    4416, 946, -1, -1, -1, 8475, -1, 1840, 3422, 1501, 1999, -1, 3067, 3765, 7291, 3467,
+    7719, 385, -1, -1, -1, -1, 3253, 2883, 5720, -1, -1, 1756, 5688, -1, -1, -1,
+    1692, 2677, 3079, 5345, 1168, 2533, 3003, 3974, 4313, 7536, 9291, 3745, 6172, 2461, -1, -1,
+    2457, 2059, 2701, -1, 5097, -1, -1, -1, 1884, 2485, 3377, 8737, 7999, 9235, -1, -1,
+    -1, -1, 1464, -1, 2414, 9467, 3007, 7912, -1, -1, 3557, 2544, -1, 559, -1, 446,
+    6056, 7828, -1, -1, 1806, 7589, -1, -1, 322, 5270, 7648, -1, -1, -1, -1, -1,
+    -1, 7905, 2734, 9372, -1, -1, 3207, -1, 1730, 5641, -1, 5909, -1, 7944, -1, 6675,
+    -1, -1, 8607, 7546, 3040, 230, 858, 3604, 3689, 7587, 2035, 5320, 5964, 7741, 7939, 8072,
+    8237, -1, -1, -1, 5796, 1478, -1, 2760, -1, 4450, 3821, 7382, 6121, 6357, 1024, 6780,
+    -1, -1, 4171, 8636, 2162, -1, -1, 8064, 9216, 7224, -1, -1, 821, 4258, 4466, 9036,
+    5556, -1, -1, 3875, -1, -1, 3585, 5541, 7953, -1, -1, -1, 2930, -1, 2862, 7675,
+    4277, -1, -1, 8349, -1, -1, -1, -1, 1589, 4286, 646, 4326, -1, 6636, -1, 9484,
+    3616, -1, 2139, -1, -1, 1718, 1622, 3950, 4963, 3261, 113, -1, -1, -1, -1, 249,
+    3508, 5191, 8061, 3605, 1786, -1, -1, -1, 5314, 7001, -1, -1, -1, -1, 362, -1,
+    -1, 2975, 5861, -1, 4923, 2778, 4203, 7576, 9421, -1, -1, -1, -1, -1, -1, 2036,
+    7463, -1, -1, -1, -1, -1, 9592, -1, 9009, 1928, 2506, 188, 5508, 865, 6289, 1683,
+    7157, -1, -1, 6695, 8698, -1, -1, -1, 6890, 3993, -1, -1, -1, -1, -1, 2438,
+    7194, -1, -1, -1, -1, -1, -1, -1, 1645, -1, -1, -1, -1, -1, 846, 6830,
+    -1, 9285, -1, -1, -1, -1, 6825, -1, -1, -1, 7668, 5792, -1, -1, 6788, -1,
+    4886, 651, 1874, 5373, 5459, 8799, 839, 4194, -1, 129, -1, 6476, -1, -1, -1, -1,
+    -1, 3904, 1408, 8560, -1, -1, -1, -1, 7047, 3819, 4248, 2549, -1, 7497, 932, -1,
+    -1, 112, -1, 1493, 5839, -1, 3852, 372, 470, 1413, -1, -1, 9524, -1, -1, -1,
+    -1, -1, 691, 1019, -1, -1, -1, 5845, 5017, 1548, -1, -1, 3392, 5834, 8520, 8322,
+    4438, -1, -1, -1, 8734, -1, 3510, -1, 2491, -1, -1, -1, 3440, 4640, 6200, -1,
+    2317, -1, 6233, 9214, -1, 9303, -1, 8604, 1073, 7448, -1, -1, 1276, -1, -1, -1,
+    3157, 5681, 4858, 6687, 9576, 6701, 3283, 9664, -1, -1, -1, 388, 831, 4895, 1703, 4655,
+    4651, 4992, 6500, 6748, 3595, 68, 2593, 7350, 7577, 7730, 4796, -1, 6157, -1, -1, -1,
+    9378, 2060, 8350, 5661, 3867, 764, 279, 3353, 8339, -1, 6949, 5647, -1, -1, -1, -1,
+    -1, -1, -1, 7731, 6124, -1, -1, 6322, -1, -1, 5919, -1, 6480, -1, -1, 6691,
+    8893, -1, -1, 8285, -1, -1, -1, 2487, -1, -1, -1, -1, 2471, 1031, -1, 8254,
+    729, -1, 7426, 4179, 6801, 4510, 6495, -1, 1314, -1, -1, -1, 3473, -1, 6321, 6567,
+    2523, 4803, -1, 2607, 1358, 4097, 3243, 5382, 2263, 7936, 4677, -1, 151, 7133, -1, -1,
+    -1, -1, -1, -1, 2251, 2554, 4157, 4501, 317, 3707, 701, 8992, 7678, 6278, 7765, -1,
+    467, 2872, -1, -1, 9394, 3165, 6335, 45, -1, -1, 2641, 9532, -1, 697, 5663, 7788,
+    -1, -1, -1, 6490, 2648, 7109, 1517, 2252, 4038, -1, 9195, -1, 6467, 6105, -1, -1,
+    3793, 3078, 5668, -1, -1, 4644, -1, 6231, 8590, 2585, -1, -1, 1780, 3800, 5397, -1,
+    -1, -1, -1, 5287, -1, 5606, -1, -1, 5349, -1, 8083, -1, 7784, -1, 642, 963,
+    4630, 2842, 7693, 3600, 4862, 6620, -1, -1, 4869, 788, -1, -1, -1, 108, 2340, 1927,
+    5403, 7037, 2076, 7095, 8801, 1553, 6021, 6394, 1056, 7464, 8222, 9301, 4759, -1, 4237, 1585,
+    7592, -1, 5843, -1, 3195, -1, -1, -1, -1, -1, -1, 40, -1, -1, -1, 6173,
+    9611, -1, -1, -1, -1, -1, 5725, 1514, 2674, 2747, 6439, 8373, 2979, 5539, 7334, 2078,
+    9550, -1, 4575, -1, -1, 4143, 8782, -1, -1, 2321, 5676, 3271, 5318, 7152, -1, 989,
+    1942, 7131, 6319, 6128, 7640, 9147, -1, 4834, 5684, -1, -1, 2512, -1, 2154, 7931, 9293,
+    -1, -1, -1, -1, 3150, 482, 1502, 2133, 3836, 4683, 5798, 7098, 273, 3533, 7715, 4875,
+    -1, 2899, -1, 4881, 7239, 5260, 4770, 5911, 5637, 840, 1147, 3608, 7065, 7852, 7940, 8384,
+    8513, 4687, 4482, 4861, 4989, 8708, 8623, -1, -1, -1, 7372, -1, -1, 2887, 3231, 6873,
+    8018, -1, 3771, 7980, 9295, -1, 8056, -1, -1, -1, -1, -1, 4144, -1, -1, -1,
+    6267, 7920, 2386, 8395, 9653, -1, 299, 1994, 2131, 8054, 8498, 9280, -1, -1, -1, -1,
+    7413, 7514, -1, -1, -1, 1790, 5213, -1, 1439, -1, -1, -1, 3266, -1, -1, -1,
+    1489, 2818, 3093, 7299, 9045, 4479, 4897, 1750, 7669, 3725, -1, 7010, -1, 7466, -1, -1,
+    5335, -1, 3154, 4444, 9308, 6472, 2552, -1, -1, 834, -1, -1, -1, 47, 4307, 7662,
+    -1, -1, -1, 5708, 2478, 3305, 7040, 306, 7208, 9183, 2859, 3174, 6635, 251, 1027, 4774,
+    6586, 5353, 4429, 861, 3997, 8223, 6174, 1193, 6533, 2134, 6677, 8765, 9277, -1, 8040, -1,
+    -1, -1, 5982, -1, 2265, -1, -1, 3709, 8153, -1, -1, 8638, -1, -1, -1, 9064,
+    3381, 6333, 7296, 8162, 9054, 4916, 5332, 6229, 7339, -1, 2228, 4743, 1731, 2198, 3877, 4593,
+    5803, 3897, 9468, 6638, 9479, 3776, -1, 7891, 4767, 8102, -1, 1284, 6688, 7798, 334, -1,
+    -1, -1, 4723, -1, 4795, -1, -1, 5827, 6449, -1, 8676, 4116, 2443, 3006, -1, -1,
+    2738, -1, 4216, -1, 4592, -1, -1, 6271, -1, 1847, 6218, 6772, -1, 695, 4396, 926,
+    -1, 6032, -1, -1, -1, 6605, -1, 1364, 6318, -1, -1, 944, 1108, 2034, -1, 5963,
+    -1, -1, -1, -1, -1, 2553, 9673, 9687, 786, 3907, 5499, 8744, 8941, -1, -1, -1,
+    -1, 2351, -1, -1, 440, 586, 8918, -1, -1, -1, 638, 6104, 7981, 5402, 6270, 7965,
+    8948, 2229, 6911, 9119, 6789, -1, 2700, -1, 4403, 6783, 1631, -1, -1, -1, 76, 7509,
+    7794, -1, -1, -1, 8534, 1911, 2009, 3589, 3724, -1, -1, 953, 193, 794, 4293, 1365,
+    6965, 795, 8705, -1, -1, -1, -1, -1, 9166, -1, -1, -1, 4134, 2790, 8555, 2002,
+    -1, -1, -1, -1, -1, 5759, 7856, 2776, 5450, 3330, -1, 7700, -1, -1, 8196, -1,
+    -1, -1, 5477, 5443, -1, -1, 5189, -1, 105, 8050, 8634, -1, -1, -1, -1, -1,
+    2138, -1, -1, 9243, -1, -1, -1, 1842, -1, 9457, -1, -1, 8648, -1, -1, 1971,
+    -1, 4015, -1, 5939, 315, 4098, -1, 9389, 422, 2843, 5888, 9395, 3990, -1, 3659, 5829,
+    5962, -1, -1, -1, -1, 5230, 7262, 3100, -1, -1, 4673, -1, -1, -1, -1, 8697,
+    -1, -1, 4879, 1560, -1, -1, 4870, 5821, -1, 4800, 4917, -1, 836, -1, 563, 4420,
+    22, 1103, 5847, 6612, 6746, 6849, 4306, 6625, -1, 3104, -1, -1, 4808, 9577, -1, -1,
+    -1, -1, -1, 7409, -1, 7627, 2047, 3300, 1506, -1, -1, 6645, -1, 4259, 20, -1,
+    -1, 9615, -1, -1, -1, -1, 1249, -1, -1, 4562, -1, -1, -1, -1, -1, -1,
+    9382, 5205, -1, -1, -1, -1, 1737, -1, -1, 758, 3936, 7421, 9516, -1, 4182, 8347,
+    8971, 6332, 3456, 3149, -1, 7286, 4652, 4128, 7258, 8810, 7439, 6781, -1, -1, 1410, -1,
+    121, -1, 7479, 7112, -1, 1770, -1, 3122, 4691, 8014, 346, 923, 9636, -1, -1, -1,
+    2266, 5602, 7235, 7845, 8537, 4785, 4792, 9648, 1115, 4838, 292, 2686, -1, 8303, -1, -1,
+    -1, 4484, 5935, -1, 6981, -1, -1, -1, 6948, 6990, 3729, 7954, 8809, 3399, -1, 7238,
+    -1, -1, -1, 2961, 4363, 6609, 1886, 7241, 7370, 7921, 3710, -1, -1, -1, -1, 3996,
+    -1, -1, 2665, 1047, 1547, -1, -1, -1, 8476, -1, -1, -1, 4405, 3101, 2660, 5564,
+    6074, 6255, -1, 5207, 9175, 3988, 735, 3825, 2496, 1940, 5673, 3119, -1, -1, 3023, -1,
+    -1, 328, -1, -1, 3275, -1, 5718, 441, 4769, 7142, 9201, 2534, -1, -1, -1, -1,
+    1988, -1, 814, -1, -1, 6778, -1, 6716, 6306, 8276, -1, 8843, -1, -1, 329, -1,
+    -1, 2073, -1, -1, 4787, -1, -1, 1063, -1, -1, 50, -1, -1, -1, 943, 9006,
+    5261, 8115, -1, -1, 5194, -1, 2170, -1, -1, 757, 1370, 171, 17, 4502, 5177, 6406,
+    7386, -1, 1375, 1124, 2374, 6741, 8453, -1, -1, -1, 9316, -1, 6344, -1, 1442, 1593,
+    2219, 3579, 5526, 3185, -1, 4362, 9340, -1, -1, -1, -1, -1, -1, -1, 4366, -1,
+    -1, -1, -1, 9339, -1, -1, 7760, 49, 8986, 1933, 3584, 5937, 6422, 2439, 4884, 803,
+    988, 6457, 4177, 2029, 789, 5293, 3744, 8659, -1, 1969, -1, -1, 1697, 184, 1023, 4172,
+    838, 6798, 787, 8425, -1, -1, -1, -1, 5925, -1, -1, 5158, -1, -1, -1, 2771,
+    -1, -1, 971, 1991, 5633, -1, -1, -1, -1, -1, 3915, -1, -1, 9545, -1, -1,
+    -1, -1, -1, 1974, 7171, 2743, 2845, 7190, 7489, 7644, 9533, -1, -1, 8256, 2725, 195,
+    8965, -1, 5914, 1400, -1, -1, 6880, 7259, -1, 2955, 5317, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 4263, 5404, 5710, 3754, 63, 7166, -1, -1, -1, 7048, -1, 7276,
+    406, 6361, 759, 2086, 8756, 828, 4674, 4888, 7728, -1, 5763, -1, 4810, 8446, 8448, -1,
+    4187, 2662, 3755, 7236, 916, -1, 9632, -1, -1, -1, 3192, 7879, 3094, -1, 532, 3406,
+    619, -1, -1, -1, 3515, 8672, -1, 7867, -1, 1672, 8727, -1, 3538, -1, -1, 8130,
+    -1, -1, 4078, -1, -1, -1, 5338, -1, 2328, 9012, -1, 9145, -1, -1, 955, 5868,
+    -1, 5013, 2755, 1112, 2591, 8525, -1, 1918, -1, -1, 576, 6223, -1, -1, -1, -1,
+    6670, -1, 7101, 3092, -1, 3447, -1, -1, 9383, 1909, 5992, 6616, -1, -1, -1, -1,
+    -1, -1, 3864, 128, 4614, 4675, 8745, -1, 1111, -1, -1, 5120, -1, 2106, -1, -1,
+    7593, 8741, -1, -1, 5274, -1, -1, -1, -1, -1, 9083, 4027, -1, 285, 3298, 4848,
+    9657, -1, -1, -1, 92, 6475, -1, 8199, 9043, 2062, 7430, 8875, -1, 1700, 4811, 4729,
+    1822, -1, -1, -1, 6978, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 4845, -1, -1, 185, -1, -1, -1, 288, 2960, 4052, -1, 2650, 7407, 9562,
+    6435, 4572, 3938, 4597, 738, 5951, 6641, 6742, -1, -1, 2095, 8485, 9159, 4564, 4554, 2869,
+    5639, 3801, 6712, 7137, 294, 2214, 7665, 8632, 6158, 9480, 6396, -1, 7691, 9354, -1, 8203,
+    -1, -1, -1, 4299, -1, -1, -1, 4441, 6350, 6297, -1, 8316, 2849, 4423, 3631, 5656,
+    7803, 323, 6381, 1635, -1, 4907, -1, -1, -1, -1, 3929, 7478, 9603, 9542, -1, 8630,
+    6702, 6152, 7210, 7950, -1, -1, 5055, -1, -1, -1, -1, 1346, 8358, 8689, 1755, 9131,
+    -1, -1, 2239, -1, 4442, 4527, 1187, 7021, 8049, 5549, 8170, -1, 3486, 847, -1, -1,
+    7243, -1, 1910, 4790, -1, -1, 7906, -1, 3454, 6917, 2202, -1, 3952, 487, 7822, 2749,
+    -1, -1, 2213, 4602, -1, 2575, 8494, 8651, -1, -1, -1, -1, 3578, -1, 9008, 7184,
+    -1, 4878, -1, -1, -1, -1, -1, 5289, 6729, -1, 4037, 4782, 3321, 5280, 6565, 4508,
+    1801, 1037, 3177, 843, 5190, 7763, 6512, -1, -1, 1305, 5599, 469, 765, 367, 1846, 1357,
+    6108, 8671, 5955, 802, 1851, 3927, 7420, 8792, 1835, 8871, 6154, 9512, -1, 9599, -1, 7766,
+    -1, -1, -1, -1, -1, -1, 7778, 8368, -1, -1, -1, -1, -1, 6162, -1, -1,
+    -1, 8865, 8243, 7451, 2807, -1, 7521, -1, -1, -1, 8188, -1, 86, 3702, 4251, -1,
+    -1, 4900, 5110, 5644, 2611, -1, -1, -1, -1, -1, 2494, 6525, 6732, 8493, 9196, 1554,
+    -1, 5423, -1, -1, -1, -1, 4393, 5370, 4957, 800, 6998, 8539, 4940, 9581, 2090, 1256,
+    2522, 6454, 6721, -1, -1, 2013, -1, 9331, -1, -1, 1694, 7555, 5155, -1, -1, -1,
+    2398, 2950, 1607, 5887, 83, 5116, 1644, 2605, 2615, 7846, -1, -1, -1, 6, 4208, 1564,
+    5294, -1, -1, -1, -1, -1, -1, -1, -1, 3886, -1, 8746, -1, -1, 715, 6666,
+    3317, 5650, 2852, 8844, 8946, 9682, -1, -1, -1, 6954, 3693, -1, 2216, 7495, -1, 771,
+    6800, 8701, 7446, 4318, 7288, 9397, 500, 3808, 479, 2731, 3054, 6855, 1166, 1414, 9571, -1,
+    -1, 6513, 7175, 4045, -1, -1, 8282, -1, 3410, 8870, 2155, 6874, -1, 6464, 5125, 1913,
+    4747, 5204, 7061, 1708, 8826, 4028, 6538, 6807, -1, 9640, 8831, 2583, 6461, 9233, -1, -1,
+    5196, 2071, 2551, 4073, 4846, 2378, 4035, 7060, 9485, -1, 5436, 5263, 7913, 8717, -1, -1,
+    -1, 3333, 3551, 84, 3966, 5435, -1, 8325, 8410, 8171, 604, -1, 1662, -1, -1, -1,
+    -1, -1, 6232, 7550, 1566, 572, 2195, 3066, 1938, 2018, 2717, 3249, 3726, 1199, 2581, 580,
+    2814, 1658, 5674, 6747, 6820, 2476, 5139, 6086, 7253, 7287, 3663, 7161, 233, 8069, 1966, 8468,
+    413, 1335, 6992, 9597, 5652, -1, -1, 287, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 637, -1, 5051, 3913, -1, -1, -1, 2290, 8596, 9116, -1, -1, -1, 5084, 6595,
+    -1, 3144, 3822, 7601, 289, 4214, 9223, -1, 1511, 2169, 411, 7080, 7371, -1, -1, 7970,
+    -1, -1, 3273, 302, 921, 3301, 6397, 8135, 1300, 1071, 8783, -1, -1, -1, 2419, 2532,
+    3931, 4104, 7033, 3397, 8383, 9245, 9352, 1472, 756, 2260, 2897, 6552, 8096, 1704, 6446, -1,
+    -1, 2281, -1, -1, 7620, 2647, 8195, 9549, 9523, 4384, 8378, 3449, 1993, 5229, 8079, -1,
+    -1, -1, -1, 3898, 1391, -1, -1, 4660, 1051, -1, -1, -1, 3050, -1, -1, 4733,
+    5616, 3761, 5303, 1922, 5405, 6653, 6865, 7634, 397, 6842, 1594, 8186, -1, -1, -1, -1,
+    -1, -1, 2110, 4353, -1, 9108, -1, -1, 1466, 1523, 6096, 7412, 7590, 6403, 5671, 1360,
+    7004, 9368, -1, -1, -1, -1, 5666, 8600, 9239, -1, 2878, -1, -1, -1, 621, 1161,
+    3114, 15, 3700, 2571, -1, -1, -1, -1, -1, 6752, 6551, 6426, 8253, 9306, 5192, 8562,
+    8709, -1, -1, 5530, -1, -1, 643, -1, -1, 6027, -1, -1, 5565, 6006, 7746, 7395,
+    1639, 1667, 1748, -1, -1, -1, -1, -1, 5237, -1, -1, 2937, 8640, -1, 7768, 5707,
+    2006, 6995, -1, 9093, -1, 4656, 3217, 7496, 9675, 2325, 201, 8357, -1, -1, -1, 4349,
+    -1, -1, 5365, -1, -1, 835, -1, -1, 9452, -1, -1, 1259, 9153, -1, -1, 2005,
+    3394, 4163, 123, -1, -1, 8365, -1, 5788, 6679, 7242, -1, -1, 2405, 7988, 6966, 1504,
+    -1, 3848, -1, -1, 2984, 8185, 3350, 6189, 7992, 3396, 9531, -1, 5712, 1312, 1205, -1,
+    -1, -1, -1, 9458, 957, 6826, 2119, -1, 3981, 1094, 5310, 8656, 8827, -1, -1, -1,
+    1820, 6950, 9109, -1, 4402, 1340, 8268, -1, 7656, -1, 1387, 7943, 4431, 4458, 8021, -1,
+    -1, -1, 1155, 2459, 7364, -1, 1630, 5881, -1, 134, 3547, 1254, 7205, 8576, 1096, 1194,
+    7801, 6436, 4275, 970, 1572, 3098, -1, 70, 5227, 2182, 3351, 4491, 7226, 5852, 7684, 8093,
+    8329, -1, 656, 7517, 6526, 7952, 2353, 8625, 8951, 6262, 6477, -1, -1, 2356, 3030, 3869,
+    -1, -1, -1, -1, -1, 4863, -1, 7440, 5421, -1, -1, -1, 5898, 8805, -1, 5479,
+    -1, -1, 3453, 4342, 8146, -1, -1, 3061, -1, -1, -1, 8510, 9244, -1, -1, 326,
+    1581, -1, 1065, 7220, -1, -1, 3121, -1, 6277, -1, 727, 9252, -1, -1, -1, -1,
+    -1, -1, 6022, -1, -1, 7670, 2362, -1, 2866, 6382, 8231, 8469, -1, 2493, -1, -1,
+    -1, -1, 2595, 9066, 4378, 6007, 5060, 3395, -1, 6240, -1, 6509, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 5420, -1, 283, 8416, -1, -1, -1, -1, 2675, 4623, 7363,
+    2292, 2985, 6345, -1, 8677, -1, 290, 880, 6597, -1, 6408, 6283, 6523, 7990, 2679, 3436,
+    8272, 6777, 8457, -1, 8382, -1, 3814, 3076, 3448, 4788, 5118, 1936, -1, -1, 7124, 6725,
+    7038, -1, 1860, 725, 2806, 4436, 6657, -1, -1, 965, -1, -1, 7266, -1, 2210, 3443,
+    -1, -1, -1, -1, 8928, -1, -1, -1, -1, 8484, -1, 443, 2068, 9139, 9179, 5249,
+    5018, -1, -1, 1696, -1, -1, -1, 4890, 6470, 8631, 1318, 8465, 9335, -1, -1, -1,
+    4836, -1, -1, -1, -1, 2891, -1, 7989, 1896, 7006, 8297, 1705, 8863, 9129, -1, 9470,
+    4047, 5510, -1, 6958, -1, 1150, 5691, 1280, 6235, -1, 8601, -1, -1, -1, -1, 2404,
+    7254, 145, 666, 6886, 8683, 3359, 8070, 9629, -1, 8310, 458, 8073, 8735, -1, 2115, 7692,
+    8051, -1, -1, -1, 6182, 6707, 7408, 1336, 1588, 6016, 8085, 1611, 2570, 6383, 6996, 5841,
+    8123, -1, -1, -1, -1, -1, -1, 5090, 4043, -1, -1, 6928, -1, 1231, 2953, 3654,
+    -1, 423, 884, 3285, 4276, 5239, 370, 5296, 491, 6047, -1, 6320, -1, -1, 4964, -1,
+    7465, 2084, 7650, 2586, 6230, -1, -1, 6064, 873, 636, 2673, 114, 4748, 8966, -1, -1,
+    -1, 7391, -1, 7526, -1, 7016, -1, 7535, 1345, 7483, -1, -1, -1, 5863, -1, -1,
+    -1, 7028, 5225, 8892, 7029, -1, -1, -1, -1, -1, -1, -1, -1, 6910, -1, -1,
+    -1, 2296, 3143, 5546, 6423, 7198, 9482, 8142, 1216, 7966, 8003, 5859, -1, -1, -1, -1,
+    -1, 412, 1669, 4490, -1, -1, -1, -1, -1, 7955, -1, 9639, 2684, -1, 3827, 5604,
+    -1, -1, 8789, -1, 7560, 1771, 6587, 8720, 9318, -1, -1, -1, 3559, 1653, 5442, 8361,
+    -1, -1, -1, 1935, -1, -1, 5002, 9263, 8774, -1, -1, -1, 3375, -1, -1, -1,
+    8187, -1, 2320, -1, -1, -1, 2361, 4136, 8088, 9412, -1, 8364, -1, -1, -1, 1119,
+    2943, 6555, 2243, 6823, 7329, 9441, 8821, 4030, 1620, 1303, 3347, 2592, 9425, 6634, 3120, 5895,
+    6375, 9451, 5175, 6315, 7744, 9041, 4185, 1448, 8281, -1, -1, 5333, 2742, 3891, 4426, 6708,
+    6340, 2276, 320, 1954, 5900, 9132, -1, 3705, -1, -1, 452, 5105, 2287, -1, -1, -1,
+    679, -1, 1350, -1, -1, -1, -1, 4539, -1, -1, -1, 1863, 7247, 311, -1, 603,
+    -1, -1, 8053, -1, 4549, -1, -1, -1, 1285, 4932, 5074, 6697, -1, 6608, 1131, 4558,
+    -1, 377, 6700, 8212, 5109, -1, 8343, -1, 8192, 5737, 8933, 1296, 1061, 3142, 6658, 3442,
+    7562, 2815, 6150, 7701, -1, 7373, 3387, -1, -1, 1230, -1, -1, 6276, -1, 6280, 2732,
+    -1, -1, 7810, 4020, 1022, -1, 8388, -1, 9171, -1, -1, 3452, -1, 1214, -1, 3189,
+    2931, 7275, -1, -1, 1785, -1, -1, -1, -1, 6166, -1, 5513, -1, -1, -1, -1,
+    -1, 8122, 9384, -1, 3115, 9474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 2440, -1, -1, 8128, 1135, 7487, 8306, -1, 4939, 8211, -1, -1, 1707, -1,
+    -1, -1, -1, 1362, -1, -1, 6876, 8904, -1, -1, -1, 521, 3807, 6402, -1, -1,
+    -1, 9177, -1, 1200, 2137, 2275, 8269, -1, -1, 5624, 1433, 6680, 7868, -1, 2949, -1,
+    4760, 2024, 5193, -1, -1, -1, 219, 3, 4680, -1, -1, 179, -1, -1, -1, 3425,
+    6135, -1, -1, 2791, -1, -1, -1, 1682, 2831, 4440, 7118, 7396, -1, -1, -1, -1,
+    -1, 1138, 8252, -1, -1, 2751, 1297, 4698, 5577, 7901, 3978, 38, 8674, 2765, 8679, 8996,
+    -1, 8138, -1, -1, -1, -1, 7484, -1, -1, 2566, 2609, -1, -1, -1, 2189, 7447,
+    1, 4971, 8437, 9164, 6656, 4891, 6522, 7651, -1, 4704, -1, -1, -1, 8169, 4500, 6264,
+    841, -1, 5368, -1, 4063, -1, -1, 41, 7549, -1, 2272, 5236, 3910, 6444, 9342, -1,
+    3323, -1, -1, 1453, 8804, -1, -1, -1, -1, -1, 1849, 5890, 9322, 1985, 3133, -1,
+    7071, 7433, -1, -1, -1, -1, 3928, 2659, 1021, 2385, 3117, 3812, 1893, 4965, 5020, 5678,
+    8515, 8538, -1, -1, 2879, -1, 451, -1, -1, 4178, 4535, -1, 9411, -1, 5922, -1,
+    -1, -1, -1, -1, 3167, -1, -1, -1, -1, -1, -1, -1, 2482, -1, -1, 116,
+    -1, -1, 2348, 2246, 8747, -1, -1, 1497, 1399, 3111, 5221, 5903, 6644, 2130, 6980, 4464,
+    7541, 3131, 3163, 5766, 2874, 8298, 8743, 8752, 8923, 3810, 9026, 9182, 9338, -1, -1, -1,
+    1098, -1, -1, -1, -1, 1452, 9264, 8271, 9016, 7637, 7411, -1, 3373, 5891, 9127, -1,
+    -1, 5444, -1, 917, 3055, -1, -1, -1, 6899, -1, -1, 3367, -1, -1, 4065, 1474,
+    9111, 1738, -1, -1, -1, -1, -1, 2269, 7516, -1, -1, -1, 2987, -1, -1, 8503,
+    8926, 3540, -1, 9671, -1, 224, 4578, -1, -1, -1, 1712, 1443, 4530, -1, 5340, 1302,
+    6170, 5552, 9428, -1, -1, -1, -1, 9180, -1, 1429, 7725, -1, -1, -1, 1082, 1498,
+    4303, 7571, 7907, 7886, 1196, 8504, 8101, 9128, 9313, -1, -1, -1, 4645, 296, 9652, -1,
+    -1, 1715, 2568, 3445, 4024, 3027, -1, 2612, 8793, -1, -1, -1, -1, 6153, -1, 6093,
+    995, 316, 8205, 2105, 8749, -1, 1117, 1036, 3042, 72, 295, 1286, 5506, 8675, 6380, 8977,
+    9327, 9189, 4639, 2884, 4029, -1, -1, 7062, -1, 732, -1, 6100, -1, -1, -1, -1,
+    6130, 745, -1, 1997, 8226, -1, -1, -1, -1, -1, 2965, 2429, 8124, 579, 6111, -1,
+    -1, -1, -1, -1, -1, -1, -1, 3325, 3828, 2042, 5275, -1, -1, -1, 1030, 6368,
+    7663, 9477, -1, -1, -1, -1, 1735, -1, 1240, -1, -1, 3815, -1, -1, 4160, -1,
+    6207, 263, 6931, 7885, 5383, 9392, 9572, 5924, 3112, 3260, 7405, 2083, 9643, 1080, 1720, 5866,
+    8076, 8867, -1, 1794, 8244, 4818, 8614, 457, 595, 1210, 5386, 9609, -1, 2574, -1, -1,
+    -1, -1, 3430, 1454, 3029, 6651, 2777, 2923, 4267, 6127, 2123, 7605, 7655, -1, 7290, -1,
+    3708, 5913, 1441, 7596, 7770, -1, -1, 8968, -1, -1, -1, 8393, -1, -1, -1, 2530,
+    -1, -1, -1, -1, 5330, 7110, 7353, -1, 1561, 5259, 8777, -1, 1522, 3180, -1, -1,
+    -1, 6962, -1, -1, 9520, 3737, -1, 1959, -1, -1, -1, 4820, -1, 2277, 866, -1,
+    30, 10, 428, 4461, 8583, -1, -1, 5775, 6544, -1, -1, 2, 2865, -1, 535, -1,
+    1745, 7880, -1, 7772, -1, -1, -1, -1, 8690, -1, 5313, 6659, 3876, -1, -1, 97,
+    3374, 4948, -1, -1, -1, 9381, -1, -1, -1, -1, -1, 1035, 4247, 5741, 8174, 7967,
+    4882, 8337, 1118, -1, 3433, -1, -1, -1, 332, 8380, -1, 528, 3130, 3384, 6098, 6786,
+    7257, -1, 4874, 5966, 8012, -1, -1, 4786, 7935, 6549, 5253, 1701, 5659, 6872, 8940, -1,
+    -1, -1, 3565, 649, -1, -1, -1, 4669, -1, -1, -1, 1805, 8067, -1, -1, 8464,
+    8408, 6367, -1, -1, -1, -1, -1, -1, 6221, -1, -1, 4842, -1, 7811, -1, 2388,
+    -1, 2303, -1, 3338, 3895, 9364, 6343, -1, -1, 791, -1, -1, 8314, -1, -1, -1,
+    161, 8095, 8293, 5234, -1, -1, -1, -1, -1, -1, -1, 4107, -1, 8541, 1435, -1,
+    -1, -1, -1, -1, 6370, 358, 1824, 3419, 3854, 8267, 8438, -1, -1, -1, -1, 2150,
+    -1, -1, -1, -1, 7156, -1, 9176, 7195, 324, 4154, -1, -1, -1, 3935, 9453, 4628,
+    1958, 2453, 3223, 4637, 1243, 4005, 5944, 6417, 6727, 2311, 5815, 333, 3840, 7376, -1, -1,
+    -1, -1, -1, -1, -1, -1, 1866, -1, 4348, -1, 4133, 5930, 8259, -1, -1, -1,
+    -1, 8828, 3070, 5039, 5469, 3451, 5474, 6473, 1192, 7490, 8013, 4985, 5780, 8719, 8915, 3650,
+    9199, -1, 1349, -1, 4189, -1, 6818, -1, -1, 9517, 1048, 7786, 1281, 790, 8922, 9676,
+    -1, 3437, -1, -1, -1, -1, 1204, 2236, 801, 5201, 5860, 2608, 7918, 2149, 8043, -1,
+    39, -1, 7177, 9445, -1, -1, -1, -1, -1, -1, -1, -1, 719, 9219, 8233, 3299,
+    -1, -1, -1, 6615, -1, 6279, 6882, -1, 748, -1, -1, 512, 5352, 8103, 8412, 1182,
+    9642, -1, 7982, -1, 7773, -1, -1, 5141, 8202, -1, 8471, -1, -1, 7045, 9647, -1,
+    -1, -1, -1, 4088, 6602, 1311, 7117, 7835, -1, 5323, 5355, 9071, -1, -1, 2437, -1,
+    3458, -1, -1, -1, -1, -1, 2655, 8975, 4737, -1, 7614, 131, 741, 6809, 6626, 8184,
+    -1, 6413, 2888, 7972, -1, -1, 8068, 9390, 1457, 8909, 8825, -1, -1, -1, -1, 9570,
+    -1, 2928, 9267, -1, 6268, 2193, -1, 4768, -1, -1, -1, -1, 4934, 9212, 8173, 2352,
+    -1, 9393, -1, 2185, 8264, 6001, 5817, 6412, 9350, 850, -1, 4534, -1, -1, -1, 9137,
+    -1, -1, 29, 5578, -1, -1, -1, 7460, -1, 5218, 2781, 5265, 1292, 7806, 8443, 8694,
+    9334, 591, 872, 1008, 3764, 3036, 3922, 5203, 2371, 6066, 6433, 8326, 9100, -1, -1, -1,
+    -1, 1344, 3681, -1, -1, 4664, -1, 5783, 7434, -1, -1, 9206, -1, -1, -1, 8155,
+    6452, -1, -1, 5156, -1, -1, 81, 163, 498, 2142, 2250, 7462, 4019, 2834, 1045, 7493,
+    8458, 4982, 5954, 4887, 5242, 3401, 2758, 7610, -1, -1, 8463, 6247, 239, -1, 4357, -1,
+    8000, -1, 7349, 6211, 8113, -1, -1, 378, 1512, 8819, -1, -1, -1, 9483, 7432, -1,
+    -1, 274, -1, -1, -1, 3569, -1, 810, 6939, 6269, 7622, 417, 7738, 5089, 5735, 7013,
+    7664, 8577, 3176, -1, -1, 1989, 3356, -1, -1, -1, -1, -1, -1, -1, 2211, -1,
+    2642, 9242, 8856, -1, 8866, -1, 1110, 2256, 5769, 7268, 6897, -1, 797, 8213, -1, -1,
+    3051, 6719, 1676, 2393, 8488, 2856, 5072, -1, -1, 2793, -1, 269, -1, 7313, -1, -1,
+    258, 1419, 1465, 5206, 750, 4839, 5424, 9500, -1, -1, -1, 235, -1, 6487, -1, -1,
+    -1, 494, 3197, -1, -1, 8263, 4364, -1, -1, 4499, 6286, 330, 6076, 990, 4025, -1,
+    7340, 8568, 1153, 1444, 4068, 2599, 5173, 5569, 4365, 5877, -1, -1, -1, -1, 2173, 1459,
+    -1, -1, 5035, -1, -1, -1, 4003, 5623, 8318, 7303, 8731, -1, -1, 6837, 1570, 3948,
+    4784, 8059, -1, 546, -1, -1, -1, 6351, 7709, -1, 7750, -1, -1, -1, -1, -1,
+    1172, 7646, -1, -1, 981, 2622, 5169, 7937, 9191, -1, 1455, -1, 1102, 1380, 7044, -1,
+    2846, 7219, 7782, -1, -1, -1, -1, -1, -1, 3780, 7660, 1634, 3641, 4006, -1, 5281,
+    7580, 9148, -1, -1, 3643, -1, -1, 4316, 7031, 1541, 1149, 7103, 8573, -1, 2752, 4317,
+    -1, -1, 9663, -1, -1, -1, 1899, 5082, 5068, -1, 6614, -1, 3402, 4253, 5022, -1,
+    -1, -1, -1, 7903, 1821, 3250, 7165, 7274, 6835, 7717, 6877, 6972, 7957, 925, 3484, 7279,
+    7360, 2525, 2913, 9065, -1, -1, 4023, -1, -1, -1, -1, -1, 4060, -1, -1, 7067,
+    9106, 6486, -1, 6816, 4046, -1, 5543, -1, 4472, 9091, 3293, 1559, 9525, 475, -1, -1,
+    -1, -1, 1273, 2906, -1, -1, 2270, 1306, 8312, -1, -1, 194, 5540, 7573, -1, 9449,
+    4588, -1, -1, -1, 2085, -1, -1, -1, -1, -1, 7168, 7406, -1, 472, 1403, 997,
+    5522, 7876, 8589, 5065, 9011, -1, -1, -1, -1, 2027, 734, -1, 4716, 1158, 2377, 7428,
+    -1, -1, -1, 575, 9150, -1, -1, -1, 301, 5362, 8008, 4225, 6540, -1, 2741, 7500,
+    -1, 6575, 2065, -1, 624, 7380, 4156, 4701, 5575, 8421, -1, 8496, -1, 5268, -1, -1,
+    -1, 6203, 6312, 6141, 1741, 597, -1, -1, -1, 8075, 8543, -1, 9047, -1, 1781, 2536,
+    3576, 6004, 8046, 6844, 830, 999, 7499, 1767, 7638, 8086, 9078, 7851, 6087, 6935, 6619, -1,
+    -1, 1090, -1, -1, 5468, -1, -1, -1, -1, 9097, -1, 5026, 2920, 6146, 3617, 7969,
+    6988, -1, -1, -1, -1, -1, 6389, 426, -1, -1, 3459, 8060, 1134, 1224, -1, 4001,
+    6466, -1, -1, 3037, -1, 1333, 1383, 2885, 7, 483, 6776, 7978, 8711, -1, 8030, 3470,
+    602, 1843, 7565, -1, -1, -1, -1, -1, 6560, 3899, -1, 6385, -1, 3229, -1, -1,
+    3212, -1, 9478, 28, -1, -1, -1, -1, -1, 368, 1104, 2431, -1, -1, -1, -1,
+    -1, -1, -1, 4731, 5831, 3355, 7996, 1827, -1, -1, -1, 2604, 4749, -1, 1361, 7958,
+    7234, 8132, -1, -1, 2044, 6275, 1914, 3747, 9413, 5782, -1, 5576, -1, 942, 226, -1,
+    6918, 9181, 392, 9184, 4076, 4411, 1064, 6797, 8120, -1, 5200, 3097, 694, 3065, 8251, 8148,
+    3060, 8686, 9504, -1, -1, -1, 252, 5820, -1, -1, 2283, 8879, -1, 8786, -1, 5682,
+    7159, -1, -1, -1, 3053, 7897, 1586, 6387, 6051, 644, 3846, 4780, 5640, 4608, 7498, -1,
+    8767, -1, -1, 5570, -1, -1, 553, 8668, 1917, 3940, 2993, 5044, -1, 9565, 4142, 9569,
+    -1, -1, -1, 3327, -1, 1650, -1, 504, 2079, 8629, -1, 683, 8803, -1, -1, 1113,
+    -1, -1, -1, 1515, 1295, -1, -1, -1, 9427, -1, 7330, 1500, 8424, -1, 6929, 1445,
+    574, 3624, 4341, 9225, 2282, -1, -1, 1624, -1, 3934, 6024, -1, 6647, 8026, -1, 5767,
+    5797, -1, -1, 4096, 3532, 2624, -1, -1, -1, -1, 634, 1536, 2072, 5828, -1, 1159,
+    5021, -1, 6455, -1, -1, -1, -1, 7815, 1724, 4793, 6181, 5662, -1, 4196, -1, -1,
+    -1, 3476, -1, -1, 2390, -1, 1317, 4305, 8255, 2164, 6142, 1227, -1, -1, -1, 5892,
+    1921, 4224, 6951, 2576, 8369, 4266, 3457, 4912, -1, -1, 773, 1945, 3985, -1, -1, -1,
+    -1, -1, -1, 4008, -1, 1829, 5698, 6792, 6817, 5178, 6906, 2436, 5145, -1, 1125, -1,
+    -1, -1, 2505, -1, 4544, 1764, 4928, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    2722, 3680, 6908, -1, 519, -1, 4169, -1, -1, -1, 5151, -1, 6676, 7948, 992, -1,
+    -1, 1315, -1, 6542, 5369, 5580, 742, 1904, 6363, 8811, 1714, 2479, 111, 9246, 9288, -1,
+    -1, 4947, 1242, 4571, -1, 2708, -1, 674, 5910, 6511, 7508, 4422, -1, 8637, -1, -1,
+    -1, 5195, 7122, -1, 109, 3957, 3983, 7544, -1, -1, 9098, -1, -1, -1, -1, 4816,
+    6287, 6649, 2408, 3580, 6794, 9527, 6600, 682, 9268, -1, -1, 4791, 6012, 4478, -1, 5851,
+    -1, -1, -1, -1, -1, 2354, 7173, -1, -1, 4871, -1, -1, 4371, 7088, 9227, -1,
+    3652, 3601, 3856, 6338, 7158, 4568, 3246, 5361, 2991, 7341, 8328, -1, -1, -1, -1, -1,
+    593, 4829, -1, -1, 4296, -1, 3666, 4709, -1, 7043, -1, 9, 1328, 3517, 260, 7752,
+    -1, -1, 3017, 1417, 1968, 654, 2983, -1, -1, -1, 6416, -1, -1, -1, 2387, 4439,
+    7632, -1, -1, -1, -1, -1, 379, 4727, 8882, 1941, 1197, 5739, 2925, 6414, 6775, 3730,
+    6926, 7295, 9022, 514, -1, 1129, 3413, 2761, -1, -1, 308, 7559, 8565, -1, -1, -1,
+    5648, -1, 1268, 2643, 5277, -1, -1, 2698, 2724, 3363, 2172, 5428, 6418, -1, 3432, -1,
+    -1, -1, 5880, 5934, 8158, -1, -1, 5413, -1, -1, -1, 7774, -1, -1, -1, 700,
+    -1, 318, 5809, 6443, 2120, -1, 8862, 9027, 6546, -1, -1, -1, -1, -1, 1377, 7293,
+    -1, 9157, 7923, -1, 8020, -1, -1, -1, -1, -1, 5258, -1, -1, -1, 1088, -1,
+    2224, -1, 7008, -1, 2401, -1, 903, 6915, 3088, 552, 4470, 6000, 8090, -1, -1, 5465,
+    -1, -1, -1, -1, -1, -1, -1, -1, 277, 5588, 7677, -1, -1, 581, 3000, -1,
+    -1, 6937, 5791, -1, -1, 6131, -1, 2253, -1, 2434, 1372, 7416, 262, 157, 3164, 1043,
+    2819, 5248, 2310, 3630, 9574, -1, 1438, -1, 7153, 7584, 3628, 3022, 8653, 8868, 394, 4195,
+    -1, 6878, -1, -1, -1, -1, -1, 5778, 3468, -1, -1, 7073, 3369, 3407, 6884, 7214,
+    -1, 507, 2988, 9345, -1, -1, 3179, 3159, -1, 7003, -1, -1, 9130, -1, -1, -1,
+    7191, 8431, -1, 1039, 4284, 5244, 1469, 8112, 1711, 8398, 8753, 9194, 1123, 1343, 9287, -1,
+    -1, 7318, 1809, 4459, -1, -1, 6623, 6095, -1, -1, -1, -1, -1, 7716, 2074, 75,
+    -1, -1, -1, 689, 2341, 2801, 5665, 14, 5738, -1, -1, -1, 5784, -1, -1, 1456,
+    3235, 6723, -1, 3032, 3712, -1, 8830, 1235, -1, 2656, 9377, -1, 3926, 5912, 3304, -1,
+    1754, -1, -1, -1, 3649, 143, 5327, -1, -1, -1, 8916, -1, -1, 350, 3509, -1,
+    8691, 162, 8200, 4561, -1, -1, -1, 6652, -1, 8451, 5325, -1, -1, 987, 2460, 106,
+    2768, 5675, 7545, -1, 4974, 8034, -1, -1, -1, -1, 853, 3529, 5363, 1175, 6205, 7351,
+    7379, -1, 4826, 7915, 7332, 8617, -1, 2231, 8841, 6243, -1, -1, 3116, 9089, -1, 6254,
+    8063, -1, -1, -1, -1, -1, -1, 1903, 9074, 9552, -1, -1, 4958, 5344, 5548, 9080,
+    -1, 8824, -1, 4036, -1, -1, -1, -1, 2033, 2286, 5723, 5746, 7256, -1, -1, 2989,
+    -1, 4339, 5037, 3155, -1, 6856, -1, 8665, -1, 3258, 5932, 7393, -1, -1, -1, 6329,
+    -1, 5864, 19, 4418, -1, -1, 3096, -1, 1789, 4833, -1, 2369, 3024, 5605, 104, -1,
+    -1, -1, -1, 8818, -1, -1, 7240, 5138, 6501, -1, 136, 1218, 8927, -1, -1, -1,
+    -1, -1, 4646, 780, -1, -1, 7204, 2786, -1, -1, -1, -1, -1, -1, -1, 2379,
+    4877, 4556, 7636, 5241, 8954, 9152, 9689, -1, -1, 2545, 3056, 8934, -1, 1579, 6703, 8874,
+    5772, 664, 5893, 2057, 6531, 9096, 2096, 6736, 6739, 5432, 6295, -1, 6165, -1, -1, 7823,
+    3178, -1, -1, -1, -1, 1677, 650, 1758, 1953, 7839, 5956, 7603, 499, 4125, 7704, 8610,
+    2854, 7861, 9222, 9688, 303, 1773, 3756, 6331, -1, -1, -1, 3767, -1, 278, 391, -1,
+    -1, -1, 1577, 1625, 6850, -1, -1, -1, 3181, -1, -1, 1926, -1, -1, -1, -1,
+    -1, -1, -1, 455, -1, -1, 5033, -1, 1897, 911, 4139, 4099, 7050, 845, 8905, 1963,
+};
+static const int TLDHashTblSize = 16384;
+
+// must match tldhash() in scripts/gentld.py
+static inline uint tldHash(const char *data, int length)
+{
+    uint result = 2166136261u;
+    for (int i = 0; i < length; i++) {
+        result ^= uchar(data[i]);
+        result *= 16777619u;
+    }
+    return result;
+}
+
+static inline bool containsTLDEntry(const char *entry, int length)
 {
-    for (qint16 i = 0; i < TLDTblSize; i++) {
-        if (entry == QString::fromUtf8(TLDTbl[i]))
+    int slot = (tldHash(entry, length) & (TLDHashTblSize - 1));
+    while (TLDHashTbl[slot] != -1) {
+        const char *tld = TLDTbl[TLDHashTbl[slot]];
+        if (::memcmp(tld, entry, length) == 0 && tld[length] == '\0') {
             return true;
+        }
+        slot = ((slot + 1) & (TLDHashTblSize - 1));
+    }
+    return false;
+}
+
+// encodes domain as UTF-8 after the prefix character (if any), returns the encoded length or -1
+// if it is longer than any table entry
+static inline int tldEncode(char *buffer, char prefix, const QChar *domain, int length)
+{
+    int pos = 0;
+    if (prefix) {
+        buffer[pos++] = prefix;
+    }
+    for (int i = 0; i < length; i++) {
+        if (Q_UNLIKELY(pos > TLDMaxLength)) {
+            return -1;
+        }
+        uint ucs = domain[i].unicode();
+        if (ucs < 0x80) {
+            buffer[pos++] = char(ucs);
+        } else if (ucs < 0x800) {
+            buffer[pos++] = char(0xC0 | (ucs >> 6));
+            buffer[pos++] = char(0x80 | (ucs & 0x3F));
+        } else {
+            if (QChar::isHighSurrogate(ucs) && (i + 1) < length && domain[i + 1].isLowSurrogate()) {
+                ucs = QChar::surrogateToUcs4(ushort(ucs), domain[++i].unicode());
+                buffer[pos++] = char(0xF0 | (ucs >> 18));
+                buffer[pos++] = char(0x80 | ((ucs >> 12) & 0x3F));
+            } else {
+                buffer[pos++] = char(0xE0 | (ucs >> 12));
+            }
+            buffer[pos++] = char(0x80 | ((ucs >> 6) & 0x3F));
+            buffer[pos++] = char(0x80 | (ucs & 0x3F));
+        }
+    }
+    return (pos > TLDMaxLength ? -1 : pos);
+}
+
+static bool isEffectiveTLD(const QChar *domain, int length)
+{
+    QSTACKARRAY(char, buffer, TLDMaxLength + 8);
+
+    // for domain 'foo.bar.com':
+    // 1. return if TLD table contains 'foo.bar.com'
+    int encoded = tldEncode(buffer, '\0', domain, length);
+    if (encoded != -1 && containsTLDEntry(buffer, encoded))
+        return true;
+
+    int dotindex = -1;
+    for (int i = 0; i < length; i++) {
+        if (domain[i] == QLatin1Char('.')) {
+            dotindex = i;
+            break;
+        }
+    }
+    if (dotindex > 0) {
+        // 2. if table contains '*.bar.com',
+        // test if table contains '!foo.bar.com'
+        encoded = tldEncode(buffer, '*', domain + dotindex, length - dotindex);
+        if (encoded != -1 && containsTLDEntry(buffer, encoded)) {
+            encoded = tldEncode(buffer, '!', domain, length);
+            return (encoded == -1 || !containsTLDEntry(buffer, encoded));
+        }
     }
     return false;
 }
@@ -9746,13 +10853,15 @@ Q_CORE_EXPORT QString qTopLevelDomain(const QString &domain)
     if (sections.isEmpty())
         return QString();
 
-    QString level, tld;
-    for (int j = sections.count() - 1; j >= 0; --j) {
-        level.prepend(QLatin1Char('.') + sections.at(j));
-        if (qIsEffectiveTLD(level.right(level.size() - 1)))
-            tld = level;
+    // the longest suffix that is an effective TLD wins
+    const QString level = QLatin1Char('.') + sections.join(QLatin1String("."));
+    const QChar *data = level.constData();
+    int tld = -1;
+    for (int i = level.size() - 1; i >= 0; --i) {
+        if (data[i] == QLatin1Char('.') && isEffectiveTLD(data + i + 1, level.size() - i - 1))
+            tld = i;
     }
-    return tld;
+    return (tld == -1 ? QString() : level.mid(tld));
 }
 
 /*!
@@ -9763,29 +10872,7 @@ Q_CORE_EXPORT QString qTopLevelDomain(const QString &domain)
 
 Q_CORE_EXPORT bool qIsEffectiveTLD(const QString &domain)
 {
-    // for domain 'foo.bar.com':
-    // 1. return if TLD table contains 'foo.bar.com'
-    if (containsTLDEntry(domain))
-        return true;
-
-    const int dotindex = domain.indexOf(QLatin1Char('.'));
-    if (dotindex > 0) {
-        const int count = (domain.size() - dotindex);
-        QString wildCardDomain;
-        wildCardDomain.reserve(count + 1);
-        wildCardDomain.append(QLatin1Char('*'));
-        wildCardDomain.append(domain.right(count));
-        // 2. if table contains '*.bar.com',
-        // test if table contains '!foo.bar.com'
-        if (containsTLDEntry(wildCardDomain)) {
-            QString exceptionDomain;
-            exceptionDomain.reserve(domain.size() + 1);
-            exceptionDomain.append(QLatin1Char('!'));
-            exceptionDomain.append(domain);
-            return (! containsTLDEntry(exceptionDomain));
-        }
-    }
-    return false;
+    return isEffectiveTLD(domain.constData(), domain.size());
 }
 
 QT_END_NAMESPACE
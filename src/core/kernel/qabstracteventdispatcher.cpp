@@ -26,47 +26,55 @@
 #include "qthread_p.h"
 #include "qcoreapplication_p.h"
 
-#include <bitset>
+#include <vector>
+#include <queue>
 #include <mutex>
 
 QT_BEGIN_NAMESPACE
 
-// 2048 pre-allocated should be more than enough for application, IDs rearely go beyond single
-// digit. could implement fallback to int-sized set if limit is reached
-enum { QTimerMax = 2048 };
-
-class QTimersSet : private std::bitset<QTimerMax>
+// IDs rarely go beyond single digit but there can be tens of thousands of timers, the set grows
+// as needed and released IDs are reused lowest first
+class QTimersSet
 {
 public:
     bool isSet(const int bit) const;
     void unsetBit(const int bit);
     int getBit();
 private:
-    std::mutex m_mutex;
+    std::vector<bool> m_bits;
+    std::priority_queue<int, std::vector<int>, std::greater<int> > m_free;
+    mutable std::mutex m_mutex;
 };
 
 bool QTimersSet::isSet(const int bit) const
 {
-    return this->test(bit);
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return (bit > 0 && size_t(bit) < m_bits.size() && m_bits[bit]);
 }
 
 void QTimersSet::unsetBit(const int bit)
 {
     std::lock_guard<std::mutex> locker(m_mutex);
-    this->set(bit, false);
+    m_bits[bit] = false;
+    m_free.push(bit);
 }
 
 int QTimersSet::getBit()
 {
     std::lock_guard<std::mutex> locker(m_mutex);
-    // 0 is invalid timer ID
-    for (qint16 i = 1; i < QTimerMax; i++) {
-        if (!this->test(i)) {
-            this->set(i, true);
-            return i;
-        }
+    if (!m_free.empty()) {
+        const int bit = m_free.top();
+        m_free.pop();
+        m_bits[bit] = true;
+        return bit;
     }
-    return 0;
+    // 0 is invalid timer ID
+    if (m_bits.empty())
+        m_bits.push_back(false);
+    if (Q_UNLIKELY(m_bits.size() >= size_t(INT_MAX)))
+        return 0;
+    m_bits.push_back(true);
+    return (m_bits.size() - 1);
 }
 
 static QTimersSet timerIds;
@@ -91,7 +99,7 @@ int QAbstractEventDispatcherPrivate::allocateTimerId()
     return id;
 }
 
-// Releasing a timer ID requires only a bit flip to mark it as unused
+// Released timer IDs are handed out again by allocateTimerId()
 void QAbstractEventDispatcherPrivate::releaseTimerId(int timerId)
 {
     Q_ASSERT_X(timerIds.isSet(timerId), "QAbstractEventDispatcher::releaseTimerId",
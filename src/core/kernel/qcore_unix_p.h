@@ -42,6 +42,7 @@
 #include <poll.h>
 #include <string.h>
 #include <sys/wait.h>
+#include <sys/uio.h>
 #include <errno.h>
 #include <signal.h>
 
@@ -49,6 +50,10 @@
 #  include <sys/file.h>
 #endif
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+#  include <sys/epoll.h>
+#endif
+
 #define Q_EINTR_LOOP(var, cmd)                                \
     do {                                                      \
         var = cmd;                                            \
@@ -264,6 +269,14 @@ static inline qint64 qt_safe_write_nosignal(int fd, const void *data, qint64 len
     return qt_safe_write(fd, data, len);
 }
 
+// don't call ::writev, call qt_safe_writev
+static inline qint64 qt_safe_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    qint64 ret = 0;
+    Q_EINTR_LOOP(ret, ::writev(fd, iov, iovcnt));
+    return ret;
+}
+
 // don't call QT_CREAT or ::creat, call qt_safe_creat
 static inline int qt_safe_creat(const char* path, mode_t flags)
 {
@@ -331,6 +344,12 @@ timeval qt_gettime(); // in qelapsedtimer_unix.cpp
 Q_CORE_EXPORT int qt_safe_select(int nfds, fd_set *fdread, fd_set *fdwrite, fd_set *fdexcept,
                                  const struct timeval *tv);
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+// don't call ::epoll_wait, call qt_safe_epoll_wait
+Q_CORE_EXPORT int qt_safe_epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+                                     const struct timeval *tv);
+#endif
+
 /*
    Returns the difference between msecs and elapsed. If msecs is -1,
    however, -1 is returned.
@@ -47,6 +47,7 @@
 
 #include <stdlib.h>
 #include <errno.h>
+#include <mutex>
 
 QT_BEGIN_NAMESPACE
 
@@ -103,6 +104,8 @@ void Q_CORE_EXPORT qt_call_post_routines()
 Q_AUTOTEST_EXPORT uint qGlobalPostedEventsCount()
 {
     QThreadData *currentThreadData = QThreadData::current();
+    QMutexLocker locker(&currentThreadData->postEventList.mutex);
+    currentThreadData->flushPostEventQueue();
     return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
 }
 
@@ -140,6 +143,7 @@ QCoreApplicationPrivate::~QCoreApplicationPrivate()
     if (threadData) {
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         QMutexLocker locker(&threadData->postEventList.mutex);
+        threadData->flushPostEventQueue();
         for (int i = 0; i < threadData->postEventList.size(); ++i) {
             const QPostEvent &pe = threadData->postEventList.at(i);
             if (pe.event) {
@@ -798,6 +802,27 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // events which are neither sorted nor compressed bypass the mutex, a
+    // lot of threads emitting queued signals to the same one do not contend
+    if (priority == Qt::NormalEventPriority
+        && event->type() != QEvent::DeferredDelete
+        && event->type() != QEvent::Quit) {
+        event->posted = true;
+        data->postEventList.enqueueEvent(new QPostEventNode(QPostEvent(receiver, event, priority)));
+
+        if (Q_UNLIKELY(data != *pdata)) {
+            // the object has moved to another thread meanwhile and the event
+            // may have missed the move, flushing passes it on
+            QMutexLocker locker(&data->postEventList.mutex);
+            data->flushPostEventQueue();
+            return;
+        }
+
+        if (data->eventDispatcher)
+            data->eventDispatcher->wakeUp();
+        return;
+    }
+
     // lock the post event mutex
     data->postEventList.mutex.lock();
 
@@ -817,6 +842,9 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
 
     QMutexUnlocker locker(&data->postEventList.mutex);
 
+    // events posted before without the mutex go first
+    data->flushPostEventQueue();
+
     // if this is one of the compressible events, do compression
     if (receiver->d_func()->postedEvents
         && self && self->compressEvent(event, receiver, &data->postEventList)) {
@@ -914,6 +942,8 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
 
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->flushPostEventQueue();
+
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
     // events, canWait will be set to false.
@@ -991,6 +1021,10 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
         // function depends on.
     }
 
+    // events posted while sending are delivered on the next round
+    if (data->postEventList.hasQueuedEvents())
+        data->canWait = false;
+
     --data->postEventList.recursion;
     if (!data->postEventList.recursion && !data->canWait && data->eventDispatcher)
         data->eventDispatcher->wakeUp();
@@ -1047,6 +1081,8 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
     QThreadData *data = receiver ? receiver->d_func()->threadData : QThreadData::current();
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->flushPostEventQueue();
+
     // the QObject destructor calls this function directly.  this can
     // happen while the event loop is in the middle of posting events,
     // and when we get here, we may not have any more posted events
@@ -1112,6 +1148,8 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
 
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->flushPostEventQueue();
+
     if (data->postEventList.size() == 0) {
 #ifndef QT_NO_DEBUG
         qDebug("QCoreApplication::removePostedEvent: Internal error: %p %d is posted",
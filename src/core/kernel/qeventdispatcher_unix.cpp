@@ -44,8 +44,20 @@ static const long maxOpenFiles = sysconf(_SC_OPEN_MAX);
 
 static const char *sockTypeString[] = { "Read", "Write", "Exception" };
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+// maximum number of ready fds handled per wait, the rest are reported by the
+// next wait since the epoll set is level-triggered
+static const int maxEpollEvents = 256;
+
+static const uint epollTypeEvents[] = { EPOLLIN, EPOLLOUT, EPOLLPRI };
+#endif
+
 QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
     : sn_highest(-1),
+#ifdef QT_HAVE_EPOLL_CREATE1
+    epoll_fd(-1),
+    sn_epoll_alwaysready(0),
+#endif
     interrupt(false)
 {
     // initialize the common parts of the event loop
@@ -53,6 +65,28 @@ QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
         perror("QEventDispatcherUNIXPrivate(): Unable to create thread pipe");
         qFatal("QEventDispatcherUNIXPrivate(): Can not continue without a thread pipe");
     }
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    // select() is used as fallback if epoll is not usable or not wanted
+    static const bool noepoll = !qgetenv("QT_NO_EPOLL").isNull();
+    if (!noepoll) {
+        epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (Q_UNLIKELY(epoll_fd == -1)) {
+            perror("QEventDispatcherUNIXPrivate(): Unable to create epoll instance");
+            return;
+        }
+
+        struct epoll_event ev;
+        ::memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = thread_pipe[0];
+        if (Q_UNLIKELY(::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, thread_pipe[0], &ev) == -1)) {
+            perror("QEventDispatcherUNIXPrivate(): Unable to watch thread pipe");
+            qt_safe_close(epoll_fd);
+            epoll_fd = -1;
+        }
+    }
+#endif
 }
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
@@ -61,14 +95,30 @@ QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
     qt_safe_close(thread_pipe[0]);
     qt_safe_close(thread_pipe[1]);
 
-    // cleanup timers
-    qDeleteAll(timerList);
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1)
+        qt_safe_close(epoll_fd);
+
+    // cleanup socket notifiers
+    QFlatHash<int, QSockNotEpoll*>::const_iterator it = sn_epoll.constBegin();
+    for (; it != sn_epoll.constEnd(); ++it) {
+        QSockNotEpoll *sne = it.value();
+        for (int type = 0; type < 3; type++)
+            delete sne->sn[type];
+        delete sne;
+    }
+#endif
 }
 
 int QEventDispatcherUNIXPrivate::doSelect(QEventLoop::ProcessEventsFlags flags, timeval *timeout)
 {
     Q_Q(QEventDispatcherUNIX);
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1)
+        return doEpoll(flags, timeout);
+#endif
+
     // needed in QEventDispatcherUNIX::select()
     timerList.updateCurrentTime();
 
@@ -140,38 +190,226 @@ int QEventDispatcherUNIXPrivate::doSelect(QEventLoop::ProcessEventsFlags flags,
     return (nevents + q->activateSocketNotifiers());
 }
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+int QEventDispatcherUNIXPrivate::doEpoll(QEventLoop::ProcessEventsFlags flags, timeval *timeout)
+{
+    Q_Q(QEventDispatcherUNIX);
+
+    int nevents = 0;
+    if (flags & QEventLoop::ExcludeSocketNotifiers) {
+        // socket notifiers stay in the level-triggered epoll set, waiting on it
+        // would return immediately for any of them that is ready so wait only
+        // for the fds that wake up the event loop
+        const int nfds = wakeup_fds.size() + 1;
+        QSTACKARRAY(struct pollfd, fds, nfds);
+        fds[0].fd = thread_pipe[0];
+        fds[0].events = POLLIN;
+        for (int i = 1; i < nfds; i++) {
+            fds[i].fd = wakeup_fds.at(i - 1);
+            fds[i].events = POLLIN;
+        }
+
+        int msecs = -1;
+        if (timeout)
+            msecs = (timeout->tv_sec * 1000) + ((timeout->tv_usec + 999) / 1000);
+
+        int nsel;
+        Q_EINTR_LOOP(nsel, ::poll(fds, nfds, msecs));
+        if (nsel == -1) {
+            perror("poll");
+        } else if (nsel > 0 && (fds[0].revents & POLLIN)) {
+            consumeThreadWakeUp();
+            nevents++;
+        }
+        return (nevents + q->activateSocketNotifiers());
+    }
+
+    timeval notimeout = { 0l, 0l };
+    if (sn_epoll_alwaysready > 0) {
+        // there are notifiers which are ready no matter what
+        QFlatHash<int, QSockNotEpoll*>::const_iterator it = sn_epoll.constBegin();
+        for (; it != sn_epoll.constEnd(); ++it) {
+            QSockNotEpoll *sne = it.value();
+            if (!sne->alwaysready)
+                continue;
+            for (int type = 0; type < 3; type++) {
+                QSockNot *sn = sne->sn[type];
+                if (sn && !sn->pending) {
+                    sn->pending = true;
+                    sn_pending_list.append(sn);
+                }
+            }
+        }
+        timeout = &notimeout;
+    }
+
+    QSTACKARRAY(struct epoll_event, events, maxEpollEvents);
+    const int nsel = qt_safe_epoll_wait(epoll_fd, events, maxEpollEvents, timeout);
+    if (nsel == -1) {
+        // EBADF/EINVAL on the epoll fd itself... shouldn't happen, so let's
+        // complain to stderr and hope someone sends us a bug report
+        perror("epoll_wait");
+    }
+
+    for (int i = 0; i < nsel; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == thread_pipe[0]) {
+            consumeThreadWakeUp();
+            nevents++;
+            continue;
+        }
+
+        QSockNotEpoll *sne = sn_epoll.value(fd);
+        if (!sne) {
+            // one of the wake up fds, nothing to activate
+            continue;
+        }
+
+        // same conditions under which select() reports the fd as ready
+        const uint revents = events[i].events;
+        QSockNot *ready[3] = {
+            (revents & (EPOLLIN | EPOLLHUP | EPOLLERR)) ? sne->sn[0] : nullptr,
+            (revents & (EPOLLOUT | EPOLLERR)) ? sne->sn[1] : nullptr,
+            (revents & EPOLLPRI) ? sne->sn[2] : nullptr
+        };
+        for (int type = 0; type < 3; type++) {
+            QSockNot *sn = ready[type];
+            if (sn && !sn->pending) {
+                sn->pending = true;
+                sn_pending_list.append(sn);
+            }
+        }
+    }
+
+    return (nevents + q->activateSocketNotifiers());
+}
+
+bool QEventDispatcherUNIXPrivate::epollUpdate(int fd, QSockNotEpoll *sne)
+{
+    uint events = 0;
+    for (int type = 0; type < 3; type++) {
+        if (sne->sn[type])
+            events |= epollTypeEvents[type];
+    }
+    if (events == sne->events)
+        return true;
+
+    struct epoll_event ev;
+    ::memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.fd = fd;
+
+    if (sne->alwaysready) {
+        // not in the epoll set, nothing to update
+        sne->events = events;
+        if (events == 0) {
+            sne->alwaysready = false;
+            sn_epoll_alwaysready--;
+        }
+        return true;
+    }
+
+    int ret = 0;
+    if (events == 0) {
+        // the fd may have been closed already in which case the kernel has
+        // removed it from the set on its own
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, &ev);
+    } else if (sne->events == 0) {
+        ret = ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+        if (ret == -1 && errno == EPERM) {
+            // regular files and directories can not be polled, select()
+            // reports them as always ready so do the same
+            sne->alwaysready = true;
+            sn_epoll_alwaysready++;
+            ret = 0;
+        }
+    } else {
+        ret = ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &ev);
+        if (ret == -1 && errno == ENOENT) {
+            // the fd was closed and reused without unregistering the notifiers
+            ret = ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+        }
+    }
+    if (ret == -1)
+        return false;
+    sne->events = events;
+    return true;
+}
+#endif // QT_HAVE_EPOLL_CREATE1
+
 int QEventDispatcherUNIXPrivate::initThreadWakeUp()
 {
     FD_SET(thread_pipe[0], &sn_vec[0].select_fds);
-    return thread_pipe[0];
+    int highest = thread_pipe[0];
+    for (int i = 0; i < wakeup_fds.size(); i++) {
+        const int fd = wakeup_fds.at(i);
+        FD_SET(fd, &sn_vec[0].select_fds);
+        highest = qMax(highest, fd);
+    }
+    return highest;
 }
 
 int QEventDispatcherUNIXPrivate::processThreadWakeUp(int nsel)
 {
     if (nsel > 0 && FD_ISSET(thread_pipe[0], &sn_vec[0].select_fds)) {
-        // some other thread woke us up... consume the data on the thread pipe so that
-        // select doesn't immediately return next time
-        QSTACKARRAY(char, c, 16);
-        while (qt_safe_read(thread_pipe[0], c, sizeof(c)) > 0)
-            ;
-
-        if (!wakeUps.testAndSetRelease(1, 0)) {
-            // hopefully, this is dead code
-            qWarning("QEventDispatcherUNIX: internal error, wakeUps.testAndSetRelease(1, 0) failed!");
-        }
+        consumeThreadWakeUp();
         return 1;
     }
     return 0;
 }
 
+void QEventDispatcherUNIXPrivate::consumeThreadWakeUp()
+{
+    // some other thread woke us up... consume the data on the thread pipe so that
+    // select doesn't immediately return next time
+    QSTACKARRAY(char, c, 16);
+    while (qt_safe_read(thread_pipe[0], c, sizeof(c)) > 0)
+        ;
+
+    if (!wakeUps.testAndSetRelease(1, 0)) {
+        // hopefully, this is dead code
+        qWarning("QEventDispatcherUNIX: internal error, wakeUps.testAndSetRelease(1, 0) failed!");
+    }
+}
+
+void QEventDispatcherUNIXPrivate::registerWakeUpFd(int fd)
+{
+    Q_ASSERT(fd >= 0);
+    if (wakeup_fds.contains(fd))
+        return;
+    wakeup_fds.append(fd);
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1) {
+        struct epoll_event ev;
+        ::memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (Q_UNLIKELY(::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1))
+            perror("QEventDispatcherUNIXPrivate::registerWakeUpFd");
+    }
+#endif
+}
+
 /*
  * Internal functions for manipulating timer data structures.  The
  * timerBitVec array is used for keeping track of timer identifiers.
  */
 
+// number of children per node in the timer heap, the heap is shallow and its
+// children share cache lines
+static const int timerHeapArity = 4;
+
+static inline bool timerLessThan(const QTimerInfo *t1, const QTimerInfo *t2)
+{
+    if (t1->timeout == t2->timeout)
+        return t1->serial < t2->serial;
+    return t1->timeout < t2->timeout;
+}
+
 QTimerInfoList::QTimerInfoList()
-    : QList<QTimerInfo*>(),
-    firstTimerInfo(nullptr)
+    : firstTimerInfo(nullptr),
+    nextSerial(0)
 {
     if (Q_LIKELY(QElapsedTimer::isMonotonic())) {
         // detected monotonic timers
@@ -191,6 +429,11 @@ QTimerInfoList::QTimerInfoList()
     }
 }
 
+QTimerInfoList::~QTimerInfoList()
+{
+    qDeleteAll(heap);
+}
+
 timeval QTimerInfoList::updateCurrentTime()
 {
     currentTime = qt_gettime();
@@ -254,18 +497,102 @@ void QTimerInfoList::repairTimersIfNeeded()
         timerRepair(delta);
 }
 
+void QTimerInfoList::siftUp(int index)
+{
+    QTimerInfo *t = heap.at(index);
+    while (index > 0) {
+        const int parent = (index - 1) / timerHeapArity;
+        QTimerInfo *p = heap.at(parent);
+        if (!timerLessThan(t, p))
+            break;
+        heap[index] = p;
+        p->heapIndex = index;
+        index = parent;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
+void QTimerInfoList::siftDown(int index)
+{
+    const int count = heap.size();
+    QTimerInfo *t = heap.at(index);
+    forever {
+        const int firstChild = (index * timerHeapArity) + 1;
+        if (firstChild >= count)
+            break;
+        const int lastChild = qMin(firstChild + timerHeapArity, count);
+        int smallest = firstChild;
+        for (int i = firstChild + 1; i < lastChild; i++) {
+            if (timerLessThan(heap.at(i), heap.at(smallest)))
+                smallest = i;
+        }
+        QTimerInfo *c = heap.at(smallest);
+        if (!timerLessThan(c, t))
+            break;
+        heap[index] = c;
+        c->heapIndex = index;
+        index = smallest;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
 /*
-  insert timer info into list
+  insert timer info into heap, timers with the same timeout are sent in the
+  order they were inserted
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
-    int index = size();
-    while (index--) {
-        const QTimerInfo * const t = at(index);
-        if (!(ti->timeout < t->timeout))
-            break;
+    ti->serial = nextSerial++;
+    heap.append(ti);
+    siftUp(heap.size() - 1);
+}
+
+/*
+  remove timer info from heap
+*/
+void QTimerInfoList::timerRemove(QTimerInfo *ti)
+{
+    const int index = ti->heapIndex;
+    QTimerInfo *last = heap.last();
+    heap.pop_back();
+    if (last != ti) {
+        heap[index] = last;
+        last->heapIndex = index;
+        siftUp(index);
+        siftDown(last->heapIndex);
+    }
+}
+
+/*
+  remove timer info from all indexes and delete it
+*/
+void QTimerInfoList::timerDelete(QTimerInfo *t)
+{
+    timerRemove(t);
+    timers.remove(t->id);
+
+    if (t->objPrev) {
+        t->objPrev->objNext = t->objNext;
+    } else if (t->objNext) {
+        objectTimers.insert(t->obj, t->objNext);
+    } else {
+        objectTimers.remove(t->obj);
     }
-    insert(index+1, ti);
+    if (t->objNext)
+        t->objNext->objPrev = t->objPrev;
+
+    if (t == firstTimerInfo)
+        firstTimerInfo = nullptr;
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+
+    // release the timer id
+    if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
+        QAbstractEventDispatcherPrivate::releaseTimerId(t->id);
+
+    delete t;
 }
 
 /*
@@ -273,9 +600,9 @@ void QTimerInfoList::timerInsert(QTimerInfo *ti)
 */
 void QTimerInfoList::timerRepair(const timeval &diff)
 {
-    // repair all timers
-    for (int i = 0; i < size(); ++i) {
-        QTimerInfo *t = at(i);
+    // repair all timers, shifting all of them keeps the heap ordered
+    for (int i = 0; i < heap.size(); ++i) {
+        QTimerInfo *t = heap.at(i);
         t->timeout = t->timeout + diff;
     }
 }
@@ -289,12 +616,31 @@ bool QTimerInfoList::timerWait(timeval &tm)
     timeval currentTime = updateCurrentTime();
     repairTimersIfNeeded();
 
-    // Find first waiting timer not already active
+    if (heap.isEmpty())
+        return false;
+
+    // Find first waiting timer not already active, only timers that are
+    // being activated (and their children) have to be looked past
     QTimerInfo *t = nullptr;
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (!(*it)->activateRef) {
-            t = *it;
-            break;
+    if (!first()->activateRef) {
+        t = first();
+    } else {
+        QStdVector<int> pending;
+        pending.append(0);
+        while (!pending.isEmpty()) {
+            const int index = pending.last();
+            pending.pop_back();
+            QTimerInfo *candidate = heap.at(index);
+            if (t && !timerLessThan(candidate, t))
+                continue;
+            if (!candidate->activateRef) {
+                t = candidate;
+                continue;
+            }
+            const int firstChild = (index * timerHeapArity) + 1;
+            const int lastChild = qMin(firstChild + timerHeapArity, heap.size());
+            for (int i = firstChild; i < lastChild; i++)
+                pending.append(i);
         }
     }
 
@@ -323,56 +669,36 @@ void QTimerInfoList::registerTimer(int timerId, int interval, QObject *object)
     t->obj = object;
     t->activateRef = nullptr;
 
+    t->objPrev = nullptr;
+    t->objNext = objectTimers.value(object);
+    if (t->objNext)
+        t->objNext->objPrev = t;
+    objectTimers.insert(object, t);
+    timers.insert(timerId, t);
+
     timerInsert(t);
 }
 
 bool QTimerInfoList::unregisterTimer(int timerId)
 {
-    // set timer inactive
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            // found it
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-
-            // release the timer id
-            if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
-                QAbstractEventDispatcherPrivate::releaseTimerId(timerId);
-
-            delete t;
-            return true;
-        }
+    QTimerInfo *t = timers.value(timerId);
+    if (!t) {
+        // id not found
+        return false;
     }
-    // id not found
-    return false;
+    timerDelete(t);
+    return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
     if (isEmpty())
         return false;
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->obj == object) {
-            // object found
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-
-            // release the timer id
-            if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
-                QAbstractEventDispatcherPrivate::releaseTimerId(t->id);
-
-            delete t;
-            // move back one so that we don't skip the new current item
-            --i;
-        }
+    QTimerInfo *t = objectTimers.value(object);
+    while (t) {
+        QTimerInfo *next = t->objNext;
+        timerDelete(t);
+        t = next;
     }
     return true;
 }
@@ -380,11 +706,9 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 QList<QPair<int, int> > QTimerInfoList::registeredTimers(QObject *object) const
 {
     QList<QPair<int, int> > list;
-    for (int i = 0; i < count(); ++i) {
-        const QTimerInfo * const t = at(i);
-        if (t->obj == object)
-            list << QPair<int, int>(t->id, t->interval.tv_sec * 1000 + t->interval.tv_usec / 1000);
-    }
+    // the most recently registered timer is the first one
+    for (const QTimerInfo *t = objectTimers.value(object); t; t = t->objNext)
+        list.prepend(QPair<int, int>(t->id, t->interval.tv_sec * 1000 + t->interval.tv_usec / 1000));
     return list;
 }
 
@@ -403,11 +727,22 @@ int QTimerInfoList::activateTimers()
     repairTimersIfNeeded();
 
 
-    // Find out how many timer have expired
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (currentTime < (*it)->timeout)
-            break;
-        maxCount++;
+    // Find out how many timer have expired, children of timers that have not
+    // expired yet have not expired either
+    if (!(currentTime < first()->timeout)) {
+        QStdVector<int> pending;
+        pending.append(0);
+        while (!pending.isEmpty()) {
+            const int index = pending.last();
+            pending.pop_back();
+            if (currentTime < heap.at(index)->timeout)
+                continue;
+            maxCount++;
+            const int firstChild = (index * timerHeapArity) + 1;
+            const int lastChild = qMin(firstChild + timerHeapArity, heap.size());
+            for (int i = firstChild; i < lastChild; i++)
+                pending.append(i);
+        }
     }
 
     //fire the timers.
@@ -429,16 +764,14 @@ int QTimerInfoList::activateTimers()
             firstTimerInfo = currentTimerInfo;
         }
 
-        // remove from list
-        removeFirst();
-
         // determine next timeout time
         currentTimerInfo->timeout += currentTimerInfo->interval;
         if (currentTimerInfo->timeout < currentTime)
             currentTimerInfo->timeout = currentTime + currentTimerInfo->interval;
 
-        // reinsert timer
-        timerInsert(currentTimerInfo);
+        // reinsert timer, it is the first one so only moving it down is needed
+        currentTimerInfo->serial = nextSerial++;
+        siftDown(0);
         if (currentTimerInfo->interval.tv_usec > 0 || currentTimerInfo->interval.tv_sec > 0)
             n_act++;
 
@@ -554,7 +887,6 @@ QSockNotType::QSockNotType()
 {
     FD_ZERO(&select_fds);
     FD_ZERO(&enabled_fds);
-    FD_ZERO(&pending_fds);
 }
 
 QSockNotType::~QSockNotType()
@@ -583,13 +915,40 @@ void QEventDispatcherUNIX::registerSocketNotifier(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
-    QSockNotType::List &list = d->sn_vec[type].list;
-    fd_set *fds  = &d->sn_vec[type].enabled_fds;
- 
     QSockNot *sn = new QSockNot;
     sn->obj = notifier;
     sn->fd = sockfd;
-    sn->queue = &d->sn_vec[type].pending_fds;
+    sn->pending = false;
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (d->epoll_fd != -1) {
+        QSockNotEpoll *sne = d->sn_epoll.value(sockfd);
+        if (!sne) {
+            sne = new QSockNotEpoll;
+            sne->sn[0] = sne->sn[1] = sne->sn[2] = nullptr;
+            sne->events = 0;
+            sne->alwaysready = false;
+            d->sn_epoll.insert(sockfd, sne);
+        }
+        if (sne->sn[type]) {
+            qWarning("QSocketNotifier: Multiple socket notifiers for "
+                      "same socket %d and type %s", sockfd, sockTypeString[type]);
+            d->sn_pending_list.removeAll(sne->sn[type]);
+            delete sne->sn[type];
+        }
+        sne->sn[type] = sn;
+
+        if (Q_UNLIKELY(!d->epollUpdate(sockfd, sne))) {
+            qWarning("QSocketNotifier: Invalid socket %d and type '%s', disabling...",
+                     sockfd, sockTypeString[type]);
+            notifier->setEnabled(false);
+        }
+        return;
+    }
+#endif
+
+    QSockNotType::List &list = d->sn_vec[type].list;
+    fd_set *fds  = &d->sn_vec[type].enabled_fds;
 
     int i;
     for (i = 0; i < list.size(); ++i) {
@@ -623,6 +982,27 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (d->epoll_fd != -1) {
+        QSockNotEpoll *sne = d->sn_epoll.value(sockfd);
+        if (!sne || !sne->sn[type] || sne->sn[type]->obj != notifier) // not found
+            return;
+
+        QSockNot *sn = sne->sn[type];
+        if (sn->pending)
+            d->sn_pending_list.removeAll(sn);
+        sne->sn[type] = nullptr;
+        delete sn;
+
+        d->epollUpdate(sockfd, sne);
+        if (sne->events == 0) {
+            d->sn_epoll.remove(sockfd);
+            delete sne;
+        }
+        return;
+    }
+#endif
+
     QSockNotType::List &list = d->sn_vec[type].list;
     fd_set *fds  =  &d->sn_vec[type].enabled_fds;
     QSockNot *sn = nullptr;
@@ -636,12 +1016,9 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
         return;
 
     FD_CLR(sockfd, fds);                        // clear fd bit
-    FD_CLR(sockfd, sn->queue);
     // remove from activation list
-    for (int i = 0; i < d->sn_pending_list.count(); i++) {
-        if (d->sn_pending_list.at(i) == sn)
-            d->sn_pending_list.remove(i);
-    }
+    if (sn->pending)
+        d->sn_pending_list.removeAll(sn);
     list.remove(i);                                  // remove notifier found above
     delete sn;
 
@@ -669,19 +1046,29 @@ void QEventDispatcherUNIX::setSocketNotifierPending(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
-    QSockNotType::List &list = d->sn_vec[type].list;
     QSockNot *sn = nullptr;
-    for (int i = 0; i < list.size(); ++i) {
-        sn = list[i];
-        if(sn->obj == notifier && sn->fd == sockfd)
-            break;
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (d->epoll_fd != -1) {
+        QSockNotEpoll *sne = d->sn_epoll.value(sockfd);
+        if (sne && sne->sn[type] && sne->sn[type]->obj == notifier)
+            sn = sne->sn[type];
+    } else
+#endif
+    {
+        QSockNotType::List &list = d->sn_vec[type].list;
+        for (int i = 0; i < list.size(); ++i) {
+            if (list[i]->obj == notifier && list[i]->fd == sockfd) {
+                sn = list[i];
+                break;
+            }
+        }
     }
     if (!sn) // not found
         return;
 
-    if (! FD_ISSET(sn->fd, sn->queue)) {
+    if (!sn->pending) {
         d->sn_pending_list.append(sn);
-        FD_SET(sn->fd, sn->queue);
+        sn->pending = true;
     }
 }
 
@@ -704,8 +1091,8 @@ int QEventDispatcherUNIX::activateSocketNotifiers()
     while (!d->sn_pending_list.isEmpty()) {
         QSockNot *sn = d->sn_pending_list.value(0);
         d->sn_pending_list.remove(0);
-        if (FD_ISSET(sn->fd, sn->queue)) {
-            FD_CLR(sn->fd, sn->queue);
+        if (sn->pending) {
+            sn->pending = false;
             QCoreApplication::sendEvent(sn->obj, &event);
             ++n_act;
         }
@@ -760,7 +1147,8 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
 bool QEventDispatcherUNIX::hasPendingEvents()
 {
     QThreadData *currentThreadData = QThreadData::current();
-    return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
+    return (currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset) != 0
+        || currentThreadData->postEventList.hasQueuedEvents();
 }
 
 void QEventDispatcherUNIX::wakeUp()
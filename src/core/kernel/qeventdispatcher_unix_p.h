@@ -37,6 +37,7 @@
 #include "qabstracteventdispatcher_p.h"
 #include "qcore_unix_p.h"
 #include "qstdcontainers_p.h"
+#include "qflathash_p.h"
 
 #include <sys/time.h>
 #include <sys/select.h>
@@ -50,9 +51,15 @@ struct QTimerInfo {
     timeval timeout;  // - when to sent event
     QObject *obj;     // - object to receive event
     QTimerInfo **activateRef; // - ref from activateTimers
+    quint64 serial;   // - orders timers with the same timeout
+    int heapIndex;    // - position in the timer heap
+    QTimerInfo *objPrev, *objNext; // - other timers of the same object
 };
 
-class QTimerInfoList : public QList<QTimerInfo*>
+// 4-ary min-heap of timers ordered by timeout, timers are also indexed by id
+// and by object so that registering and unregistering does not have to
+// search through all of them
+class QTimerInfoList
 {
     timeval previousTime;
     clock_t previousTicks;
@@ -64,8 +71,23 @@ class QTimerInfoList : public QList<QTimerInfo*>
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo;
 
+    QStdVector<QTimerInfo*> heap;
+    QFlatHash<int, QTimerInfo*> timers;
+    QFlatHash<QObject*, QTimerInfo*> objectTimers;
+    quint64 nextSerial;
+
+    inline QTimerInfo *first() const { return heap.first(); }
+    void timerRemove(QTimerInfo *);
+    void timerDelete(QTimerInfo *);
+    void siftUp(int index);
+    void siftDown(int index);
+
 public:
     QTimerInfoList();
+    ~QTimerInfoList();
+
+    inline bool isEmpty() const { return heap.isEmpty(); }
+    inline int size() const { return heap.size(); }
 
     timeval currentTime;
     timeval updateCurrentTime();
@@ -89,8 +111,19 @@ struct QSockNot
 {
     QSocketNotifier *obj;
     int fd;
-    fd_set *queue;
+    bool pending;
+};
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+// socket notifiers of all types registered for a single fd in the epoll set
+struct QSockNotEpoll
+{
+    QSockNot *sn[3];
+    uint events;
+    // not pollable, e.g. regular file
+    bool alwaysready;
 };
+#endif
 
 class QSockNotType
 {
@@ -103,8 +136,6 @@ public:
     List list;
     fd_set select_fds;
     fd_set enabled_fds;
-    fd_set pending_fds;
-
 };
 
 class QEventDispatcherUNIXPrivate;
@@ -156,8 +187,25 @@ public:
     int doSelect(QEventLoop::ProcessEventsFlags flags, timeval *timeout);
     int initThreadWakeUp();
     int processThreadWakeUp(int nsel);
+    void consumeThreadWakeUp();
+
+    // extra fds that wake up the event loop but have no socket notifier,
+    // e.g. the X11 connection
+    void registerWakeUpFd(int fd);
 
     int thread_pipe[2];
+    QStdVector<int> wakeup_fds;
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    int doEpoll(QEventLoop::ProcessEventsFlags flags, timeval *timeout);
+    bool epollUpdate(int fd, QSockNotEpoll *sne);
+
+    // -1 if select() is used
+    int epoll_fd;
+    // socket notifiers registered in the epoll set, keyed by fd
+    QFlatHash<int, QSockNotEpoll*> sn_epoll;
+    int sn_epoll_alwaysready;
+#endif
 
     // highest fd for all socket notifiers
     int sn_highest;
@@ -448,8 +448,38 @@ template<int MethodType>
 static inline int indexOfMethodRelative(const QMetaObject **baseObject,
                                         const char *method)
 {
+    bool hashed = false;
+    uint hash = 0;
     for (const QMetaObject *m = *baseObject; m; m = m->d.superdata) {
         Q_ASSERT(priv(m->d.data)->revision >= 6);
+        if (priv(m->d.data)->revision >= 7) {
+            // moc generated, look the signature up in the hash table
+            const int size = priv(m->d.data)->methodHashSize;
+            if (size == 0)
+                continue;
+            if (!hashed) {
+                hash = QMetaObjectPrivate::methodHash(method);
+                hashed = true;
+            }
+            const uint *table = m->d.data + priv(m->d.data)->methodHashData;
+            const int begin = (MethodType == MethodSlot) ? priv(m->d.data)->signalCount : 0;
+            const int end = (MethodType == MethodSignal)
+                ? priv(m->d.data)->signalCount : priv(m->d.data)->methodCount;
+            int found = -1;
+            for (int slot = (hash & (size - 1)); table[2*slot + 1] != 0; slot = ((slot + 1) & (size - 1))) {
+                const int i = int(table[2*slot + 1]) - 1;
+                if (table[2*slot] != hash || i < begin || i >= end || i <= found)
+                    continue;
+                const char *stringdata = m->d.stringdata + m->d.data[priv(m->d.data)->methodData + 5*i];
+                if (qstrcmp(method, stringdata) == 0)
+                    found = i;
+            }
+            if (found >= 0) {
+                *baseObject = m;
+                return found;
+            }
+            continue;
+        }
         int i = (MethodType == MethodSignal)
                 ? (priv(m->d.data)->signalCount - 1) : (priv(m->d.data)->methodCount - 1);
         const int end = (MethodType == MethodSlot) ? (priv(m->d.data)->signalCount) : 0;
@@ -94,10 +94,24 @@ struct QMetaObjectPrivate
     int signalCount; //since revision 4
     // revision 5 introduces changes in normalized signatures, no new members
     // revision 6 added qt_static_metacall as a member of each Q_OBJECT and inside QMetaObject itself
+    int methodHashSize, methodHashData; //since revision 7
 
     static inline const QMetaObjectPrivate *get(const QMetaObject *metaobject)
     { return reinterpret_cast<const QMetaObjectPrivate*>(metaobject->d.data); }
 
+    // hash of a normalized method signature, moc uses it to build a table of
+    // methodHashSize (a power of two) hash and method index + 1 pairs with
+    // linear probing, empty slots have zero index
+    static inline uint methodHash(const char *signature)
+    {
+        uint hash = 2166136261u;
+        while (*signature) {
+            hash ^= uchar(*signature++);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
     static int indexOfSignalRelative(const QMetaObject **baseObject,
                                      const char* name);
     static int indexOfSlotRelative(const QMetaObject **m,
@@ -24,6 +24,7 @@
 #include "qdatetime.h"
 #include "qbytearray.h"
 #include "qmutex.h"
+#include "qhash.h"
 #include "qstring.h"
 #include "qstringlist.h"
 #include "qvector.h"
@@ -334,7 +335,119 @@ public:
 };
 
 Q_DECLARE_TYPEINFO(QCustomTypeInfo, Q_MOVABLE_TYPE);
+
+/*
+    Maps the normalized names of the custom types to their ids. Names are
+    only ever added, with customTypesLock locked, and looked up without
+    locking: an entry is complete before it is stored in its slot and when
+    the table grows the new table is published atomically. The previous
+    tables are kept until exit since a reader may still be probing them.
+*/
+class QCustomTypeNames
+{
+public:
+    struct Entry
+    {
+        uint hash;
+        QByteArray name;
+        QAtomicInt type; // 0 once unregistered
+    };
+
+    struct Table
+    {
+        explicit Table(int size) : size(size), buckets(new QAtomicPointer<Entry>[size]) { }
+        ~Table() { delete [] buckets; }
+
+        const int size;
+        QAtomicPointer<Entry> *buckets;
+    };
+
+    QCustomTypeNames() : table(new Table(64)) { }
+
+    ~QCustomTypeNames()
+    {
+        qDeleteAll(entries);
+        qDeleteAll(retired);
+        delete table.load();
+    }
+
+    int type(const char *typeName, int length) const
+    {
+        const uint hash = hashOf(typeName, length);
+        const Table *t = table;
+        const int mask = t->size - 1;
+        for (int i = hash & mask; ; i = (i + 1) & mask) {
+            const Entry *entry = t->buckets[i];
+            if (!entry)
+                return 0;
+            if (entry->hash == hash && entry->name.size() == length
+                && ::memcmp(entry->name.constData(), typeName, length) == 0) {
+                const int type = entry->type.load();
+                if (type)
+                    return type;
+            }
+        }
+    }
+
+    void insert(const QByteArray &typeName, int type)
+    {
+        Entry *entry = new Entry;
+        entry->hash = hashOf(typeName.constData(), typeName.size());
+        entry->name = typeName;
+        entry->type = type;
+
+        Table *t = table;
+        // keep the table at most half full so that probing stays short
+        if ((entries.count() + 1) * 2 > t->size) {
+            Table *grown = new Table(t->size * 2);
+            for (int i = 0; i < entries.count(); ++i)
+                place(grown, entries.at(i));
+            table = grown;
+            retired.append(t);
+            t = grown;
+        }
+        entries.append(entry);
+        place(t, entry);
+    }
+
+    void remove(const QByteArray &typeName)
+    {
+        for (int i = 0; i < entries.count(); ++i) {
+            if (entries.at(i)->name == typeName)
+                entries.at(i)->type = 0;
+        }
+    }
+
+private:
+    // names often differ only in their last characters, mix the bits of
+    // qHash() so that they do not end up in neighbouring buckets
+    static inline uint hashOf(const char *typeName, int length)
+    {
+        uint hash = qHash(typeName, length);
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bU;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35U;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    static void place(Table *t, Entry *entry)
+    {
+        const int mask = t->size - 1;
+        int i = entry->hash & mask;
+        while (t->buckets[i])
+            i = (i + 1) & mask;
+        t->buckets[i] = entry;
+    }
+
+    QAtomicPointer<Table> table;
+    QStdVector<Entry *> entries;
+    QStdVector<Table *> retired;
+};
+
 Q_GLOBAL_STATIC(QStdVector<QCustomTypeInfo>, customTypes)
+Q_GLOBAL_STATIC(QCustomTypeNames, customTypeNames)
 Q_GLOBAL_STATIC(QMutex, customTypesLock)
 
 #ifndef QT_NO_DATASTREAM
@@ -407,24 +520,14 @@ static inline int qMetaTypeStaticType(const char *typeName, int length)
 
 /*! \internal
     Similar to QMetaType::type(), but only looks in the custom set of
-    types, and doesn't lock the mutex.
+    types. Does not need the mutex to be locked.
 */
-static int qMetaTypeCustomType_unlocked(const char *typeName, int length)
+static inline int qMetaTypeCustomType(const char *typeName, int length)
 {
-    const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-    if (!ct)
+    const QCustomTypeNames * const names = customTypeNames();
+    if (!names)
         return 0;
-
-    for (int v = 0; v < ct->count(); ++v) {
-        const QCustomTypeInfo &customInfo = ct->at(v);
-        if ((length == customInfo.typeName.size())
-            && strcmp(typeName, customInfo.typeName.constData()) == 0) {
-            if (customInfo.alias >= 0)
-                return customInfo.alias;
-            return v + QMetaType::User;
-        }
-    }
-    return 0;
+    return names->type(typeName, length);
 }
 
 /*! \internal
@@ -452,8 +555,8 @@ int QMetaType::registerType(const char *typeName, Destructor destructor,
     if (!idx) {
         QMutexLocker locker(customTypesLock());
         QStdVector<QCustomTypeInfo> *ct = customTypes();
-        idx = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                           normalizedTypeName.size());
+        idx = qMetaTypeCustomType(normalizedTypeName.constData(),
+                                  normalizedTypeName.size());
         if (!idx) {
             QCustomTypeInfo inf;
             inf.typeName = normalizedTypeName;
@@ -462,6 +565,7 @@ int QMetaType::registerType(const char *typeName, Destructor destructor,
             inf.alias = -1;
             idx = ct->size() + User;
             ct->append(inf);
+            customTypeNames()->insert(normalizedTypeName, idx);
         }
     }
     return idx;
@@ -494,8 +598,8 @@ int QMetaType::registerTypedef(const char* typeName, int aliasId)
 
     QMutexLocker locker(customTypesLock());
     QStdVector<QCustomTypeInfo> *ct = customTypes();
-    idx = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                       normalizedTypeName.size());
+    idx = qMetaTypeCustomType(normalizedTypeName.constData(),
+                              normalizedTypeName.size());
 
     if (idx)
         return idx;
@@ -506,6 +610,7 @@ int QMetaType::registerTypedef(const char* typeName, int aliasId)
     inf.constr = nullptr;
     inf.destr = nullptr;
     ct->append(inf);
+    customTypeNames()->insert(normalizedTypeName, aliasId);
     return aliasId;
 }
 
@@ -532,6 +637,7 @@ void QMetaType::unregisterType(const char *typeName)
     for (int v = 0; v < ct->count(); ++v) {
         if (ct->at(v).typeName == typeName) {
             QCustomTypeInfo &inf = (*ct)[v];
+            customTypeNames()->remove(inf.typeName);
             inf.typeName.clear();
             inf.constr = nullptr;
             inf.destr = nullptr;
@@ -572,16 +678,15 @@ int QMetaType::type(const char *typeName)
         return 0;
     int type = qMetaTypeStaticType(typeName, length);
     if (!type) {
-        QMutexLocker locker(customTypesLock());
-        type = qMetaTypeCustomType_unlocked(typeName, length);
+        type = qMetaTypeCustomType(typeName, length);
 #ifndef QT_NO_QOBJECT
         if (!type) {
             const NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
             type = qMetaTypeStaticType(normalizedTypeName.constData(),
                                        normalizedTypeName.size());
             if (!type) {
-                type = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                                    normalizedTypeName.size());
+                type = qMetaTypeCustomType(normalizedTypeName.constData(),
+                                           normalizedTypeName.size());
             }
         }
 #endif
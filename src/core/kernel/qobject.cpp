@@ -137,7 +137,7 @@ QObjectPrivate::~QObjectPrivate()
             threadData->eventDispatcher->unregisterTimers(q_ptr);
     }
 
-    if (postedEvents)
+    if (postedEvents || (threadData && threadData->postEventList.hasQueuedEvents()))
         QCoreApplication::removePostedEvents(q_ptr, 0);
 
     if (threadData)
@@ -176,29 +176,88 @@ static void computeOffsets(const QMetaObject *metaobject, int *signalOffset, int
     QObjectPrivate::signalIndex (not QMetaObject::indexOfSignal).
     Negative index means connections to all signals.
 
-    This vector is protected by the object mutex (signalSlotMutexes())
+    This vector is modified with the object mutex (signalSlotMutexes())
+    locked. QMetaObject::activate() reads it without locking, so the
+    lists are never reallocated or freed in place: growing the vector
+    publishes a new copy of the lists and connections removed from them
+    are kept alive until no emission holds a reference to the vector.
 
     Each Connection is also part of a 'senders' linked list. The mutex
     of the receiver must be locked when touching the pointers of this
     linked list.
 */
-class QObjectConnectionListVector : public QVector<QObjectPrivate::ConnectionList>
+class QObjectConnectionListVector
 {
 public:
-    bool orphaned; //the QObject owner of this vector has been destroyed while the vector was inUse
-    bool dirty; //some Connection have been disconnected (their receiver is 0) but not removed from the list yet
-    int inUse; //number of functions that are currently accessing this object or its connections
+    struct Lists
+    {
+        explicit Lists(int size) : count(size), lists(new QObjectPrivate::ConnectionList[size]) { }
+        ~Lists() { delete [] lists; }
+
+        const int count;
+        QObjectPrivate::ConnectionList *lists;
+    };
+
+    QAtomicInt orphaned; //the QObject owner of this vector has been destroyed while the vector was inUse
+    QAtomicInt dirty; //some Connection have been disconnected (their receiver is 0) but not removed from the list yet
+    QAtomicInt inUse; //one reference for the QObject owner plus one for each function currently accessing its connections
+    QAtomicInt retired; //some Connection or Lists have been removed but may still be read by an emission
+    QAtomicPointer<Lists> current;
     QObjectPrivate::ConnectionList allsignals;
+    quint64 serial; //serial of the last Connection added
+    QVector<QObjectPrivate::Connection *> retiredConnections;
+    QVector<Lists *> retiredLists;
 
     QObjectConnectionListVector()
-        : QVector<QObjectPrivate::ConnectionList>(), orphaned(false), dirty(false), inUse(0)
+        : orphaned(0), dirty(0), inUse(1), retired(0), current(new Lists(0)), serial(0)
     { }
 
+    ~QObjectConnectionListVector()
+    {
+        qDeleteAll(retiredConnections);
+        qDeleteAll(retiredLists);
+        delete current.load();
+    }
+
+    int count() const
+    {
+        return current->count;
+    }
+
+    const QObjectPrivate::ConnectionList &at(int at) const
+    {
+        return current->lists[at];
+    }
+
     QObjectPrivate::ConnectionList &operator[](int at)
     {
         if (at < 0)
             return allsignals;
-        return QVector<QObjectPrivate::ConnectionList>::operator[](at);
+        return current->lists[at];
+    }
+
+    void resize(int size)
+    {
+        Lists *old = current;
+        Lists *grown = new Lists(size);
+        for (int i = 0; i < old->count; ++i)
+            grown->lists[i] = old->lists[i];
+        current = grown;
+        retiredLists.append(old);
+        retired = 1;
+    }
+
+    // deletes what was removed from the lists once nothing but the owner holds them,
+    // an emission that started afterwards can not reach it anymore
+    void reclaim()
+    {
+        if (!retired.load() || inUse.load() != 1)
+            return;
+        qDeleteAll(retiredConnections);
+        retiredConnections.clear();
+        qDeleteAll(retiredLists);
+        retiredLists.clear();
+        retired = 0;
     }
 };
 
@@ -209,6 +268,7 @@ void QObjectPrivate::addConnection(int signal, Connection *c)
     if (signal >= connectionLists->count())
         connectionLists->resize(signal + 1);
 
+    c->serial = ++connectionLists->serial;
     ConnectionList &connectionList = (*connectionLists)[signal];
     if (connectionList.last) {
         connectionList.last->nextConnectionList = c;
@@ -222,8 +282,9 @@ void QObjectPrivate::addConnection(int signal, Connection *c)
 
 void QObjectPrivate::cleanConnectionLists()
 {
-    if (connectionLists->dirty && !connectionLists->inUse) {
-        // remove broken connections
+    if (connectionLists->dirty.load()) {
+        // remove broken connections, emissions in progress may still walk over
+        // them so they are deleted by reclaim() when it is safe to do so
         for (int signal = -1; signal < connectionLists->count(); ++signal) {
             QObjectPrivate::ConnectionList &connectionList =
                 (*connectionLists)[signal];
@@ -233,7 +294,7 @@ void QObjectPrivate::cleanConnectionLists()
             // at the end of the cleanup.
             QObjectPrivate::Connection *last = nullptr;
 
-            QObjectPrivate::Connection **prev = &connectionList.first;
+            QAtomicPointer<QObjectPrivate::Connection> *prev = &connectionList.first;
             QObjectPrivate::Connection *c = *prev;
             while (c) {
                 if (c->receiver) {
@@ -243,7 +304,8 @@ void QObjectPrivate::cleanConnectionLists()
                 } else {
                     QObjectPrivate::Connection *next = c->nextConnectionList;
                     *prev = next;
-                    delete c;
+                    connectionLists->retiredConnections.append(c);
+                    connectionLists->retired = 1;
                     c = next;
                 }
             }
@@ -252,8 +314,9 @@ void QObjectPrivate::cleanConnectionLists()
             // As conectionList.last could equal last, this could be a noop
             connectionList.last = last;
         }
-        connectionLists->dirty = false;
+        connectionLists->dirty = 0;
     }
+    connectionLists->reclaim();
 }
 
 /*! \internal
@@ -583,11 +646,11 @@ QObject::~QObject()
 
         // disconnect all receivers
         if (d->connectionLists) {
-            ++d->connectionLists->inUse;
-            int connectionListsCount = d->connectionLists->count();
+            QObjectConnectionListVector *connectionLists = d->connectionLists;
+            int connectionListsCount = connectionLists->count();
             for (int signal = -1; signal < connectionListsCount; ++signal) {
                 QObjectPrivate::ConnectionList &connectionList =
-                    (*d->connectionLists)[signal];
+                    (*connectionLists)[signal];
 
                 while (QObjectPrivate::Connection *c = connectionList.first) {
                     if (!c->receiver) {
@@ -611,12 +674,12 @@ QObject::~QObject()
                 }
             }
 
-            if (!--d->connectionLists->inUse) {
-                delete d->connectionLists;
-            } else {
-                d->connectionLists->orphaned = true;
-            }
+            // drop the reference of this object, a signal emission still in
+            // progress deletes the vector when it is done with it
+            connectionLists->orphaned = 1;
             d->connectionLists = nullptr;
+            if (!connectionLists->inUse.deref())
+                delete connectionLists;
         }
 
         // disconnect all senders
@@ -634,7 +697,7 @@ QObject::~QObject()
             node->receiver = nullptr;
             QObjectConnectionListVector *senderLists = sender->d_func()->connectionLists;
             if (senderLists)
-                senderLists->dirty = true;
+                senderLists->dirty = 1;
 
             node = node->next;
             if (needToUnlock)
@@ -1091,6 +1154,10 @@ void QObject::moveToThread(QThread *targetThread)
     // move the object
     d_func()->setThreadData_helper(currentData, targetData);
 
+    // events posted without the mutex before the move are passed on now,
+    // later ones see the new thread data
+    currentData->flushPostEventQueue();
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
@@ -2593,7 +2660,7 @@ bool QMetaObjectPrivate::disconnect(const QObject *sender, int signal_index,
         return false;
 
     // prevent incoming connections changing the connectionLists while unlocked
-    ++connectionLists->inUse;
+    connectionLists->inUse.ref();
 
     bool success = false;
     if (signal_index < 0) {
@@ -2603,7 +2670,7 @@ bool QMetaObjectPrivate::disconnect(const QObject *sender, int signal_index,
                 (*connectionLists)[signal_index].first;
             if (disconnectHelper(c, receiver, method_index, senderMutex, disconnectType)) {
                 success = true;
-                connectionLists->dirty = true;
+                connectionLists->dirty = 1;
             }
         }
     } else if (signal_index < connectionLists->count()) {
@@ -2611,13 +2678,11 @@ bool QMetaObjectPrivate::disconnect(const QObject *sender, int signal_index,
             (*connectionLists)[signal_index].first;
         if (disconnectHelper(c, receiver, method_index, senderMutex, disconnectType)) {
             success = true;
-            connectionLists->dirty = true;
+            connectionLists->dirty = 1;
         }
     }
 
-    --connectionLists->inUse;
-    Q_ASSERT(connectionLists->inUse >= 0);
-    if (connectionLists->orphaned && !connectionLists->inUse)
+    if (!connectionLists->inUse.deref())
         delete connectionLists;
 
     return success;
@@ -2762,12 +2827,13 @@ void QMetaObject::activate(QObject *sender, const QMetaObject *m, int local_sign
 
     QThread* currentThread = QThread::currentThread();
 
-    QMutexLocker locker(signalSlotLock(sender));
+    // the connections are read without locking, the reference keeps the vector
+    // and the connections removed from it meanwhile alive until the emission is done
     QObjectConnectionListVector *connectionLists = sender->d_func()->connectionLists;
     if (!connectionLists) {
         return;
     }
-    ++connectionLists->inUse;
+    connectionLists->inUse.ref();
 
 
     const QObjectPrivate::ConnectionList *list;
@@ -2780,25 +2846,34 @@ void QMetaObject::activate(QObject *sender, const QMetaObject *m, int local_sign
         QObjectPrivate::Connection *c = list->first;
         if (!c) continue;
         // We need to check against last here to ensure that signals added
-        // during the signal emission are not emitted in this emission.
-        QObjectPrivate::Connection *last = list->last;
+        // during the signal emission are not emitted in this emission. The
+        // serial is compared since last may be removed from the list meanwhile.
+        const QObjectPrivate::Connection *last = list->last;
+        if (!last) continue;
+        const quint64 lastSerial = last->serial;
 
         do {
-            if (!c->receiver)
-                continue;
+            if (c->serial > lastSerial)
+                break;
 
             QObject * const receiver = c->receiver;
+            if (!receiver)
+                continue;
+
             const bool receiverInSameThread = currentThread == receiver->d_func()->threadData->thread;
 
             // determine if this connection should be sent immediately or
             // put into the event queue
             if ((c->connectionType == Qt::AutoConnection && !receiverInSameThread)
                 || (c->connectionType == Qt::QueuedConnection)) {
-                queued_activate(sender, signal_absolute_index, c, argv ? argv : empty_argv);
+                // the receiver may be destroyed by another thread, it is
+                // disconnected with the sender lock locked
+                QMutexLocker locker(signalSlotLock(sender));
+                if (c->receiver)
+                    queued_activate(sender, signal_absolute_index, c, argv ? argv : empty_argv);
                 continue;
 #ifndef QT_NO_THREAD
             } else if (c->connectionType == Qt::BlockingQueuedConnection) {
-                locker.unlock();
                 if (Q_UNLIKELY(receiverInSameThread)) {
                     qWarning("QMetaObject::activate: Dead lock detected while activating a BlockingQueuedConnection: "
                         "Sender is %s(%p), receiver is %s(%p)",
@@ -2806,14 +2881,18 @@ void QMetaObject::activate(QObject *sender, const QMetaObject *m, int local_sign
                         receiver->metaObject()->className(), receiver);
                 }
                 QSemaphore semaphore;
-                QCoreApplication::postEvent(receiver, new QMetaCallEvent(c->method_offset, c->method_relative,
-                                                                         c->callFunction,
-                                                                         sender, signal_absolute_index,
-                                                                         0, nullptr,
-                                                                         argv ? argv : empty_argv,
-                                                                         &semaphore));
+                {
+                    QMutexLocker locker(signalSlotLock(sender));
+                    if (!c->receiver)
+                        continue;
+                    QCoreApplication::postEvent(receiver, new QMetaCallEvent(c->method_offset, c->method_relative,
+                                                                             c->callFunction,
+                                                                             sender, signal_absolute_index,
+                                                                             0, nullptr,
+                                                                             argv ? argv : empty_argv,
+                                                                             &semaphore));
+                }
                 semaphore.acquire();
-                locker.relock();
                 continue;
 #endif
             }
@@ -2830,15 +2909,12 @@ void QMetaObject::activate(QObject *sender, const QMetaObject *m, int local_sign
             const int method_relative = c->method_relative;
             if (callFunction && c->method_offset <= receiver->metaObject()->methodOffset()) {
                 //we compare the vtable to make sure we are not in the destructor of the object.
-                locker.unlock();
                 if (qt_signal_spy_callback_set.slot_begin_callback)
                     qt_signal_spy_callback_set.slot_begin_callback(receiver, c->method(), argv ? argv : empty_argv);
 
                 callFunction(receiver, QMetaObject::InvokeMetaMethod, method_relative, argv ? argv : empty_argv);
-                locker.relock();
             } else {
                 const int method = method_relative + c->method_offset;
-                locker.unlock();
 
                 if (qt_signal_spy_callback_set.slot_begin_callback) {
                     qt_signal_spy_callback_set.slot_begin_callback(receiver,
@@ -2847,28 +2923,29 @@ void QMetaObject::activate(QObject *sender, const QMetaObject *m, int local_sign
                 }
 
                 metacall(receiver, QMetaObject::InvokeMetaMethod, method, argv ? argv : empty_argv);
-                locker.relock();
             }
 
             if (receiverInSameThread)
                 QObjectPrivate::resetCurrentSender(receiver, &currentSender, previousSender);
 
-            if (connectionLists->orphaned)
+            if (connectionLists->orphaned.load())
                 break;
-        } while (c != last && (c = c->nextConnectionList) != nullptr);
+        } while ((c = c->nextConnectionList) != nullptr);
 
-        if (connectionLists->orphaned)
+        if (connectionLists->orphaned.load())
             break;
     } while (list != &connectionLists->allsignals &&
         //start over for all signals;
         ((list = &connectionLists->allsignals), true));
 
-    --connectionLists->inUse;
-    Q_ASSERT(connectionLists->inUse >= 0);
-    if (connectionLists->orphaned) {
-        if (!connectionLists->inUse)
-            delete connectionLists;
-    } else if (connectionLists->dirty) {
+    const int inUse = connectionLists->inUse.fetchAndAddOrdered(-1);
+    Q_ASSERT(inUse >= 1);
+    if (inUse == 1) {
+        // the sender has been destroyed during the emission
+        delete connectionLists;
+    } else if (inUse == 2 && !connectionLists->orphaned.load()
+        && (connectionLists->dirty.load() || connectionLists->retired.load())) {
+        QMutexLocker locker(signalSlotLock(sender));
         sender->d_func()->cleanConnectionLists();
     }
 }
@@ -73,25 +73,27 @@ public:
     struct Connection
     {
         QObject *sender;
-        QObject *receiver;
+        QAtomicPointer<QObject> receiver;
         StaticMetaCallFunction callFunction;
         // The next pointer for the singly-linked ConnectionList
-        Connection *nextConnectionList;
+        QAtomicPointer<Connection> nextConnectionList;
         //senders linked list
         Connection *next;
         Connection **prev;
         QAtomicPointer<int> argumentTypes;
+        quint64 serial; // order in which the connections to the sender were made
         ushort method_offset;
         ushort method_relative;
         ushort connectionType : 3; // 0 == auto, 1 == direct, 2 == queued, 4 == blocking
         ~Connection();
         int method() const { return method_offset + method_relative; }
     };
-    // ConnectionList is a singly-linked list
+    // ConnectionList is a singly-linked list, it is modified with the
+    // signalSlotLock of the sender locked but read without it when emitting
     struct ConnectionList {
         ConnectionList() : first(nullptr), last(nullptr) {}
-        Connection *first;
-        Connection *last;
+        QAtomicPointer<Connection> first;
+        QAtomicPointer<Connection> last;
     };
 
     struct Sender
@@ -140,7 +142,7 @@ public:
     ExtraData *extraData;    // extra data set by the user
     QThreadData *threadData; // id of the thread that owns the object
 
-    QObjectConnectionListVector *connectionLists;
+    QAtomicPointer<QObjectConnectionListVector> connectionLists;
 
     Connection *senders;     // linked list of connections connected to this object
     Sender *currentSender;   // object currently activating the object
@@ -33,7 +33,7 @@
 
 QT_BEGIN_NAMESPACE
 
-static bool isCharEqual(const char* const byteptr, const int bytelen, const char* const charptr, const int charlen)
+static inline bool isCharEqual(const char* const byteptr, const int bytelen, const char* const charptr, const int charlen)
 {
     if (bytelen != charlen) {
         return false;
@@ -41,6 +41,21 @@ static bool isCharEqual(const char* const byteptr, const int bytelen, const char
     return (::memcmp(byteptr, charptr, charlen) == 0);
 }
 
+static inline uint translatorHash(const char *context, const int contextlen,
+                                  const char *sourceText, const int sourcelen)
+{
+    // FNV-1a, context and source text are separated like in gettext catalogs
+    uint h = 2166136261u;
+    for (int i = 0; i < contextlen; i++) {
+        h = (h ^ uchar(context[i])) * 16777619u;
+    }
+    h = (h ^ 0x04) * 16777619u;
+    for (int i = 0; i < sourcelen; i++) {
+        h = (h ^ uchar(sourceText[i])) * 16777619u;
+    }
+    return h;
+}
+
 struct QTranslatorCache
 {
     QByteArray trmsgctxt;
@@ -55,17 +70,112 @@ class QTranslatorPrivate
 public:
     QTranslatorPrivate();
 
+    void clear();
+    void buildIndex();
+    const QByteArray* find(const char *context, const char *sourceText) const;
+    QString toUnicode(const QByteArray &msgstr) const;
+
     QStdVector<QTranslatorCache> cache;
-    mutable QTextConverter converter;
+    // open addressing table of cache entries, each slot holds the entry index shifted left by
+    // one with the lowest bit set for plurals or -1 if the slot is free
+    QStdVector<int> index;
+    QTextCodec *codec;
+    bool utf8;
 
 private:
     Q_DISABLE_COPY(QTranslatorPrivate);
+
+    inline const QByteArray& msgid(const int slot) const
+    {
+        const QTranslatorCache &it = cache.at(slot >> 1);
+        return ((slot & 1) ? it.trmsgid_plural : it.trmsgid);
+    }
+    inline const QByteArray& msgstr(const int slot) const
+    {
+        const QTranslatorCache &it = cache.at(slot >> 1);
+        return ((slot & 1) ? it.trmsgstr_plural : it.trmsgstr);
+    }
 };
 
 QTranslatorPrivate::QTranslatorPrivate()
+    : codec(nullptr),
+    utf8(false)
 {
 }
 
+void QTranslatorPrivate::clear()
+{
+    cache.clear();
+    index.clear();
+    codec = nullptr;
+    utf8 = false;
+}
+
+void QTranslatorPrivate::buildIndex()
+{
+    // every entry is looked up by both its message and its plural message, at most half full
+    int indexsize = 16;
+    while (indexsize < (cache.size() * 4)) {
+        indexsize *= 2;
+    }
+    index = QStdVector<int>(indexsize, -1);
+
+    for (int i = 0; i < cache.size(); i++) {
+        const QTranslatorCache &it = cache.at(i);
+        // plurals are searched first and the first match wins, this search method assumes
+        // plurals and regular messages are unique strings
+        for (int plural = 1; plural >= 0; plural--) {
+            const int entry = ((i << 1) | plural);
+            const QByteArray &id = msgid(entry);
+            int slot = (translatorHash(it.trmsgctxt.constData(), it.trmsgctxt.size(),
+                id.constData(), id.size()) & (indexsize - 1));
+            bool duplicate = false;
+            while (index.at(slot) != -1) {
+                const int other = index.at(slot);
+                if (cache.at(other >> 1).trmsgctxt == it.trmsgctxt && msgid(other) == id) {
+                    duplicate = true;
+                    break;
+                }
+                slot = ((slot + 1) & (indexsize - 1));
+            }
+            if (!duplicate) {
+                index[slot] = entry;
+            }
+        }
+    }
+}
+
+const QByteArray* QTranslatorPrivate::find(const char *context, const char *sourceText) const
+{
+    const int contextlen = qstrlen(context);
+    const int sourcelen = qstrlen(sourceText);
+    const int indexmask = (index.size() - 1);
+    int slot = (translatorHash(context, contextlen, sourceText, sourcelen) & indexmask);
+    while (index.at(slot) != -1) {
+        const int entry = index.at(slot);
+        const QTranslatorCache &it = cache.at(entry >> 1);
+        const QByteArray &id = msgid(entry);
+        if (isCharEqual(id.constData(), id.size(), sourceText, sourcelen)
+            && isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)) {
+            return &msgstr(entry);
+        }
+        slot = ((slot + 1) & indexmask);
+    }
+    return nullptr;
+}
+
+QString QTranslatorPrivate::toUnicode(const QByteArray &msgstr) const
+{
+    // conversions are stateless so that translations can be looked up from any thread
+    if (utf8) {
+        return QString::fromUtf8(msgstr.constData(), msgstr.size());
+    }
+    if (Q_UNLIKELY(!codec)) {
+        return QString();
+    }
+    return codec->toUnicode(msgstr.constData(), msgstr.size());
+}
+
 
 /*!
     \class QTranslator
@@ -165,8 +275,7 @@ QTranslator::~QTranslator()
 bool QTranslator::load(const QString &domain, const QString &locale)
 {
     Q_D(QTranslator);
-    d->cache.clear();
-    d->converter = QTextConverter();
+    d->clear();
     if (domain.isEmpty()) {
         qWarning("QTranslator::load: Domain is empty");
         return false;
@@ -190,7 +299,19 @@ bool QTranslator::load(const QString &domain, const QString &locale)
         return false;
     }
 
-    return loadFromData(translationfile.readAll());
+    const qint64 translationsize = translationfile.size();
+    uchar *translationdata = nullptr;
+    if (translationsize > 0) {
+        translationdata = translationfile.map(0, translationsize, QFile::MapSequentialHint);
+    }
+    if (!translationdata) {
+        return loadFromData(translationfile.readAll());
+    }
+    // messages are copied out of the data, the mapping is not needed once loaded
+    const bool result = loadFromData(QByteArray::fromRawData(
+        reinterpret_cast<const char*>(translationdata), translationsize));
+    translationfile.unmap(translationdata);
+    return result;
 }
 
 /*!
@@ -204,8 +325,7 @@ bool QTranslator::load(const QString &domain, const QString &locale)
 bool QTranslator::loadFromData(const QByteArray &data)
 {
     Q_D(QTranslator);
-    d->cache.clear();
-    d->converter = QTextConverter();
+    d->clear();
 
     if (data.isEmpty()) {
         qWarning("QTranslator::load: Empty data");
@@ -233,7 +353,9 @@ bool QTranslator::loadFromData(const QByteArray &data)
         trdatastream >> trcache.trmsgstr_plural;
         d->cache.append(trcache);
     }
-    d->converter = QTextConverter(trcodec);
+    d->codec = QTextCodec::codecForName(trcodec);
+    d->utf8 = (d->codec && d->codec->mibEnum() == 106);
+    d->buildIndex();
     // qDebug() << Q_FUNC_INFO << d->cache.size() << (d->cache.size() * sizeof(QTranslatorCache));
     return true;
 }
@@ -243,32 +365,22 @@ bool QTranslator::loadFromData(const QByteArray &data)
     The text will be translated depending on either the locale specified
     when the translation was loaded or the system locale.
 
+    \threadsafe
+
     \sa load()
 */
 QString QTranslator::translate(const char *context, const char *sourceText) const
 {
-    const int sourcelen = qstrlen(sourceText);
     if (isEmpty()) {
-        return QString::fromUtf8(sourceText, sourcelen);
+        return QString::fromUtf8(sourceText);
     }
 
     Q_D(const QTranslator);
-    const int contextlen = qstrlen(context);
-    foreach (const QTranslatorCache &it, d->cache) {
-        // this search method assumes plurals and regular messages are unique strings
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid_plural.constData(), it.trmsgid_plural.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr_plural.constData(), it.trmsgstr_plural.size());
-        }
-
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid.constData(), it.trmsgid.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr.constData(), it.trmsgstr.size());
-        }
+    const QByteArray *msgstr = d->find(context, sourceText);
+    if (msgstr) {
+        return d->toUnicode(*msgstr);
     }
-    return QString::fromUtf8(sourceText, sourcelen);
+    return QString::fromUtf8(sourceText);
 }
 
 /*!
@@ -278,6 +390,8 @@ QString QTranslator::translate(const char *context, const char *sourceText) cons
 
     If no translation is found empty string is returned.
 
+    \threadsafe
+
     \sa load()
 */
 QString QTranslator::translateStrict(const char *context, const char *sourceText) const
@@ -287,21 +401,9 @@ QString QTranslator::translateStrict(const char *context, const char *sourceText
     }
 
     Q_D(const QTranslator);
-    const int contextlen = qstrlen(context);
-    const int sourcelen = qstrlen(sourceText);
-    foreach (const QTranslatorCache &it, d->cache) {
-        // this search method assumes plurals and regular messages are unique strings
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid_plural.constData(), it.trmsgid_plural.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr_plural.constData(), it.trmsgstr_plural.size());
-        }
-
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid.constData(), it.trmsgid.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr.constData(), it.trmsgstr.size());
-        }
+    const QByteArray *msgstr = d->find(context, sourceText);
+    if (msgstr) {
+        return d->toUnicode(*msgstr);
     }
     return QString();
 }
@@ -0,0 +1,370 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qfuture.h"
+#include "qpromise.h"
+#include "qthreadpool.h"
+#include "qwaitcondition.h"
+#include "qcoreapplication.h"
+#include "qobject_p.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+class QFutureInterfaceBasePrivate
+{
+public:
+    QFutureInterfaceBasePrivate(QFutureInterfaceBase::State initialState)
+        : ref(0), state(initialState),
+        progressMinimum(0), progressMaximum(0), progressValue(0)
+    { }
+
+    QAtomicInt ref;
+    mutable QMutex mutex;
+    QWaitCondition finished;
+    int state;
+    QString errorString;
+    int progressMinimum;
+    int progressMaximum;
+    int progressValue;
+    QList<QFutureContinuation *> continuations;
+};
+
+// delivers a continuation in the thread of its context object
+class QFutureCallEvent : public QMetaCallEvent
+{
+public:
+    QFutureCallEvent(QFutureContinuation *continuation)
+        : QMetaCallEvent(0, 0, nullptr, nullptr, -1),
+        continuation(continuation)
+    { }
+
+    ~QFutureCallEvent()
+    {
+        // the context object was destroyed with the event still posted
+        if (continuation) {
+            continuation->drop();
+            delete continuation;
+        }
+    }
+
+    void placeMetaCall(QObject *object)
+    {
+        Q_UNUSED(object);
+        continuation->run();
+        delete continuation;
+        continuation = nullptr;
+    }
+
+private:
+    QFutureContinuation *continuation;
+};
+
+class QFutureContinuationRunnable : public QRunnable
+{
+public:
+    QFutureContinuationRunnable(QFutureContinuation *continuation)
+        : continuation(continuation)
+    { }
+
+    void run()
+    {
+        continuation->run();
+        delete continuation;
+    }
+
+private:
+    QFutureContinuation *continuation;
+};
+
+static void dispatchContinuation(QFutureContinuation *continuation)
+{
+    if (continuation->pool) {
+        continuation->pool->start(new QFutureContinuationRunnable(continuation));
+        return;
+    }
+
+    if (continuation->hasContext) {
+        QObject *context = continuation->context.data();
+        if (!context) {
+            continuation->drop();
+            delete continuation;
+            return;
+        }
+        QCoreApplication::postEvent(context, new QFutureCallEvent(continuation));
+        return;
+    }
+
+    continuation->run();
+    delete continuation;
+}
+
+QFutureContinuation::QFutureContinuation()
+    : pool(nullptr), hasContext(false)
+{
+}
+
+QFutureContinuation::~QFutureContinuation()
+{
+}
+
+QFutureInterfaceBase::QFutureInterfaceBase(State initialState)
+    : d(new QFutureInterfaceBasePrivate(initialState))
+{
+}
+
+QFutureInterfaceBase::~QFutureInterfaceBase()
+{
+    // continuations of a future that never finished hold a reference to
+    // it, there is none left here
+    delete d;
+}
+
+void QFutureInterfaceBase::ref()
+{
+    d->ref.ref();
+}
+
+bool QFutureInterfaceBase::deref()
+{
+    return d->ref.deref();
+}
+
+void QFutureInterfaceBase::reportStarted()
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->state & (Started | Finished)) {
+        return;
+    }
+    d->state |= Started;
+}
+
+void QFutureInterfaceBase::reportFinished()
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->state & Finished) {
+        return;
+    }
+    d->state |= Finished;
+    d->finished.wakeAll();
+    const QList<QFutureContinuation *> continuations = d->continuations;
+    d->continuations.clear();
+    locker.unlock();
+
+    foreach (QFutureContinuation *continuation, continuations) {
+        dispatchContinuation(continuation);
+    }
+}
+
+void QFutureInterfaceBase::reportFailed(const QString &errorString)
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->state & (Canceled | Finished)) {
+        return;
+    }
+    d->state |= Failed;
+    d->errorString = errorString;
+}
+
+void QFutureInterfaceBase::cancel()
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->state & Finished) {
+        return;
+    }
+    d->state |= Canceled;
+}
+
+bool QFutureInterfaceBase::isStarted() const
+{
+    QMutexLocker locker(&d->mutex);
+    return (d->state & Started);
+}
+
+bool QFutureInterfaceBase::isRunning() const
+{
+    QMutexLocker locker(&d->mutex);
+    return ((d->state & (Started | Finished)) == Started);
+}
+
+bool QFutureInterfaceBase::isFinished() const
+{
+    QMutexLocker locker(&d->mutex);
+    return (d->state & Finished);
+}
+
+bool QFutureInterfaceBase::isCanceled() const
+{
+    QMutexLocker locker(&d->mutex);
+    return (d->state & Canceled);
+}
+
+bool QFutureInterfaceBase::isFailed() const
+{
+    QMutexLocker locker(&d->mutex);
+    return (d->state & Failed);
+}
+
+QString QFutureInterfaceBase::errorString() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->errorString;
+}
+
+void QFutureInterfaceBase::setProgressRange(int minimum, int maximum)
+{
+    QMutexLocker locker(&d->mutex);
+    d->progressMinimum = minimum;
+    d->progressMaximum = qMax(minimum, maximum);
+    d->progressValue = qBound(d->progressMinimum, d->progressValue, d->progressMaximum);
+}
+
+void QFutureInterfaceBase::setProgressValue(int progressValue)
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->state & (Canceled | Finished)) {
+        return;
+    }
+    d->progressValue = qBound(d->progressMinimum, progressValue, d->progressMaximum);
+}
+
+int QFutureInterfaceBase::progressMinimum() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->progressMinimum;
+}
+
+int QFutureInterfaceBase::progressMaximum() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->progressMaximum;
+}
+
+int QFutureInterfaceBase::progressValue() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->progressValue;
+}
+
+void QFutureInterfaceBase::waitForFinished()
+{
+    QMutexLocker locker(&d->mutex);
+    while (!(d->state & Finished)) {
+        d->finished.wait(locker.mutex());
+    }
+}
+
+void QFutureInterfaceBase::addContinuation(QFutureContinuation *continuation)
+{
+    QMutexLocker locker(&d->mutex);
+    if (!(d->state & Finished)) {
+        d->continuations.append(continuation);
+        return;
+    }
+    locker.unlock();
+
+    dispatchContinuation(continuation);
+}
+
+QMutex *QFutureInterfaceBase::mutex() const
+{
+    return &d->mutex;
+}
+
+/*!
+    \class QFuture
+    \brief The QFuture class represents the result of an asynchronous
+    computation.
+
+    \threadsafe
+
+    \ingroup thread
+
+    A QFuture is obtained from the QPromise of the code doing the work. It
+    can be queried for the state of the computation with isRunning(),
+    isFinished(), isCanceled() and isFailed(), for its progress with
+    progressValue(), and waited for with waitForFinished() or result().
+
+    Instead of waiting, further work can be attached with then(). The
+    continuation is called with the result once the future is finished
+    and returns a new QFuture for what it returns, so that continuations
+    can be chained. Where the continuation runs depends on the overload:
+
+    \list
+    \o then(function) runs it in the thread that finishes the future, or
+       right away if the future is already finished.
+    \o then(context, function) posts it to the thread of the \a context
+       QObject, where it is run from the event loop. If the context is
+       destroyed first the continuation is not run and its future is
+       canceled.
+    \o then(pool, function) runs it in a thread of the QThreadPool.
+    \endlist
+
+    A failure reported with QPromise::setFailed() skips the then()
+    continuations and is passed down the chain until a continuation
+    attached with onFailed() handles it; onFailed() is called with the
+    error string and returns the result to use instead. A canceled future
+    cancels the futures of its continuations without calling them.
+
+    Cancelling a future with cancel() only sets a flag, the code doing the
+    work polls it with QPromise::isCanceled() and finishes early.
+
+    \sa QPromise, QThreadPool
+*/
+
+/*!
+    \fn QFuture::QFuture()
+
+    Constructs an empty future which is finished and canceled.
+*/
+
+/*!
+    \fn T QFuture::result() const
+
+    Waits for the future to finish and returns its result.
+*/
+
+/*!
+    \class QPromise
+    \brief The QPromise class is the producer side of a QFuture.
+
+    \threadsafe
+
+    \ingroup thread
+
+    The code doing the work keeps the QPromise and hands the QFuture
+    returned by future() to its caller. It calls start() when it starts,
+    reports progress with setProgressRange() and setProgressValue(),
+    stores the result with addResult() or reports an error with
+    setFailed(), and finally calls finish() which runs the continuations
+    of the future.
+
+    A promise destroyed without calling finish() cancels and finishes its
+    future, so that nobody waits for it forever.
+
+    \sa QFuture
+*/
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
@@ -0,0 +1,392 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QFUTURE_H
+#define QFUTURE_H
+
+#include <QtCore/qstring.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qmutex.h>
+
+#include <utility>
+
+
+QT_BEGIN_NAMESPACE
+
+
+#ifndef QT_NO_THREAD
+
+class QThreadPool;
+class QFutureInterfaceBasePrivate;
+
+class Q_CORE_EXPORT QFutureContinuation
+{
+public:
+    QFutureContinuation();
+    virtual ~QFutureContinuation();
+
+    // called once the parent future is finished
+    virtual void run() = 0;
+    // called instead of run() when the context object is gone
+    virtual void drop() = 0;
+
+    QPointer<QObject> context;
+    QThreadPool *pool;
+    bool hasContext;
+
+private:
+    Q_DISABLE_COPY(QFutureContinuation)
+};
+
+class Q_CORE_EXPORT QFutureInterfaceBase
+{
+public:
+    enum State {
+        NoState = 0x00,
+        Started = 0x01,
+        Finished = 0x02,
+        Canceled = 0x04,
+        Failed = 0x08
+    };
+
+    QFutureInterfaceBase(State initialState = NoState);
+    virtual ~QFutureInterfaceBase();
+
+    void ref();
+    bool deref();
+
+    void reportStarted();
+    void reportFinished();
+    void reportFailed(const QString &errorString);
+    void cancel();
+
+    bool isStarted() const;
+    bool isRunning() const;
+    bool isFinished() const;
+    bool isCanceled() const;
+    bool isFailed() const;
+    QString errorString() const;
+
+    void setProgressRange(int minimum, int maximum);
+    void setProgressValue(int progressValue);
+    int progressMinimum() const;
+    int progressMaximum() const;
+    int progressValue() const;
+
+    void waitForFinished();
+    void addContinuation(QFutureContinuation *continuation);
+
+    QMutex *mutex() const;
+
+private:
+    Q_DISABLE_COPY(QFutureInterfaceBase)
+
+    QFutureInterfaceBasePrivate *d;
+};
+
+template <typename T>
+class QFutureInterface : public QFutureInterfaceBase
+{
+public:
+    inline QFutureInterface(State initialState = NoState)
+        : QFutureInterfaceBase(initialState), m_result() { }
+
+    void reportResult(const T &result);
+    inline const T &resultReference() const { return m_result; }
+
+private:
+    T m_result;
+};
+
+template <>
+class QFutureInterface<void> : public QFutureInterfaceBase
+{
+public:
+    inline QFutureInterface(State initialState = NoState)
+        : QFutureInterfaceBase(initialState) { }
+};
+
+template <typename T>
+void QFutureInterface<T>::reportResult(const T &result)
+{
+    QMutexLocker locker(mutex());
+    m_result = result;
+}
+
+// the type returned by a continuation taking the result of a QFuture<T>
+template <typename T, typename F>
+struct QFutureCallResult
+{
+    typedef decltype(std::declval<F>()(std::declval<T>())) Type;
+};
+
+template <typename F>
+struct QFutureCallResult<void, F>
+{
+    typedef decltype(std::declval<F>()()) Type;
+};
+
+// calls a continuation with the result of the parent and stores what it returns
+template <typename T, typename R>
+struct QFutureCall
+{
+    template <typename F>
+    static void call(F &function, QFutureInterface<T> *parent, QFutureInterface<R> *child)
+    { child->reportResult(function(parent->resultReference())); }
+    template <typename F>
+    static void fail(F &function, const QString &errorString, QFutureInterface<R> *child)
+    { child->reportResult(function(errorString)); }
+    static void forward(QFutureInterface<T> *parent, QFutureInterface<R> *child)
+    { child->reportResult(parent->resultReference()); }
+};
+
+template <typename R>
+struct QFutureCall<void, R>
+{
+    template <typename F>
+    static void call(F &function, QFutureInterface<void> *, QFutureInterface<R> *child)
+    { child->reportResult(function()); }
+};
+
+template <typename T>
+struct QFutureCall<T, void>
+{
+    template <typename F>
+    static void call(F &function, QFutureInterface<T> *parent, QFutureInterface<void> *)
+    { function(parent->resultReference()); }
+};
+
+template <>
+struct QFutureCall<void, void>
+{
+    template <typename F>
+    static void call(F &function, QFutureInterface<void> *, QFutureInterface<void> *)
+    { function(); }
+    template <typename F>
+    static void fail(F &function, const QString &errorString, QFutureInterface<void> *)
+    { function(errorString); }
+    static void forward(QFutureInterface<void> *, QFutureInterface<void> *)
+    { }
+};
+
+// then() continuations run on success and pass failures on, onFailed()
+// continuations run on failure and pass results on
+template <typename T, typename R, bool OnFailed>
+struct QFutureDispatch
+{
+    template <typename F>
+    static void succeeded(F &function, QFutureInterface<T> *parent, QFutureInterface<R> *child)
+    { QFutureCall<T, R>::call(function, parent, child); }
+    template <typename F>
+    static void failed(F &, QFutureInterface<T> *parent, QFutureInterface<R> *child)
+    { child->reportFailed(parent->errorString()); }
+};
+
+template <typename T>
+struct QFutureDispatch<T, T, true>
+{
+    template <typename F>
+    static void succeeded(F &, QFutureInterface<T> *parent, QFutureInterface<T> *child)
+    { QFutureCall<T, T>::forward(parent, child); }
+    template <typename F>
+    static void failed(F &function, QFutureInterface<T> *parent, QFutureInterface<T> *child)
+    { QFutureCall<T, T>::fail(function, parent->errorString(), child); }
+};
+
+template <typename T, typename R, typename F, bool OnFailed>
+class QFutureCallContinuation : public QFutureContinuation
+{
+public:
+    QFutureCallContinuation(QFutureInterface<T> *parent, QFutureInterface<R> *child, const F &function)
+        : parent(parent), child(child), function(function)
+    { parent->ref(); child->ref(); }
+
+    ~QFutureCallContinuation()
+    {
+        if (!parent->deref())
+            delete parent;
+        if (!child->deref())
+            delete child;
+    }
+
+    void run()
+    {
+        if (parent->isCanceled() || child->isCanceled()) {
+            drop();
+            return;
+        }
+
+        child->reportStarted();
+        if (parent->isFailed())
+            QFutureDispatch<T, R, OnFailed>::failed(function, parent, child);
+        else
+            QFutureDispatch<T, R, OnFailed>::succeeded(function, parent, child);
+        child->reportFinished();
+    }
+
+    void drop()
+    {
+        child->cancel();
+        child->reportFinished();
+    }
+
+private:
+    QFutureInterface<T> *parent;
+    QFutureInterface<R> *child;
+    F function;
+};
+
+template <typename T>
+class QFuture
+{
+public:
+    inline QFuture()
+        : d(new QFutureInterface<T>(QFutureInterfaceBase::State(QFutureInterfaceBase::Canceled | QFutureInterfaceBase::Finished)))
+    { d->ref(); }
+    inline explicit QFuture(QFutureInterface<T> *p)
+        : d(p)
+    { d->ref(); }
+    inline QFuture(const QFuture &other)
+        : d(other.d)
+    { d->ref(); }
+    inline ~QFuture()
+    { if (!d->deref()) delete d; }
+
+    QFuture &operator=(const QFuture &other);
+
+    inline bool operator==(const QFuture &other) const { return (d == other.d); }
+    inline bool operator!=(const QFuture &other) const { return (d != other.d); }
+
+    inline bool isStarted() const { return d->isStarted(); }
+    inline bool isRunning() const { return d->isRunning(); }
+    inline bool isFinished() const { return d->isFinished(); }
+    inline bool isCanceled() const { return d->isCanceled(); }
+    inline bool isFailed() const { return d->isFailed(); }
+    inline QString errorString() const { return d->errorString(); }
+
+    inline void cancel() { d->cancel(); }
+    inline void waitForFinished() { d->waitForFinished(); }
+
+    inline int progressMinimum() const { return d->progressMinimum(); }
+    inline int progressMaximum() const { return d->progressMaximum(); }
+    inline int progressValue() const { return d->progressValue(); }
+
+    T result() const;
+
+    template <typename F>
+    QFuture<typename QFutureCallResult<T, F>::Type> then(const F &function) const;
+    template <typename F>
+    QFuture<typename QFutureCallResult<T, F>::Type> then(QObject *context, const F &function) const;
+    template <typename F>
+    QFuture<typename QFutureCallResult<T, F>::Type> then(QThreadPool *pool, const F &function) const;
+
+    template <typename F>
+    QFuture<T> onFailed(const F &function) const;
+    template <typename F>
+    QFuture<T> onFailed(QObject *context, const F &function) const;
+
+private:
+    template <typename R, bool OnFailed, typename F>
+    QFuture<R> chain(QObject *context, QThreadPool *pool, const F &function) const;
+
+    QFutureInterface<T> *d;
+};
+
+template <typename T>
+QFuture<T> &QFuture<T>::operator=(const QFuture<T> &other)
+{
+    other.d->ref();
+    if (!d->deref())
+        delete d;
+    d = other.d;
+    return *this;
+}
+
+template <typename T>
+T QFuture<T>::result() const
+{
+    d->waitForFinished();
+    QMutexLocker locker(d->mutex());
+    return d->resultReference();
+}
+
+template <>
+inline void QFuture<void>::result() const
+{
+    d->waitForFinished();
+}
+
+template <typename T>
+template <typename R, bool OnFailed, typename F>
+QFuture<R> QFuture<T>::chain(QObject *context, QThreadPool *pool, const F &function) const
+{
+    QFutureInterface<R> *child = new QFutureInterface<R>();
+    QFuture<R> future(child);
+    QFutureContinuation *continuation = new QFutureCallContinuation<T, R, F, OnFailed>(d, child, function);
+    continuation->context = context;
+    continuation->hasContext = (context != nullptr);
+    continuation->pool = pool;
+    d->addContinuation(continuation);
+    return future;
+}
+
+template <typename T>
+template <typename F>
+QFuture<typename QFutureCallResult<T, F>::Type> QFuture<T>::then(const F &function) const
+{
+    return chain<typename QFutureCallResult<T, F>::Type, false>(nullptr, nullptr, function);
+}
+
+template <typename T>
+template <typename F>
+QFuture<typename QFutureCallResult<T, F>::Type> QFuture<T>::then(QObject *context, const F &function) const
+{
+    return chain<typename QFutureCallResult<T, F>::Type, false>(context, nullptr, function);
+}
+
+template <typename T>
+template <typename F>
+QFuture<typename QFutureCallResult<T, F>::Type> QFuture<T>::then(QThreadPool *pool, const F &function) const
+{
+    return chain<typename QFutureCallResult<T, F>::Type, false>(nullptr, pool, function);
+}
+
+template <typename T>
+template <typename F>
+QFuture<T> QFuture<T>::onFailed(const F &function) const
+{
+    return chain<T, true>(nullptr, nullptr, function);
+}
+
+template <typename T>
+template <typename F>
+QFuture<T> QFuture<T>::onFailed(QObject *context, const F &function) const
+{
+    return chain<T, true>(context, nullptr, function);
+}
+
+#endif // QT_NO_THREAD
+
+QT_END_NAMESPACE
+
+
+#endif // QFUTURE_H
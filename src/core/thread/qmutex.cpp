@@ -23,8 +23,92 @@
 
 #ifndef QT_NO_THREAD
 
+#include <chrono>
+
+#if defined(Q_OS_LINUX)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <errno.h>
+#else
+#  include <mutex>
+#  include <condition_variable>
+#endif
+
 QT_BEGIN_NAMESPACE
 
+// upper limit of how many times a contended lock is retried before the thread
+// goes to sleep, the actual count adapts to how long the mutex is usually held
+#define QT_MUTEX_MAX_SPINS 100
+
+static inline void qt_cpu_relax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+#if defined(Q_OS_LINUX)
+static_assert(sizeof(QAtomicInt) == sizeof(int), "QAtomicInt must be usable as futex word");
+
+// sleeps while value equals expected, nsecs is the timeout or -1 to wait forever
+static inline bool qt_futex_wait(QAtomicInt *value, int expected, qint64 nsecs)
+{
+    struct timespec ts;
+    if (nsecs >= 0) {
+        ts.tv_sec = nsecs / 1000000000;
+        ts.tv_nsec = nsecs % 1000000000;
+    }
+    const long result = ::syscall(SYS_futex, reinterpret_cast<int *>(value),
+        FUTEX_WAIT_PRIVATE, expected, (nsecs >= 0 ? &ts : nullptr), nullptr, 0);
+    return (result == 0 || errno != ETIMEDOUT);
+}
+
+static inline void qt_futex_wake(QAtomicInt *value, int count)
+{
+    ::syscall(SYS_futex, reinterpret_cast<int *>(value),
+        FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+#else
+// emulated with a table of wait queues, mutexes hashing to the same bucket
+// share it and wake-ups are broadcast
+struct QFutexBucket
+{
+    std::mutex mutex;
+    std::condition_variable cond;
+};
+static QFutexBucket qt_futex_buckets[64];
+
+static inline QFutexBucket* qt_futex_bucket(QAtomicInt *value)
+{
+    return &qt_futex_buckets[(reinterpret_cast<quintptr>(value) >> 4) % 64];
+}
+
+static inline bool qt_futex_wait(QAtomicInt *value, int expected, qint64 nsecs)
+{
+    QFutexBucket *bucket = qt_futex_bucket(value);
+    std::unique_lock<std::mutex> locker(bucket->mutex);
+    if (value->load() != expected) {
+        return true;
+    }
+    if (nsecs < 0) {
+        bucket->cond.wait(locker);
+        return true;
+    }
+    return (bucket->cond.wait_for(locker, std::chrono::nanoseconds(nsecs)) == std::cv_status::no_timeout);
+}
+
+static inline void qt_futex_wake(QAtomicInt *value, int count)
+{
+    Q_UNUSED(count);
+    QFutexBucket *bucket = qt_futex_bucket(value);
+    std::lock_guard<std::mutex> locker(bucket->mutex);
+    bucket->cond.notify_all();
+}
+#endif
+
 /*!
     \class QMutex
     \brief The QMutex class provides access serialization between threads.
@@ -116,7 +200,6 @@ QT_BEGIN_NAMESPACE
 */
 
 /*!
-    \fn bool QMutex::tryLock(int timeout)
     \overload
 
     Attempts to lock the mutex. This function returns true if the lock
@@ -136,6 +219,28 @@ QT_BEGIN_NAMESPACE
 
     \sa lock(), unlock()
 */
+bool QMutex::tryLock(int timeout)
+{
+    if (timeout < 0) {
+        lock();
+        return true;
+    }
+    if (state.testAndSetAcquire(0, 1)) {
+        return true;
+    }
+
+    const std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    while (state.fetchAndStoreAcquire(2) != 0) {
+        const qint64 remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) {
+            return false;
+        }
+        qt_futex_wait(&state, 2, remaining);
+    }
+    return true;
+}
 
 /*!
     \fn void QMutex::unlock()
@@ -147,6 +252,45 @@ QT_BEGIN_NAMESPACE
     \sa lock()
 */
 
+/*!
+    \internal
+
+    Called by lock() when the mutex is already locked. Spins for a while since
+    critical sections are usually short, then marks the mutex as contended and
+    sleeps until unlock() wakes it up.
+*/
+void QMutex::lockInternal()
+{
+    const int current = spins.load();
+    const int maxspins = qMin(current * 2 + 10, QT_MUTEX_MAX_SPINS);
+    bool locked = false;
+    int count = 0;
+    while (!locked && count < maxspins) {
+        qt_cpu_relax();
+        count++;
+        locked = (state.load() == 0 && state.testAndSetAcquire(0, 1));
+    }
+    // moving average of how many spins it took, as glibc adaptive mutexes do
+    spins.store(current + (count - current) / 8);
+    if (locked) {
+        return;
+    }
+
+    while (state.fetchAndStoreAcquire(2) != 0) {
+        qt_futex_wait(&state, 2, -1);
+    }
+}
+
+/*!
+    \internal
+
+    Called by unlock() when other threads may be sleeping on the mutex.
+*/
+void QMutex::unlockInternal()
+{
+    qt_futex_wake(&state, 1);
+}
+
 /*!
     \fn bool QMutex::locked()
 
@@ -22,9 +22,7 @@
 #ifndef QMUTEX_H
 #define QMUTEX_H
 
-#include <QtCore/qglobal.h>
-
-#include <mutex>
+#include <QtCore/qatomic.h>
 
 
 QT_BEGIN_NAMESPACE
@@ -34,29 +32,34 @@ QT_BEGIN_NAMESPACE
 class Q_CORE_EXPORT QMutex
 {
 public:
-    QMutex() { }
+    QMutex() : state(0), spins(0) { }
     ~QMutex() { }
 
     inline void lock() {
-        mutex.lock();
+        if (!state.testAndSetAcquire(0, 1))
+            lockInternal();
     }
 
     inline bool tryLock() {
-        return mutex.try_lock();
+        return state.testAndSetAcquire(0, 1);
     }
 
-    inline bool tryLock(int timeout) {
-        return mutex.try_lock_for(std::chrono::milliseconds(timeout));
-    }
+    bool tryLock(int timeout);
 
     inline void unlock() {
-        mutex.unlock();
+        if (state.fetchAndStoreRelease(0) != 1)
+            unlockInternal();
     }
 
 private:
     Q_DISABLE_COPY(QMutex)
 
-    std::timed_mutex mutex;
+    void lockInternal();
+    void unlockInternal();
+
+    // 0 - unlocked, 1 - locked, 2 - locked and other threads may be waiting
+    QAtomicInt state;
+    QAtomicInt spins;
 };
 
 class Q_CORE_EXPORT QMutexLocker
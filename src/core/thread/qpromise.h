@@ -0,0 +1,87 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QPROMISE_H
+#define QPROMISE_H
+
+#include <QtCore/qfuture.h>
+
+
+QT_BEGIN_NAMESPACE
+
+
+#ifndef QT_NO_THREAD
+
+template <typename T>
+class QPromiseBase
+{
+public:
+    inline QPromiseBase()
+        : d(new QFutureInterface<T>())
+    { d->ref(); }
+    inline ~QPromiseBase()
+    {
+        // a promise that is dropped before it is finished cancels its future
+        if (!d->isFinished()) {
+            d->cancel();
+            d->reportFinished();
+        }
+        if (!d->deref())
+            delete d;
+    }
+
+    inline QFuture<T> future() const { return QFuture<T>(d); }
+
+    inline void start() { d->reportStarted(); }
+    inline void finish() { d->reportFinished(); }
+    inline void setFailed(const QString &errorString) { d->reportFailed(errorString); }
+
+    inline bool isCanceled() const { return d->isCanceled(); }
+
+    inline void setProgressRange(int minimum, int maximum) { d->setProgressRange(minimum, maximum); }
+    inline void setProgressValue(int progressValue) { d->setProgressValue(progressValue); }
+
+protected:
+    QFutureInterface<T> *d;
+
+private:
+    Q_DISABLE_COPY(QPromiseBase)
+};
+
+template <typename T>
+class QPromise : public QPromiseBase<T>
+{
+public:
+    inline void addResult(const T &result) { this->d->reportResult(result); }
+};
+
+template <>
+class QPromise<void> : public QPromiseBase<void>
+{
+};
+
+#endif // QT_NO_THREAD
+
+QT_END_NAMESPACE
+
+
+#endif // QPROMISE_H
@@ -0,0 +1,423 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qreadwritelock.h"
+
+#ifndef QT_NO_THREAD
+#include "qatomic.h"
+#include "qmutex.h"
+#include "qwaitcondition.h"
+#include "qelapsedtimer.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QReadWriteLock
+    \brief The QReadWriteLock class provides read-write locking.
+
+    \threadsafe
+
+    \ingroup thread
+
+    A read-write lock is a synchronization tool for protecting
+    resources that can be accessed for reading and writing. This type
+    of lock is useful if you want to allow multiple threads to have
+    simultaneous read-only access, but as soon as one thread wants to
+    write to the resource, all other threads must be blocked until
+    the writing is complete.
+
+    In many cases, QReadWriteLock is a direct competitor to QMutex.
+    QReadWriteLock is a good choice if there are many concurrent
+    reads and writing occurs infrequently.
+
+    To ensure that writers aren't blocked forever by readers, readers
+    attempting to obtain a lock will not succeed if there is a blocked
+    writer waiting for access, even if the lock is currently only
+    accessed by other readers. This also means that a thread holding a
+    read lock must not try to lock for reading again, since it would
+    deadlock as soon as a writer is waiting.
+
+    Locking and unlocking without contention is done with a single
+    atomic operation, threads only sleep when the lock is held in a
+    conflicting mode.
+
+    \sa QReadLocker, QWriteLocker, QMutex, QSemaphore
+*/
+
+class QReadWriteLockPrivate
+{
+public:
+    QReadWriteLockPrivate() : state(0), waiting(0), writersWaiting(0) { }
+
+    inline bool tryLockForRead();
+    inline bool tryLockForWrite();
+    bool lockSlow(bool write, int timeout);
+    void wakeWaiting();
+
+    // number of readers holding the lock or -1 if locked for writing
+    QAtomicInt state;
+    // threads sleeping in lockSlow() and how many of them are writers
+    QAtomicInt waiting;
+    QAtomicInt writersWaiting;
+
+    QMutex mutex;
+    QWaitCondition cond;
+};
+
+inline bool QReadWriteLockPrivate::tryLockForRead()
+{
+    int current = state.load();
+    while (current >= 0 && writersWaiting.load() == 0) {
+        if (state.testAndSetAcquire(current, current + 1)) {
+            return true;
+        }
+        current = state.load();
+    }
+    return false;
+}
+
+inline bool QReadWriteLockPrivate::tryLockForWrite()
+{
+    return state.testAndSetAcquire(0, -1);
+}
+
+bool QReadWriteLockPrivate::lockSlow(bool write, int timeout)
+{
+    QElapsedTimer timer;
+    if (timeout > 0) {
+        timer.start();
+    }
+
+    QMutexLocker locker(&mutex);
+    // the counters are incremented before retrying so that an unlock() either
+    // sees them and wakes this thread up or happens before the retry
+    waiting.ref();
+    if (write) {
+        writersWaiting.ref();
+    }
+
+    bool locked = true;
+    while (write ? !tryLockForWrite() : !tryLockForRead()) {
+        if (timeout < 0) {
+            cond.wait(&mutex);
+            continue;
+        }
+        const qint64 remaining = qint64(timeout) - (timeout > 0 ? timer.elapsed() : 0);
+        if (remaining <= 0 || !cond.wait(&mutex, remaining)) {
+            locked = (write ? tryLockForWrite() : tryLockForRead());
+            break;
+        }
+    }
+
+    waiting.deref();
+    if (write && !writersWaiting.deref() && !locked) {
+        // readers may have been held back only by this writer
+        cond.wakeAll();
+    }
+    return locked;
+}
+
+void QReadWriteLockPrivate::wakeWaiting()
+{
+    if (waiting.load() > 0) {
+        QMutexLocker locker(&mutex);
+        cond.wakeAll();
+    }
+}
+
+/*!
+    Constructs a QReadWriteLock object.
+
+    \sa lockForRead(), lockForWrite()
+*/
+QReadWriteLock::QReadWriteLock()
+    : d(new QReadWriteLockPrivate())
+{
+}
+
+/*!
+    Destroys the QReadWriteLock object.
+
+    \warning Destroying a read-write lock that is in use may result
+    in undefined behavior.
+*/
+QReadWriteLock::~QReadWriteLock()
+{
+    delete d;
+}
+
+/*!
+    Locks the lock for reading. This function will block the current
+    thread if any thread (including the current) has locked for
+    writing.
+
+    \sa unlock() lockForWrite() tryLockForRead()
+*/
+void QReadWriteLock::lockForRead()
+{
+    if (!d->tryLockForRead()) {
+        d->lockSlow(false, -1);
+    }
+}
+
+/*!
+    Attempts to lock for reading. If the lock was obtained, this
+    function returns true, otherwise it returns false instead of
+    waiting for the lock to become available, i.e. it does not block.
+
+    The lock attempt will fail if another thread has locked for
+    writing.
+
+    If the lock was obtained, the lock must be unlocked with unlock()
+    before another thread can successfully lock it for writing.
+
+    \sa unlock() lockForRead()
+*/
+bool QReadWriteLock::tryLockForRead()
+{
+    return d->tryLockForRead();
+}
+
+/*! \overload
+
+    Attempts to lock for reading. This function returns true if the
+    lock was obtained; otherwise it returns false. If another thread
+    has locked for writing, this function will wait for at most \a
+    timeout milliseconds for the lock to become available.
+
+    Note: Passing a negative number as the \a timeout is equivalent to
+    calling lockForRead(), i.e. this function will wait forever until
+    lock can be locked for reading when \a timeout is negative.
+
+    If the lock was obtained, the lock must be unlocked with unlock()
+    before another thread can successfully lock it for writing.
+
+    \sa unlock() lockForRead()
+*/
+bool QReadWriteLock::tryLockForRead(int timeout)
+{
+    if (d->tryLockForRead()) {
+        return true;
+    }
+    return d->lockSlow(false, timeout);
+}
+
+/*!
+    Locks the lock for writing. This function will block the current
+    thread if another thread has locked for reading or writing.
+
+    \sa unlock() lockForRead() tryLockForWrite()
+*/
+void QReadWriteLock::lockForWrite()
+{
+    if (!d->tryLockForWrite()) {
+        d->lockSlow(true, -1);
+    }
+}
+
+/*!
+    Attempts to lock for writing. If the lock was obtained, this
+    function returns true; otherwise, it returns false immediately.
+
+    The lock attempt will fail if another thread has locked for
+    reading or writing.
+
+    If the lock was obtained, the lock must be unlocked with unlock()
+    before another thread can successfully lock it.
+
+    \sa unlock() lockForWrite()
+*/
+bool QReadWriteLock::tryLockForWrite()
+{
+    return d->tryLockForWrite();
+}
+
+/*! \overload
+
+    Attempts to lock for writing. This function returns true if the
+    lock was obtained; otherwise it returns false. If another thread
+    has locked for reading or writing, this function will wait for at
+    most \a timeout milliseconds for the lock to become available.
+
+    Note: Passing a negative number as the \a timeout is equivalent to
+    calling lockForWrite(), i.e. this function will wait forever until
+    lock can be locked for writing when \a timeout is negative.
+
+    If the lock was obtained, the lock must be unlocked with unlock()
+    before another thread can successfully lock it.
+
+    \sa unlock() lockForWrite()
+*/
+bool QReadWriteLock::tryLockForWrite(int timeout)
+{
+    if (d->tryLockForWrite()) {
+        return true;
+    }
+    return d->lockSlow(true, timeout);
+}
+
+/*!
+    Unlocks the lock.
+
+    Attempting to unlock a lock that is not locked results in undefined
+    behavior.
+
+    \sa lockForRead() lockForWrite() tryLockForRead() tryLockForWrite()
+*/
+void QReadWriteLock::unlock()
+{
+    int current = d->state.load();
+    Q_ASSERT_X(current != 0, "QReadWriteLock::unlock()", "Cannot unlock an unlocked lock");
+    if (current == -1) {
+        d->state.fetchAndStoreOrdered(0);
+        d->wakeWaiting();
+        return;
+    }
+    // only the last reader can let a writer in
+    if (d->state.fetchAndAddOrdered(-1) == 1) {
+        d->wakeWaiting();
+    }
+}
+
+/*!
+    \class QReadLocker
+    \brief The QReadLocker class is a convenience class that
+    simplifies locking and unlocking read-write locks for read access.
+
+    \threadsafe
+
+    \ingroup thread
+
+    The purpose of QReadLocker (and QWriteLocker) is to simplify
+    QReadWriteLock locking and unlocking. Locking and unlocking
+    statements or in exception handling code is error-prone and
+    difficult to debug. QReadLocker can be used in such situations
+    to ensure that the state of the lock is always well-defined.
+
+    \sa QWriteLocker, QReadWriteLock
+*/
+
+/*!
+    \fn QReadLocker::QReadLocker(QReadWriteLock *lock)
+
+    Constructs a QReadLocker and locks \a lock for reading. The lock
+    will be unlocked when the QReadLocker is destroyed. If \c lock is
+    zero, QReadLocker does nothing.
+
+    \sa QReadWriteLock::lockForRead()
+*/
+
+/*!
+    \fn QReadLocker::~QReadLocker()
+
+    Destroys the QReadLocker and unlocks the lock that was passed to
+    the constructor.
+
+    \sa QReadWriteLock::unlock()
+*/
+
+/*!
+    \fn void QReadLocker::unlock()
+
+    Unlocks the lock associated with this locker.
+
+    \sa QReadWriteLock::unlock()
+*/
+
+/*!
+    \fn void QReadLocker::relock()
+
+    Relocks an unlocked lock.
+
+    \sa unlock()
+*/
+
+/*!
+    \fn QReadWriteLock *QReadLocker::readWriteLock() const
+
+    Returns a pointer to the read-write lock that was passed
+    to the constructor.
+*/
+
+/*!
+    \class QWriteLocker
+    \brief The QWriteLocker class is a convenience class that
+    simplifies locking and unlocking read-write locks for write access.
+
+    \threadsafe
+
+    \ingroup thread
+
+    The purpose of QWriteLocker (and QReadLocker) is to simplify
+    QReadWriteLock locking and unlocking. Locking and unlocking
+    statements or in exception handling code is error-prone and
+    difficult to debug. QWriteLocker can be used in such situations
+    to ensure that the state of the lock is always well-defined.
+
+    \sa QReadLocker, QReadWriteLock
+*/
+
+/*!
+    \fn QWriteLocker::QWriteLocker(QReadWriteLock *lock)
+
+    Constructs a QWriteLocker and locks \a lock for writing. The lock
+    will be unlocked when the QWriteLocker is destroyed. If \c lock is
+    zero, QWriteLocker does nothing.
+
+    \sa QReadWriteLock::lockForWrite()
+*/
+
+/*!
+    \fn QWriteLocker::~QWriteLocker()
+
+    Destroys the QWriteLocker and unlocks the lock that was passed to
+    the constructor.
+
+    \sa QReadWriteLock::unlock()
+*/
+
+/*!
+    \fn void QWriteLocker::unlock()
+
+    Unlocks the lock associated with this locker.
+
+    \sa QReadWriteLock::unlock()
+*/
+
+/*!
+    \fn void QWriteLocker::relock()
+
+    Relocks an unlocked lock.
+
+    \sa unlock()
+*/
+
+/*!
+    \fn QReadWriteLock *QWriteLocker::readWriteLock() const
+
+    Returns a pointer to the read-write lock that was passed
+    to the constructor.
+*/
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
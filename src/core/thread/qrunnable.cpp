@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qrunnable.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QRunnable
+    \brief The QRunnable class is the base class for all runnable objects.
+
+    \ingroup thread
+
+    The QRunnable class is an interface for representing a task or
+    piece of code that needs to be executed, represented by your
+    reimplementation of the run() function.
+
+    You can use QThreadPool to execute your code in a separate
+    thread. QThreadPool deletes the QRunnable automatically if
+    autoDelete() returns true (the default). Use setAutoDelete() to
+    change the auto-deletion flag.
+
+    QThreadPool supports executing the same QRunnable more than once
+    by calling QThreadPool::tryStart(this) from within the run() function.
+    If autoDelete is enabled the QRunnable will be deleted when
+    the last thread exits the run function. Calling QThreadPool::start()
+    multiple times with the same QRunnable when autoDelete is enabled
+    creates a race condition and is not recommended.
+
+    \sa QThreadPool
+*/
+
+/*! \fn QRunnable::run()
+    Implement this pure virtual function in your subclass.
+*/
+
+/*! \fn QRunnable::QRunnable()
+    Constructs a QRunnable. Auto-deletion is enabled by default.
+
+    \sa autoDelete(), setAutoDelete()
+*/
+
+/*!
+    QRunnable virtual destructor.
+*/
+QRunnable::~QRunnable()
+{
+}
+
+/*! \fn bool QRunnable::autoDelete() const
+
+    Returns true is auto-deletion is enabled; false otherwise.
+
+    If auto-deletion is enabled, QThreadPool will automatically delete
+    this runnable after calling run(); otherwise, ownership remains
+    with the application programmer.
+
+    \sa setAutoDelete(), QThreadPool
+*/
+
+/*! \fn void QRunnable::setAutoDelete(bool autoDelete)
+
+    Enables auto-deletion if \a autoDelete is true; otherwise
+    auto-deletion is disabled.
+
+    If auto-deletion is enabled, QThreadPool will automatically delete
+    this runnable after calling run(); otherwise, ownership remains
+    with the application programmer.
+
+    Note that this flag must be set before calling
+    QThreadPool::start(). Calling this function after
+    QThreadPool::start() results in undefined behavior.
+
+    \sa autoDelete(), QThreadPool
+*/
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
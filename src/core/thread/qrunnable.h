@@ -0,0 +1,60 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QRUNNABLE_H
+#define QRUNNABLE_H
+
+#include <QtCore/qatomic.h>
+
+
+QT_BEGIN_NAMESPACE
+
+
+#ifndef QT_NO_THREAD
+
+class Q_CORE_EXPORT QRunnable
+{
+public:
+    QRunnable() : ref(0) { }
+    virtual ~QRunnable();
+
+    virtual void run() = 0;
+
+    bool autoDelete() const { return ref.load() != -1; }
+    void setAutoDelete(bool autoDelete) { ref.store(autoDelete ? 0 : -1); }
+
+private:
+    Q_DISABLE_COPY(QRunnable)
+
+    QAtomicInt ref;
+
+    friend class QThreadPool;
+    friend class QThreadPoolPrivate;
+    friend class QThreadPoolThread;
+};
+
+#endif // QT_NO_THREAD
+
+QT_END_NAMESPACE
+
+
+#endif // QRUNNABLE_H
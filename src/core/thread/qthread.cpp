@@ -51,6 +51,7 @@ QThreadData::~QThreadData()
     delete thread;
     thread = nullptr;
 
+    flushPostEventQueue();
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
@@ -79,6 +80,44 @@ void QThreadData::deref()
 #endif
 }
 
+// must be called with postEventList.mutex locked
+void QThreadData::flushPostEventQueue()
+{
+    QPostEventNode *node = postEventList.queue.fetchAndStoreOrdered(nullptr);
+
+    // restore the order in which the events were posted
+    QPostEventNode *first = nullptr;
+    while (node) {
+        QPostEventNode *next = node->next;
+        node->next = first;
+        first = node;
+        node = next;
+    }
+
+    while (first) {
+        QPostEventNode *next = first->next;
+        QObject *receiver = first->pe.receiver;
+        QThreadData *data = receiver->d_func()->threadData;
+        if (Q_LIKELY(data == this)) {
+            postEventList.addEvent(first->pe);
+            ++receiver->d_func()->postedEvents;
+            canWait = false;
+            delete first;
+        } else if (data) {
+            // the receiver was moved to another thread while the event was
+            // being posted, pass it on without taking the other mutex
+            data->postEventList.enqueueEvent(first);
+            if (data->eventDispatcher)
+                data->eventDispatcher->wakeUp();
+        } else {
+            first->pe.event->posted = false;
+            delete first->pe.event;
+            delete first;
+        }
+        first = next;
+    }
+}
+
 /*
   QAdoptedThread
 */
@@ -60,6 +60,15 @@ public:
         : receiver(r), event(e), priority(p)
     { }
 };
+class QPostEventNode
+{
+public:
+    QPostEvent pe;
+    QPostEventNode *next;
+    inline QPostEventNode(const QPostEvent &ev)
+        : pe(ev), next(nullptr)
+    { }
+};
 inline bool operator<(int priority, const QPostEvent &pe)
 {
     return pe.priority < priority;
@@ -84,10 +93,26 @@ public:
 
     QMutex mutex;
 
+    // events of normal priority posted without locking the mutex, the most
+    // recent first, QThreadData::flushPostEventQueue() moves them to the list
+    QAtomicPointer<QPostEventNode> queue;
+
     inline QPostEventList()
         : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0)
     { }
 
+    inline bool hasQueuedEvents() const {
+        return (queue.load() != nullptr);
+    }
+
+    inline void enqueueEvent(QPostEventNode *node) {
+        QPostEventNode *head;
+        do {
+            head = queue.load();
+            node->next = head;
+        } while (!queue.testAndSetOrdered(head, node));
+    }
+
     void addEvent(const QPostEvent &ev) {
         int priority = ev.priority;
         if (isEmpty() || last().priority >= priority) {
@@ -175,9 +200,11 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return (canWait && !postEventList.hasQueuedEvents());
     }
 
+    void flushPostEventQueue();
+
     bool quitNow;
     bool canWait;
     bool isAdopted;
@@ -0,0 +1,627 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qthreadpool.h"
+#include "qthreadpool_p.h"
+#include "qelapsedtimer.h"
+#include "qcoreapplication.h"
+#include "qcoreevent.h"
+
+#include <limits.h>
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+Q_GLOBAL_STATIC(QThreadPool, theInstance)
+
+// the pool thread running on the current thread, if any
+static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
+inline bool operator<(int priority, const QPair<QRunnable *, int> &p)
+{
+    return p.second < priority;
+}
+
+inline bool operator<(const QPair<QRunnable *, int> &p, int priority)
+{
+    return priority < p.second;
+}
+
+/*
+    QThreadPoolThread
+*/
+QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
+    : manager(manager)
+{
+}
+
+void QThreadPoolThread::run()
+{
+    currentPoolThread = this;
+
+    for (;;) {
+        QRunnable *runnable = manager->takeRunnable(this);
+        if (runnable) {
+            const bool autoDelete = runnable->autoDelete();
+            runnable->run();
+            if (autoDelete && !runnable->ref.deref()) {
+                delete runnable;
+            }
+
+            // QObjects created by the runnable live in this thread which has
+            // no event loop, deliver what was posted to them, deleteLater()
+            // included, before the next runnable
+            QCoreApplication::sendPostedEvents(nullptr, 0);
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+            manager->runnableDone();
+            continue;
+        }
+
+        QMutexLocker locker(&manager->mutex);
+        if (manager->isExiting) {
+            break;
+        }
+
+        if (manager->tooManyThreadsActive()) {
+            manager->allThreads.removeOne(this);
+            manager->expiredThreads.append(this);
+            manager->updateSpareThreads();
+            break;
+        }
+
+        // announce that this thread is waiting before the last look at the
+        // queued runnables, threads pushing to their deque check the spare
+        // threads after they have counted the runnable
+        manager->waitingThreads.append(this);
+        manager->updateSpareThreads();
+        if (manager->queuedRunnables.load() > 0) {
+            manager->waitingThreads.removeOne(this);
+            manager->updateSpareThreads();
+            continue;
+        }
+
+        const int expiryTimeout = manager->expiryTimeout;
+        const bool woken = runnableReady.wait(locker.mutex(), expiryTimeout < 0 ? ULONG_MAX : expiryTimeout);
+        if (manager->isExiting) {
+            break;
+        }
+        if (manager->waitingThreads.removeOne(this)) {
+            // not woken up by the pool
+            manager->updateSpareThreads();
+            if (!woken && manager->queuedRunnables.load() == 0) {
+                manager->allThreads.removeOne(this);
+                manager->expiredThreads.append(this);
+                manager->updateSpareThreads();
+                break;
+            }
+        }
+    }
+
+    currentPoolThread = nullptr;
+}
+
+void QThreadPoolThread::push(QRunnable *runnable)
+{
+    QMutexLocker locker(&dequemutex);
+    deque.append(runnable);
+    manager->queuedRunnables.ref();
+}
+
+QRunnable *QThreadPoolThread::pop()
+{
+    QMutexLocker locker(&dequemutex);
+    if (deque.isEmpty()) {
+        return nullptr;
+    }
+    manager->queuedRunnables.deref();
+    return deque.takeLast();
+}
+
+QRunnable *QThreadPoolThread::steal()
+{
+    QMutexLocker locker(&dequemutex);
+    if (deque.isEmpty()) {
+        return nullptr;
+    }
+    manager->queuedRunnables.deref();
+    return deque.takeFirst();
+}
+
+/*
+    QThreadPoolPrivate
+*/
+QThreadPoolPrivate::QThreadPoolPrivate()
+    : queuedRunnables(0),
+    pendingRunnables(0),
+    spareThreads(0),
+    expiryTimeout(30000),
+    maxThreadCount(qMax(QThread::idealThreadCount(), 1)),
+    reservedThreads(0),
+    isExiting(false)
+{
+    spareThreads.store(maxThreadCount);
+}
+
+// must be called with the mutex locked
+void QThreadPoolPrivate::enqueue(QRunnable *runnable, int priority)
+{
+    QList<QPair<QRunnable *, int> >::iterator at = qUpperBound(queue.begin(), queue.end(), priority);
+    queue.insert(at, qMakePair(runnable, priority));
+    queuedRunnables.ref();
+}
+
+// must be called with the mutex locked
+void QThreadPoolPrivate::wakeOrStartThread()
+{
+    if (!waitingThreads.isEmpty()) {
+        waitingThreads.takeFirst()->runnableReady.wakeOne();
+        updateSpareThreads();
+        return;
+    }
+
+    if (!canStartThread()) {
+        return;
+    }
+
+    QThreadPoolThread *thread = nullptr;
+    if (!expiredThreads.isEmpty()) {
+        // the thread has left its loop already, reuse it
+        thread = expiredThreads.takeFirst();
+        thread->wait();
+    } else {
+        thread = new QThreadPoolThread(this);
+    }
+    allThreads.append(thread);
+    updateSpareThreads();
+    thread->start();
+}
+
+bool QThreadPoolPrivate::canStartThread() const
+{
+    // there is always at least one thread, even if all are reserved
+    return (allThreads.size() + reservedThreads < maxThreadCount || allThreads.isEmpty());
+}
+
+bool QThreadPoolPrivate::tooManyThreadsActive() const
+{
+    return (allThreads.size() + reservedThreads > maxThreadCount && allThreads.size() > 1);
+}
+
+void QThreadPoolPrivate::updateSpareThreads()
+{
+    const int startable = qMax(maxThreadCount - reservedThreads - allThreads.size(), 0);
+    spareThreads.store(waitingThreads.size() + startable);
+}
+
+QRunnable *QThreadPoolPrivate::takeRunnable(QThreadPoolThread *thread)
+{
+    // the most recently pushed runnable of the thread itself is the one most
+    // likely to have its data still in the cache
+    QRunnable *runnable = thread->pop();
+    if (runnable || queuedRunnables.load() == 0) {
+        return runnable;
+    }
+
+    QMutexLocker locker(&mutex);
+    if (!queue.isEmpty()) {
+        queuedRunnables.deref();
+        return queue.takeFirst().first;
+    }
+
+    // steal the oldest runnable of another thread, starting with the next
+    // one so that idle threads do not all go for the same deque
+    const int count = allThreads.size();
+    const int index = allThreads.indexOf(thread);
+    for (int i = 1; i <= count; i++) {
+        QThreadPoolThread *victim = allThreads.at((index + i) % count);
+        if (victim == thread) {
+            continue;
+        }
+        runnable = victim->steal();
+        if (runnable) {
+            return runnable;
+        }
+    }
+    return nullptr;
+}
+
+void QThreadPoolPrivate::runnableDone()
+{
+    if (!pendingRunnables.deref()) {
+        QMutexLocker locker(&mutex);
+        noActiveThreads.wakeAll();
+    }
+}
+
+// drops a runnable that was queued but not run
+void QThreadPoolPrivate::discard(QRunnable *runnable)
+{
+    if (runnable->autoDelete() && !runnable->ref.deref()) {
+        delete runnable;
+    }
+    queuedRunnables.deref();
+    pendingRunnables.deref();
+}
+
+void QThreadPoolPrivate::reset()
+{
+    QMutexLocker locker(&mutex);
+    isExiting = true;
+    foreach (QThreadPoolThread *thread, waitingThreads) {
+        thread->runnableReady.wakeOne();
+    }
+    waitingThreads.clear();
+
+    const QList<QThreadPoolThread *> threads = allThreads + expiredThreads;
+    allThreads.clear();
+    expiredThreads.clear();
+    locker.unlock();
+
+    foreach (QThreadPoolThread *thread, threads) {
+        thread->wait();
+        delete thread;
+    }
+
+    locker.relock();
+    isExiting = false;
+    updateSpareThreads();
+}
+
+/*!
+    \class QThreadPool
+    \brief The QThreadPool class manages a collection of QThreads.
+    \threadsafe
+
+    \ingroup thread
+
+    QThreadPool manages and recyles individual QThread objects to help reduce
+    thread creation costs in programs that use threads. Each Katie application
+    has one global QThreadPool object, which can be accessed by calling
+    globalInstance().
+
+    To use one of the QThreadPool threads, subclass QRunnable and implement
+    the run() virtual function. Then create an object of that class and pass
+    it to QThreadPool::start().
+
+    QThreadPool deletes the QRunnable automatically by default. Use
+    QRunnable::setAutoDelete() to change the auto-deletion flag.
+
+    Runnables started from outside the pool are kept in a queue sorted by
+    priority. Each thread of the pool also has a deque of its own, runnables
+    started with the default priority from a runnable that is already
+    running in the pool are pushed onto the deque of that thread. A thread
+    runs the most recently pushed runnable of its own deque first, then the
+    queued ones and when there is nothing else to do it steals the oldest
+    runnable from the deque of another thread. Fanning out work from within
+    the pool thus does not contend on a single queue.
+
+    Threads that are unused for a certain amount of time will expire. The
+    default expiry timeout is 30000 milliseconds (30 seconds). This can be
+    changed using setExpiryTimeout(). Setting a negative expiry timeout
+    disables the expiry mechanism.
+
+    Call maxThreadCount() to query the maximum number of threads to be used.
+    If needed, you can change the limit with setMaxThreadCount(). The default
+    maxThreadCount() is QThread::idealThreadCount(). The activeThreadCount()
+    function returns the number of threads currently doing work.
+
+    The reserveThread() function reserves a thread for external use. Use
+    releaseThread() when your are done with the thread, so that it may be
+    reused. Essentially, these functions temporarily increase or reduce the
+    active thread count and are useful when implementing time-consuming
+    operations that are not visible to the QThreadPool.
+
+    QObjects created by a runnable live in the pool thread that runs it.
+    The thread has no event loop, the events posted to them, including
+    deleteLater(), are delivered after the runnable returns.
+
+    Note that QThreadPool is a low-level class for managing threads.
+
+    \sa QRunnable
+*/
+
+/*!
+    Constructs a thread pool with the given \a parent.
+*/
+QThreadPool::QThreadPool(QObject *parent)
+    : QObject(*new QThreadPoolPrivate, parent)
+{
+}
+
+/*!
+    Destroys the QThreadPool.
+    This function will block until all runnables have been completed.
+*/
+QThreadPool::~QThreadPool()
+{
+    Q_D(QThreadPool);
+    waitForDone();
+    d->reset();
+}
+
+/*!
+    Returns the global QThreadPool instance.
+*/
+QThreadPool *QThreadPool::globalInstance()
+{
+    return theInstance();
+}
+
+/*!
+    Reserves a thread and uses it to run \a runnable, unless this thread will
+    make the current thread count exceed maxThreadCount(). In that case,
+    \a runnable is added to a run queue instead. The \a priority argument can
+    be used to control the run queue's order of execution.
+
+    Note that the thread pool takes ownership of the \a runnable if
+    \l{QRunnable::autoDelete()}{runnable->autoDelete()} returns true,
+    and the \a runnable will be deleted automatically by the thread
+    pool after the \l{QRunnable::run()}{runnable->run()} returns. If
+    \l{QRunnable::autoDelete()}{runnable->autoDelete()} returns false,
+    ownership of \a runnable remains with the caller. Note that
+    changing the auto-deletion on \a runnable after calling this
+    functions results in undefined behavior.
+*/
+void QThreadPool::start(QRunnable *runnable, int priority)
+{
+    if (Q_UNLIKELY(!runnable)) {
+        return;
+    }
+
+    Q_D(QThreadPool);
+    if (runnable->autoDelete()) {
+        runnable->ref.ref();
+    }
+    d->pendingRunnables.ref();
+
+    QThreadPoolThread *thread = currentPoolThread;
+    if (priority == 0 && thread && thread->manager == d) {
+        thread->push(runnable);
+        if (d->spareThreads.load() > 0) {
+            QMutexLocker locker(&d->mutex);
+            d->wakeOrStartThread();
+        }
+        return;
+    }
+
+    QMutexLocker locker(&d->mutex);
+    d->enqueue(runnable, priority);
+    d->wakeOrStartThread();
+}
+
+/*!
+    Attempts to reserve a thread to run \a runnable.
+
+    If no threads are available at the time of calling, then this function
+    does nothing and returns false. Otherwise, \a runnable is run immediately
+    using one available thread and this function returns true.
+
+    Note that the thread pool takes ownership of the \a runnable if
+    \l{QRunnable::autoDelete()}{runnable->autoDelete()} returns true,
+    and the \a runnable will be deleted automatically by the thread
+    pool after the \l{QRunnable::run()}{runnable->run()} returns. If
+    \l{QRunnable::autoDelete()}{runnable->autoDelete()} returns false,
+    ownership of \a runnable remains with the caller. Note that
+    changing the auto-deletion on \a runnable after calling this
+    function results in undefined behavior.
+*/
+bool QThreadPool::tryStart(QRunnable *runnable)
+{
+    if (Q_UNLIKELY(!runnable)) {
+        return false;
+    }
+
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (d->waitingThreads.isEmpty() && !d->canStartThread()) {
+        return false;
+    }
+
+    if (runnable->autoDelete()) {
+        runnable->ref.ref();
+    }
+    d->pendingRunnables.ref();
+    d->enqueue(runnable, INT_MAX);
+    d->wakeOrStartThread();
+    return true;
+}
+
+/*! \property QThreadPool::expiryTimeout
+
+    Threads that are unused for \a expiryTimeout milliseconds are considered
+    to have expired and will exit. Such threads will be restarted as needed.
+    The default \a expiryTimeout is 30000 milliseconds (30 seconds). If
+    \a expiryTimeout is negative, newly created threads will not expire, e.g.,
+    they will not exit until the thread pool is destroyed.
+
+    The new \a expiryTimeout applies to threads that start waiting for
+    work after it has been set.
+*/
+int QThreadPool::expiryTimeout() const
+{
+    Q_D(const QThreadPool);
+    return d->expiryTimeout;
+}
+
+void QThreadPool::setExpiryTimeout(int expiryTimeout)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    d->expiryTimeout = expiryTimeout;
+}
+
+/*! \property QThreadPool::maxThreadCount
+
+    This property represents the maximum number of threads used by the thread
+    pool.
+
+    \note The thread pool will always use at least 1 thread, even if
+    \a maxThreadCount limit is zero or negative.
+
+    The default \a maxThreadCount is QThread::idealThreadCount().
+*/
+int QThreadPool::maxThreadCount() const
+{
+    Q_D(const QThreadPool);
+    return d->maxThreadCount;
+}
+
+void QThreadPool::setMaxThreadCount(int maxThreadCount)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (maxThreadCount == d->maxThreadCount) {
+        return;
+    }
+
+    d->maxThreadCount = maxThreadCount;
+    d->updateSpareThreads();
+    // start threads for runnables that did not have one
+    int queued = d->queuedRunnables.load();
+    while (queued-- > 0 && d->canStartThread() && d->waitingThreads.isEmpty()) {
+        d->wakeOrStartThread();
+    }
+}
+
+/*! \property QThreadPool::activeThreadCount
+
+    This property represents the number of active threads in the thread pool.
+
+    \note It is possible for this function to return a value that is greater
+    than maxThreadCount(). See reserveThread() for more details.
+
+    \sa reserveThread(), releaseThread()
+*/
+int QThreadPool::activeThreadCount() const
+{
+    Q_D(const QThreadPool);
+    QMutexLocker locker(const_cast<QMutex *>(&d->mutex));
+    return (d->allThreads.size() - d->waitingThreads.size() + d->reservedThreads);
+}
+
+/*!
+    Reserves one thread, disregarding activeThreadCount() and maxThreadCount().
+
+    Once you are done with the thread, call releaseThread() to allow it to be
+    reused.
+
+    \note This function will always increase the number of active threads.
+    This means that by using this function, it is possible for
+    activeThreadCount() to return a value greater than maxThreadCount() .
+
+    \sa releaseThread()
+ */
+void QThreadPool::reserveThread()
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    ++d->reservedThreads;
+    d->updateSpareThreads();
+}
+
+/*!
+    Releases a thread previously reserved by a call to reserveThread().
+
+    \note Calling this function without previously reserving a thread
+    temporarily increases maxThreadCount(). This is useful when a
+    thread goes to sleep waiting for more work, allowing other threads
+    to continue. Be sure to call reserveThread() when done waiting, so
+    that the thread pool can correctly maintain the
+    activeThreadCount().
+
+    \sa reserveThread()
+*/
+void QThreadPool::releaseThread()
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    --d->reservedThreads;
+    d->updateSpareThreads();
+    if (d->queuedRunnables.load() > 0) {
+        d->wakeOrStartThread();
+    }
+}
+
+/*!
+    Waits up to \a msecs milliseconds for all started runnables, the queued
+    ones included, to finish. Returns true if they did; otherwise it returns
+    false. If \a msecs is -1 (the default), the timeout is ignored (waits for
+    the last runnable to finish).
+
+    The threads of the pool are kept, they expire as usual.
+*/
+bool QThreadPool::waitForDone(int msecs)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (msecs < 0) {
+        while (d->pendingRunnables.load() > 0) {
+            d->noActiveThreads.wait(locker.mutex());
+        }
+    } else {
+        QElapsedTimer timer;
+        timer.start();
+        qint64 remaining = msecs;
+        while (d->pendingRunnables.load() > 0 && remaining > 0) {
+            d->noActiveThreads.wait(locker.mutex(), remaining);
+            remaining = msecs - timer.elapsed();
+        }
+    }
+    return (d->pendingRunnables.load() == 0);
+}
+
+/*!
+    Removes the runnables that are not yet started from the queue.
+    The runnables for which \l{QRunnable::autoDelete()}{runnable->autoDelete()}
+    returns true are deleted.
+
+    \sa start()
+*/
+void QThreadPool::clear()
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    for (int i = 0; i < d->queue.size(); i++) {
+        d->discard(d->queue.at(i).first);
+    }
+    d->queue.clear();
+
+    foreach (QThreadPoolThread *thread, d->allThreads) {
+        QMutexLocker dequelocker(&thread->dequemutex);
+        foreach (QRunnable *runnable, thread->deque) {
+            d->discard(runnable);
+        }
+        thread->deque.clear();
+    }
+
+    if (d->pendingRunnables.load() == 0) {
+        d->noActiveThreads.wakeAll();
+    }
+}
+
+#include "moc_qthreadpool.h"
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
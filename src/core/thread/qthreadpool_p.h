@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QTHREADPOOL_P_H
+#define QTHREADPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Katie API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "QtCore/qthreadpool.h"
+#include "QtCore/qthread.h"
+#include "QtCore/qmutex.h"
+#include "QtCore/qwaitcondition.h"
+#include "QtCore/qpair.h"
+#include "qobject_p.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPoolPrivate;
+
+class QThreadPoolThread : public QThread
+{
+public:
+    QThreadPoolThread(QThreadPoolPrivate *manager);
+
+    void run();
+
+    // the owning thread pushes and pops at the back of its deque, other
+    // threads of the pool steal from the front
+    void push(QRunnable *runnable);
+    QRunnable *pop();
+    QRunnable *steal();
+
+    QThreadPoolPrivate *manager;
+    QWaitCondition runnableReady;
+    QMutex dequemutex;
+    QList<QRunnable *> deque;
+};
+
+class QThreadPoolPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QThreadPool)
+
+public:
+    QThreadPoolPrivate();
+
+    void enqueue(QRunnable *runnable, int priority);
+    void wakeOrStartThread();
+    bool canStartThread() const;
+    bool tooManyThreadsActive() const;
+    void updateSpareThreads();
+    QRunnable *takeRunnable(QThreadPoolThread *thread);
+    void runnableDone();
+    void discard(QRunnable *runnable);
+    void reset();
+
+    QMutex mutex;
+    QWaitCondition noActiveThreads;
+    // runnables started from outside the pool, sorted by priority
+    QList<QPair<QRunnable *, int> > queue;
+    QList<QThreadPoolThread *> allThreads;
+    QList<QThreadPoolThread *> waitingThreads;
+    QList<QThreadPoolThread *> expiredThreads;
+
+    // runnables in the queue and in the deques of all threads
+    QAtomicInt queuedRunnables;
+    // queued runnables plus the ones being run
+    QAtomicInt pendingRunnables;
+    // waiting threads plus the ones that may still be started, lets
+    // threads of the pool push to their deque without locking the mutex
+    QAtomicInt spareThreads;
+
+    int expiryTimeout;
+    int maxThreadCount;
+    int reservedThreads;
+    bool isExiting;
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
+
+#endif // QTHREADPOOL_P_H
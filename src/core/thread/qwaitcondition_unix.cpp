@@ -22,6 +22,7 @@
 #include "qwaitcondition.h"
 #include "qmutex.h"
 
+#include <mutex>
 #include <condition_variable>
 #include <chrono>
 
@@ -0,0 +1,521 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QFLATHASH_P_H
+#define QFLATHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Katie API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qdatastream.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QFlatHash is an open-addressing hash table with a QHash compatible API
+    subset. Keys and values are stored inline in one contiguous array next
+    to an array of control bytes, so inserting does not allocate a node per
+    element and looking up does not chase bucket chains.
+
+    Each control byte is either empty, deleted or holds the low 7 bits of
+    the key's hash, which rejects nearly all mismatching slots without
+    touching the key. Probing is linear and the table is grown to keep at
+    most 7/8 of it in use. Erasing leaves a tombstone, so erase() does not
+    move other elements and iterators to them stay valid; inserting may
+    rehash and invalidates all iterators, unlike QHash.
+
+    Iteration order is unspecified and there is no insertMulti().
+*/
+template <class Key, class T>
+class QFlatHash
+{
+    struct Node {
+        Key key;
+        T value;
+    };
+
+    enum Control {
+        Empty = 0x80,
+        Deleted = 0xFE
+    };
+
+    Node *nodes;
+    quint8 *ctrl;
+    int capacity;
+    int used;
+    int deleted;
+
+    static inline uint mixed(const Key &key) {
+        uint h = qHash(key);
+        h ^= h >> 16;
+        h *= 0x45d9f3bU;
+        h ^= h >> 16;
+        return h;
+    }
+    static inline bool isFull(quint8 c) { return (c & 0x80) == 0; }
+
+    int findIndex(const Key &key) const;
+    int insertIndex(const Key &key, bool *found);
+    void rehash(int newCapacity);
+    void eraseAt(int i);
+    void freeData();
+
+public:
+    inline QFlatHash() : nodes(0), ctrl(0), capacity(0), used(0), deleted(0) { }
+    QFlatHash(const QFlatHash &other);
+    inline QFlatHash(QFlatHash &&other)
+        : nodes(other.nodes), ctrl(other.ctrl), capacity(other.capacity),
+        used(other.used), deleted(other.deleted)
+    { other.nodes = 0; other.ctrl = 0; other.capacity = other.used = other.deleted = 0; }
+    inline ~QFlatHash() { freeData(); }
+
+    QFlatHash &operator=(const QFlatHash &other);
+    inline QFlatHash &operator=(QFlatHash &&other) { swap(other); return *this; }
+    inline void swap(QFlatHash &other) {
+        qSwap(nodes, other.nodes);
+        qSwap(ctrl, other.ctrl);
+        qSwap(capacity, other.capacity);
+        qSwap(used, other.used);
+        qSwap(deleted, other.deleted);
+    }
+
+    bool operator==(const QFlatHash &other) const;
+    inline bool operator!=(const QFlatHash &other) const { return !(*this == other); }
+
+    inline int size() const { return used; }
+    inline int count() const { return used; }
+    inline bool isEmpty() const { return used == 0; }
+    void reserve(int size);
+    inline void clear() { freeData(); }
+
+    inline bool contains(const Key &key) const { return findIndex(key) >= 0; }
+    const T value(const Key &key) const;
+    const T value(const Key &key, const T &defaultValue) const;
+    T &operator[](const Key &key);
+    const T operator[](const Key &key) const { return value(key); }
+
+    QList<Key> keys() const;
+    QList<T> values() const;
+
+    class const_iterator;
+
+    class iterator
+    {
+        friend class const_iterator;
+        friend class QFlatHash;
+        QFlatHash *h;
+        int i;
+
+        inline iterator(QFlatHash *hash, int index) : h(hash), i(index) { }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        inline iterator() : h(0), i(0) { }
+
+        inline const Key &key() const { return h->nodes[i].key; }
+        inline T &value() const { return h->nodes[i].value; }
+        inline T &operator*() const { return h->nodes[i].value; }
+        inline T *operator->() const { return &h->nodes[i].value; }
+        inline bool operator==(const iterator &o) const { return i == o.i; }
+        inline bool operator!=(const iterator &o) const { return i != o.i; }
+
+        inline iterator &operator++() {
+            while (++i < h->capacity && !isFull(h->ctrl[i])) { }
+            return *this;
+        }
+        inline iterator operator++(int) { iterator r = *this; ++(*this); return r; }
+    };
+    friend class iterator;
+
+    class const_iterator
+    {
+        friend class QFlatHash;
+        const QFlatHash *h;
+        int i;
+
+        inline const_iterator(const QFlatHash *hash, int index) : h(hash), i(index) { }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        inline const_iterator() : h(0), i(0) { }
+        inline const_iterator(const iterator &o) : h(o.h), i(o.i) { }
+
+        inline const Key &key() const { return h->nodes[i].key; }
+        inline const T &value() const { return h->nodes[i].value; }
+        inline const T &operator*() const { return h->nodes[i].value; }
+        inline const T *operator->() const { return &h->nodes[i].value; }
+        inline bool operator==(const const_iterator &o) const { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const { return i != o.i; }
+
+        inline const_iterator &operator++() {
+            while (++i < h->capacity && !isFull(h->ctrl[i])) { }
+            return *this;
+        }
+        inline const_iterator operator++(int) { const_iterator r = *this; ++(*this); return r; }
+    };
+    friend class const_iterator;
+
+    typedef iterator Iterator;
+    typedef const_iterator ConstIterator;
+    typedef Key key_type;
+    typedef T mapped_type;
+    typedef int size_type;
+
+    inline iterator begin() { return ++iterator(this, -1); }
+    inline const_iterator begin() const { return ++const_iterator(this, -1); }
+    inline const_iterator constBegin() const { return ++const_iterator(this, -1); }
+    inline iterator end() { return iterator(this, capacity); }
+    inline const_iterator end() const { return const_iterator(this, capacity); }
+    inline const_iterator constEnd() const { return const_iterator(this, capacity); }
+
+    inline iterator find(const Key &key) {
+        const int i = findIndex(key);
+        return iterator(this, i < 0 ? capacity : i);
+    }
+    inline const_iterator find(const Key &key) const { return constFind(key); }
+    inline const_iterator constFind(const Key &key) const {
+        const int i = findIndex(key);
+        return const_iterator(this, i < 0 ? capacity : i);
+    }
+
+    iterator insert(const Key &key, const T &value);
+    iterator erase(iterator it);
+    int remove(const Key &key);
+    T take(const Key &key);
+};
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QFlatHash<Key, T>::QFlatHash(const QFlatHash &other)
+    : nodes(0), ctrl(0), capacity(0), used(0), deleted(0)
+{
+    if (other.used == 0)
+        return;
+    reserve(other.used);
+    for (const_iterator it = other.constBegin(); it != other.constEnd(); ++it)
+        insert(it.key(), it.value());
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QFlatHash<Key, T> &QFlatHash<Key, T>::operator=(const QFlatHash &other)
+{
+    if (this != &other) {
+        QFlatHash copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::freeData()
+{
+    if (QTypeInfo<Key>::isComplex || QTypeInfo<T>::isComplex) {
+        for (int i = 0; i < capacity; ++i) {
+            if (isFull(ctrl[i]))
+                nodes[i].~Node();
+        }
+    }
+    ::free(nodes);
+    nodes = 0;
+    ctrl = 0;
+    capacity = used = deleted = 0;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE int QFlatHash<Key, T>::findIndex(const Key &key) const
+{
+    if (used == 0)
+        return -1;
+    const uint h = mixed(key);
+    const quint8 h2 = h & 0x7F;
+    const int mask = capacity - 1;
+    for (int i = (h >> 7) & mask; ; i = (i + 1) & mask) {
+        const quint8 c = ctrl[i];
+        if (c == h2 && nodes[i].key == key)
+            return i;
+        if (c == Empty)
+            return -1;
+    }
+}
+
+// returns the slot holding key, or a free slot claimed for it when *found is false
+template <class Key, class T>
+Q_INLINE_TEMPLATE int QFlatHash<Key, T>::insertIndex(const Key &key, bool *found)
+{
+    if (capacity == 0)
+        rehash(16);
+
+    const uint h = mixed(key);
+    const quint8 h2 = h & 0x7F;
+    int mask = capacity - 1;
+    int slot = -1;
+    for (int i = (h >> 7) & mask; ; i = (i + 1) & mask) {
+        const quint8 c = ctrl[i];
+        if (c == h2 && nodes[i].key == key) {
+            *found = true;
+            return i;
+        }
+        if (c == Deleted && slot < 0) {
+            slot = i;
+        } else if (c == Empty) {
+            if (slot < 0)
+                slot = i;
+            break;
+        }
+    }
+
+    *found = false;
+    if (ctrl[slot] == Deleted) {
+        --deleted;
+    } else if ((used + deleted + 1) * 8 > capacity * 7) {
+        // keep at least one empty slot so that probing terminates
+        int newCapacity = 16;
+        while ((used + 1) * 16 > newCapacity * 7)
+            newCapacity *= 2;
+        rehash(newCapacity);
+        mask = capacity - 1;
+        for (slot = (h >> 7) & mask; ctrl[slot] != Empty; slot = (slot + 1) & mask) { }
+    }
+    ctrl[slot] = h2;
+    ++used;
+    return slot;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::rehash(int newCapacity)
+{
+    Node *oldNodes = nodes;
+    quint8 *oldCtrl = ctrl;
+    const int oldCapacity = capacity;
+
+    nodes = static_cast<Node *>(::malloc(newCapacity * (sizeof(Node) + 1)));
+    Q_CHECK_PTR(nodes);
+    ctrl = reinterpret_cast<quint8 *>(nodes + newCapacity);
+    ::memset(ctrl, Empty, newCapacity);
+    capacity = newCapacity;
+    deleted = 0;
+
+    const int mask = capacity - 1;
+    for (int i = 0; i < oldCapacity; ++i) {
+        if (!isFull(oldCtrl[i]))
+            continue;
+        const uint h = mixed(oldNodes[i].key);
+        int slot = (h >> 7) & mask;
+        while (ctrl[slot] != Empty)
+            slot = (slot + 1) & mask;
+        ctrl[slot] = h & 0x7F;
+        if (QTypeInfo<Key>::isStatic || QTypeInfo<T>::isStatic) {
+            new (nodes + slot) Node(std::move(oldNodes[i]));
+            oldNodes[i].~Node();
+        } else {
+            ::memcpy(static_cast<void *>(nodes + slot), oldNodes + i, sizeof(Node));
+        }
+    }
+    ::free(oldNodes);
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::reserve(int asize)
+{
+    int newCapacity = 16;
+    while (qint64(asize) * 8 > qint64(newCapacity) * 7)
+        newCapacity *= 2;
+    if (newCapacity > capacity)
+        rehash(newCapacity);
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE void QFlatHash<Key, T>::eraseAt(int i)
+{
+    nodes[i].~Node();
+    // no probe sequence runs through a slot followed by an empty one
+    if (ctrl[(i + 1) & (capacity - 1)] == Empty) {
+        ctrl[i] = Empty;
+    } else {
+        ctrl[i] = Deleted;
+        ++deleted;
+    }
+    --used;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE const T QFlatHash<Key, T>::value(const Key &key) const
+{
+    const int i = findIndex(key);
+    return i < 0 ? T() : nodes[i].value;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE const T QFlatHash<Key, T>::value(const Key &key, const T &defaultValue) const
+{
+    const int i = findIndex(key);
+    return i < 0 ? defaultValue : nodes[i].value;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE T &QFlatHash<Key, T>::operator[](const Key &key)
+{
+    bool found;
+    const int i = insertIndex(key, &found);
+    if (!found)
+        new (nodes + i) Node{key, T()};
+    return nodes[i].value;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE typename QFlatHash<Key, T>::iterator QFlatHash<Key, T>::insert(const Key &key, const T &value)
+{
+    bool found;
+    const int i = insertIndex(key, &found);
+    if (found)
+        nodes[i].value = value;
+    else
+        new (nodes + i) Node{key, value};
+    return iterator(this, i);
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE typename QFlatHash<Key, T>::iterator QFlatHash<Key, T>::erase(iterator it)
+{
+    if (it.i >= capacity)
+        return it;
+    eraseAt(it.i);
+    return ++it;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE int QFlatHash<Key, T>::remove(const Key &key)
+{
+    const int i = findIndex(key);
+    if (i < 0)
+        return 0;
+    eraseAt(i);
+    return 1;
+}
+
+template <class Key, class T>
+Q_INLINE_TEMPLATE T QFlatHash<Key, T>::take(const Key &key)
+{
+    const int i = findIndex(key);
+    if (i < 0)
+        return T();
+    T t = std::move(nodes[i].value);
+    eraseAt(i);
+    return t;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QList<Key> QFlatHash<Key, T>::keys() const
+{
+    QList<Key> res;
+    res.reserve(used);
+    for (const_iterator it = constBegin(); it != constEnd(); ++it)
+        res.append(it.key());
+    return res;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QList<T> QFlatHash<Key, T>::values() const
+{
+    QList<T> res;
+    res.reserve(used);
+    for (const_iterator it = constBegin(); it != constEnd(); ++it)
+        res.append(it.value());
+    return res;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE bool QFlatHash<Key, T>::operator==(const QFlatHash &other) const
+{
+    if (used != other.used)
+        return false;
+    for (const_iterator it = constBegin(); it != constEnd(); ++it) {
+        const int i = other.findIndex(it.key());
+        if (i < 0 || !(other.nodes[i].value == it.value()))
+            return false;
+    }
+    return true;
+}
+
+#ifndef QT_NO_DATASTREAM
+// same format as QHash so that streamed state stays compatible
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QDataStream &operator<<(QDataStream &out, const QFlatHash<Key, T> &hash)
+{
+    out << quint32(hash.size());
+    for (typename QFlatHash<Key, T>::const_iterator it = hash.constBegin(); it != hash.constEnd(); ++it)
+        out << it.key() << it.value();
+    return out;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QDataStream &operator>>(QDataStream &in, QFlatHash<Key, T> &hash)
+{
+    QDataStream::DataStatus oldStatus = in.status();
+    in.resetStatus();
+    hash.clear();
+
+    quint32 n;
+    in >> n;
+    hash.reserve(n);
+
+    for (quint32 i = 0; i < n; ++i) {
+        if (in.status() != QDataStream::Ok)
+            break;
+
+        Key k;
+        T t;
+        in >> k >> t;
+        hash.insert(k, t);
+    }
+
+    if (in.status() != QDataStream::Ok)
+        hash.clear();
+    if (oldStatus != QDataStream::Ok)
+        in.setStatus(oldStatus);
+    return in;
+}
+#endif // QT_NO_DATASTREAM
+
+QT_END_NAMESPACE
+
+#endif // QFLATHASH_P_H
@@ -24,36 +24,53 @@
 #include "qstring.h"
 
 #include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "xxhash.h"
 
 QT_BEGIN_NAMESPACE
 
 /*
-    These functions are based on Peter J. Weinberger's hash function
-    (from the Dragon Book). The constant 24 in the original function
-    was replaced with 23 to produce fewer collisions on input such as
-    "a", "aa", "aaa", "aaaa", ...
-*/
-static inline uint hash(const QChar *p, int n)
+    Strings and byte arrays are hashed with XXH3 using a seed chosen at
+    random once per process, which keys collide and the order in which
+    a QHash iterates over them differ from run to run so that colliding
+    keys can not be crafted in advance. QT_HASH_SEED set to a number is
+    used as the seed instead, for when the same hashes are needed in
+    every run.
+*/
+static quint64 createHashSeed()
 {
-    uint h = 0;
-    while (n--) {
-        h = (h << 4) + (*p++).unicode();
-        h ^= (h & 0xf0000000) >> 23;
-        h &= 0x0fffffff;
+    bool ok = false;
+    const uint envseed = qgetenv("QT_HASH_SEED").toUInt(&ok);
+    if (ok)
+        return envseed;
+
+    quint64 seed = 0;
+    const int fd = ::open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+    if (fd != -1) {
+        ok = (::read(fd, &seed, sizeof(seed)) == sizeof(seed));
+        ::close(fd);
+        if (ok)
+            return seed;
     }
-    return h;
+    // the stack address differs between runs with address space randomization
+    return quint64(::time(nullptr)) ^ quint64(quintptr(&seed));
+}
+
+static inline uint hash(const void *data, const size_t len)
+{
+    static const quint64 seed = createHashSeed();
+    if (!len)
+        return 0;
+    const XXH64_hash_t h = XXH3_64bits_withSeed(data, len, seed);
+    return uint(h ^ (h >> 32));
 }
 
 uint qHash(const char *key, const uint len)
 {
-    uint h = 0;
-    uint n = len;
-    while (n--) {
-        h = (h << 4) + *key++;
-        h ^= (h & 0xf0000000) >> 23;
-        h &= 0x0fffffff;
-    }
-    return h;
+    return hash(key, len);
 }
 
 uint qHash(const QBitArray &bitArray)
@@ -63,12 +80,12 @@ uint qHash(const QBitArray &bitArray)
 
 uint qHash(const QString &key)
 {
-    return hash(key.unicode(), key.size());
+    return hash(key.unicode(), key.size() * sizeof(QChar));
 }
 
 uint qHash(const QStringRef &key)
 {
-    return hash(key.unicode(), key.size());
+    return hash(key.unicode(), key.size() * sizeof(QChar));
 }
 
 /*
@@ -439,6 +456,12 @@ void QHashData::checkSanity()
     \relates QHash
 
     Returns the hash value for the \a key.
+
+    The hash values of strings, string references and byte arrays
+    depend on a seed chosen at random when the process starts. Set the
+    \c QT_HASH_SEED environment variable to a number to use it as the
+    seed, for example in tests that depend on the order of the items
+    in a QHash.
 */
 
 /*! \fn uint qHash(const T *key)
@@ -594,6 +617,11 @@ void QHashData::checkSanity()
     XOR'ed this with the day they were born to help produce unique
     hashes for people with the same name.
 
+    The hash values of QString, QStringRef and QByteArray keys differ
+    between runs of the application since they are seeded at random,
+    unless the \c QT_HASH_SEED environment variable is set. Do not
+    store them or rely on the iteration order of a QHash.
+
     Internally, QHash uses a hash table to perform lookups. Unlike Qt
     3's \c QDict class, which needed to be initialized with a prime
     number, QHash's hash table automatically grows and shrinks to
@@ -33,6 +33,7 @@ public:
     QJsonDocumentPrivate() : ref(1) { }
 
     QVariant jsonToVariant(const QByteArray &jsondata);
+    QVariant jsonValueToVariant(json_t *jvalue);
     void variantToJson(const QVariant &jsonvariant, json_t *jroot, quint16 jdepth);
 
     QAtomicInt ref;
@@ -62,137 +63,9 @@ QVariant QJsonDocumentPrivate::jsonToVariant(const QByteArray &jsondata)
     }
 
     switch(json_typeof(jroot)) {
-        case JSON_OBJECT: {
-            QVariantMap mapresult;
-            const char *jkey;
-            json_t *jobject;
-            json_object_foreach(jroot, jkey, jobject) {
-                switch(json_typeof(jobject)) {
-                    case JSON_OBJECT: {
-                        char* jdata = json_dumps(jobject, 0);
-                        mapresult.insert(jkey, jsonToVariant(jdata));
-                        ::free(jdata);
-                        break;
-                    }
-                    case JSON_ARRAY: {
-                        QVariantList listvalue;
-                        for (size_t i = 0; i < json_array_size(jobject); i++) {
-                            json_t *jarray = json_array_get(jobject, i);
-                            switch(json_typeof(jarray)) {
-                                case JSON_OBJECT: {
-                                    char* jdata = json_dumps(jarray, 0);
-                                    listvalue.append(jsonToVariant(jdata));
-                                    ::free(jdata);
-                                    break;
-                                }
-                                case JSON_STRING: {
-                                    listvalue.append(QVariant(QString::fromUtf8(json_string_value(jarray), json_string_length(jarray))));
-                                    break;
-                                }
-                                case JSON_INTEGER: {
-                                    listvalue.append(QVariant(json_integer_value(jarray)));
-                                    break;
-                                }
-                                case JSON_REAL: {
-                                    listvalue.append(QVariant(json_real_value(jarray)));
-                                    break;
-                                }
-                                case JSON_TRUE: {
-                                    listvalue.append(QVariant(true));
-                                    break;
-                                }
-                                case JSON_FALSE: {
-                                    listvalue.append(QVariant(false));
-                                    break;
-                                }
-                                case JSON_NULL: {
-                                    listvalue.append(QVariant());
-                                    break;
-                                }
-                                default: {
-                                    error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type in array");
-                                    break;
-                                }
-                            }
-                        }
-                        mapresult.insert(jkey, listvalue);
-                        break;
-                    }
-                    case JSON_STRING: {
-                        mapresult.insert(jkey, QVariant(QString::fromUtf8(json_string_value(jobject), json_string_length(jobject))));
-                        break;
-                    }
-                    case JSON_INTEGER: {
-                        mapresult.insert(jkey, QVariant(json_integer_value(jobject)));
-                        break;
-                    }
-                    case JSON_REAL: {
-                        mapresult.insert(jkey, QVariant(json_real_value(jobject)));
-                        break;
-                    }
-                    case JSON_TRUE: {
-                        mapresult.insert(jkey, QVariant(true));
-                        break;
-                    }
-                    case JSON_FALSE: {
-                        mapresult.insert(jkey, QVariant(false));
-                        break;
-                    }
-                    case JSON_NULL: {
-                        mapresult.insert(jkey, QVariant());
-                        break;
-                    }
-                    default: {
-                        error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type");
-                        break;
-                    }
-                }
-            }
-            result = mapresult;
-            break;
-        }
+        case JSON_OBJECT:
         case JSON_ARRAY: {
-            QVariantList listvalue;
-            for (size_t i = 0; i < json_array_size(jroot); i++) {
-                json_t *jarray = json_array_get(jroot, i);
-                switch(json_typeof(jarray)) {
-                    case JSON_OBJECT: {
-                        char* jdata = json_dumps(jarray, 0);
-                        listvalue.append(jsonToVariant(jdata));
-                        ::free(jdata);
-                        break;
-                    }
-                    case JSON_STRING: {
-                        listvalue.append(QVariant(QString::fromUtf8(json_string_value(jarray), json_string_length(jarray))));
-                        break;
-                    }
-                    case JSON_INTEGER: {
-                        listvalue.append(QVariant(json_integer_value(jarray)));
-                        break;
-                    }
-                    case JSON_REAL: {
-                        listvalue.append(QVariant(json_real_value(jarray)));
-                        break;
-                    }
-                    case JSON_TRUE: {
-                        listvalue.append(QVariant(true));
-                        break;
-                    }
-                    case JSON_FALSE: {
-                        listvalue.append(QVariant(false));
-                        break;
-                    }
-                    case JSON_NULL: {
-                        listvalue.append(QVariant());
-                        break;
-                    }
-                    default: {
-                        error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type in array");
-                        break;
-                    }
-                }
-            }
-            result = listvalue;
+            result = jsonValueToVariant(jroot);
             break;
         }
         default: {
@@ -208,6 +81,52 @@ QVariant QJsonDocumentPrivate::jsonToVariant(const QByteArray &jsondata)
     return result;
 }
 
+// nested values are converted while walking the parsed tree, the depth is limited by the parser
+QVariant QJsonDocumentPrivate::jsonValueToVariant(json_t *jvalue)
+{
+    switch(json_typeof(jvalue)) {
+        case JSON_OBJECT: {
+            QVariantMap mapresult;
+            const char *jkey;
+            json_t *jobject;
+            json_object_foreach(jvalue, jkey, jobject) {
+                mapresult.insert(QString::fromUtf8(jkey), jsonValueToVariant(jobject));
+            }
+            return mapresult;
+        }
+        case JSON_ARRAY: {
+            QVariantList listresult;
+            const size_t jsize = json_array_size(jvalue);
+            listresult.reserve(jsize);
+            for (size_t i = 0; i < jsize; i++) {
+                listresult.append(jsonValueToVariant(json_array_get(jvalue, i)));
+            }
+            return listresult;
+        }
+        case JSON_STRING: {
+            return QVariant(QString::fromUtf8(json_string_value(jvalue), json_string_length(jvalue)));
+        }
+        case JSON_INTEGER: {
+            return QVariant(json_integer_value(jvalue));
+        }
+        case JSON_REAL: {
+            return QVariant(json_real_value(jvalue));
+        }
+        case JSON_TRUE: {
+            return QVariant(true);
+        }
+        case JSON_FALSE: {
+            return QVariant(false);
+        }
+        case JSON_NULL: {
+            return QVariant();
+        }
+    }
+
+    error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type");
+    return QVariant();
+}
+
 void QJsonDocumentPrivate::variantToJson(const QVariant &jsonvariant, json_t *jroot, quint16 jdepth)
 {
     if (jsonvariant.isNull()) {
@@ -0,0 +1,941 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qjsonstreamreader.h"
+#include "qiodevice.h"
+#include "qcoreapplication.h"
+#include "qstdcontainers_p.h"
+
+#include <jansson.h>
+
+QT_BEGIN_NAMESPACE
+
+static const qint64 QJSON_READ_CHUNK = 16384;
+
+static inline bool isJsonWhitespace(const char c)
+{
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+}
+
+static inline bool isJsonDigit(const char c)
+{
+    return (c >= '0' && c <= '9');
+}
+
+static inline int jsonHexValue(const char *data)
+{
+    int result = 0;
+    for (int i = 0; i < 4; i++) {
+        const char c = data[i];
+        result <<= 4;
+        if (c >= '0' && c <= '9') {
+            result |= (c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            result |= (c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            result |= (c - 'A' + 10);
+        } else {
+            return -1;
+        }
+    }
+    return result;
+}
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum Expect {
+        ExpectStart,
+        ExpectValue,
+        ExpectFirstName,
+        ExpectFirstValue,
+        ExpectColon,
+        ExpectSeparator,
+        ExpectNothing
+    };
+
+    enum Status {
+        Ok,
+        NeedMoreData,
+        Failed
+    };
+
+    QJsonStreamReaderPrivate();
+
+    void clear();
+    bool readMore();
+    Status parse(const bool eof);
+    void raiseError(QJsonStreamReader::Error error, const QString &message);
+
+    QIODevice *device;
+    QByteArray buffer;
+    int position;
+    QStdVector<char> stack;
+    Expect expect;
+
+    QJsonStreamReader::TokenType type;
+    QJsonStreamReader::Error error;
+    QString errorString;
+
+    QString text;
+    qint64 integer;
+    double real;
+    bool boolean;
+
+private:
+    Status parseName(const char *ptr, const char *end);
+    Status parseValue(const char *ptr, const char *end, const bool eof);
+    Status parseEnd(const char *ptr);
+    Status parseLiteral(const char *ptr, const char *end, const char *literal, const int length);
+    Status parseNumber(const char *ptr, const char *end, const bool eof);
+    Status parseString(const char **ptr, const char *end);
+    Status finish(QJsonStreamReader::TokenType token, Expect next, const char *ptr);
+    Status fail(const QString &message);
+
+    Q_DISABLE_COPY(QJsonStreamReaderPrivate);
+};
+
+QJsonStreamReaderPrivate::QJsonStreamReaderPrivate()
+    : device(nullptr),
+    position(0),
+    expect(ExpectStart),
+    type(QJsonStreamReader::NoToken),
+    error(QJsonStreamReader::NoError),
+    integer(0),
+    real(0.0),
+    boolean(false)
+{
+}
+
+void QJsonStreamReaderPrivate::clear()
+{
+    device = nullptr;
+    buffer.clear();
+    position = 0;
+    stack.clear();
+    expect = ExpectStart;
+    type = QJsonStreamReader::NoToken;
+    error = QJsonStreamReader::NoError;
+    errorString.clear();
+    text.clear();
+    integer = 0;
+    real = 0.0;
+    boolean = false;
+}
+
+bool QJsonStreamReaderPrivate::readMore()
+{
+    if (!device) {
+        return false;
+    }
+
+    if (position > 0) {
+        buffer.remove(0, position);
+        position = 0;
+    }
+
+    // incomplete tokens are scanned again once more data is read, grow the buffer geometrically
+    // so that huge strings are not scanned once per chunk
+    const int oldsize = buffer.size();
+    const qint64 chunksize = qMax(QJSON_READ_CHUNK, qint64(oldsize));
+    buffer.resize(oldsize + chunksize);
+    const qint64 readsize = device->read(buffer.data() + oldsize, chunksize);
+    buffer.resize(oldsize + qMax(readsize, qint64(0)));
+    return (readsize > 0);
+}
+
+void QJsonStreamReaderPrivate::raiseError(QJsonStreamReader::Error newerror, const QString &message)
+{
+    type = QJsonStreamReader::Invalid;
+    error = newerror;
+    errorString = message;
+    if (newerror != QJsonStreamReader::PrematureEndOfDocumentError) {
+        expect = ExpectNothing;
+    }
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::fail(const QString &message)
+{
+    raiseError(QJsonStreamReader::NotWellFormedError, message);
+    return Failed;
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::finish(QJsonStreamReader::TokenType token,
+                                                                  Expect next, const char *ptr)
+{
+    type = token;
+    expect = next;
+    position = (ptr - buffer.constData());
+    return Ok;
+}
+
+// nothing but the token payload is modified until the whole token is parsed, if the data ends
+// in the middle of a token it is parsed again from its start once more data is available
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parse(const bool eof)
+{
+    const char *ptr = buffer.constData() + position;
+    const char *end = buffer.constData() + buffer.size();
+
+    if (expect == ExpectStart) {
+        return finish(QJsonStreamReader::StartDocument, ExpectValue, ptr);
+    }
+
+    while (ptr < end && isJsonWhitespace(*ptr)) {
+        ptr++;
+    }
+
+    switch (expect) {
+        case ExpectValue: {
+            if (ptr == end) {
+                return NeedMoreData;
+            }
+            return parseValue(ptr, end, eof);
+        }
+        case ExpectFirstName: {
+            if (ptr == end) {
+                return NeedMoreData;
+            } else if (*ptr == '}') {
+                return parseEnd(ptr);
+            }
+            return parseName(ptr, end);
+        }
+        case ExpectFirstValue: {
+            if (ptr == end) {
+                return NeedMoreData;
+            } else if (*ptr == ']') {
+                return parseEnd(ptr);
+            }
+            return parseValue(ptr, end, eof);
+        }
+        case ExpectColon: {
+            if (ptr == end) {
+                return NeedMoreData;
+            } else if (*ptr != ':') {
+                return fail(QCoreApplication::translate("QJsonStreamReader", "Expected ':' after object key"));
+            }
+            ptr++;
+            while (ptr < end && isJsonWhitespace(*ptr)) {
+                ptr++;
+            }
+            if (ptr == end) {
+                return NeedMoreData;
+            }
+            return parseValue(ptr, end, eof);
+        }
+        case ExpectSeparator: {
+            if (stack.isEmpty()) {
+                if (ptr != end) {
+                    return fail(QCoreApplication::translate("QJsonStreamReader", "Garbage at the end of the document"));
+                } else if (!eof) {
+                    return NeedMoreData;
+                }
+                return finish(QJsonStreamReader::EndDocument, ExpectNothing, ptr);
+            }
+            if (ptr == end) {
+                return NeedMoreData;
+            } else if (*ptr != ',') {
+                return parseEnd(ptr);
+            }
+            ptr++;
+            while (ptr < end && isJsonWhitespace(*ptr)) {
+                ptr++;
+            }
+            if (ptr == end) {
+                return NeedMoreData;
+            } else if (stack.last() == '{') {
+                return parseName(ptr, end);
+            }
+            return parseValue(ptr, end, eof);
+        }
+        case ExpectStart:
+        case ExpectNothing: {
+            break;
+        }
+    }
+
+    Q_UNREACHABLE();
+    return Failed;
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseName(const char *ptr, const char *end)
+{
+    if (*ptr != '"') {
+        return fail(QCoreApplication::translate("QJsonStreamReader", "Expected string as object key"));
+    }
+    const Status status = parseString(&ptr, end);
+    if (status != Ok) {
+        return status;
+    }
+    return finish(QJsonStreamReader::Name, ExpectColon, ptr);
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseValue(const char *ptr, const char *end, const bool eof)
+{
+    switch (*ptr) {
+        case '{':
+        case '[': {
+            if (Q_UNLIKELY(stack.size() >= JSON_PARSER_MAX_DEPTH)) {
+                return fail(QCoreApplication::translate("QJsonStreamReader", "Maximum depth reached"));
+            }
+            stack.push_back(*ptr);
+            if (*ptr == '{') {
+                return finish(QJsonStreamReader::StartObject, ExpectFirstName, ptr + 1);
+            }
+            return finish(QJsonStreamReader::StartArray, ExpectFirstValue, ptr + 1);
+        }
+        case '"': {
+            const Status status = parseString(&ptr, end);
+            if (status != Ok) {
+                return status;
+            }
+            return finish(QJsonStreamReader::String, ExpectSeparator, ptr);
+        }
+        case 't': {
+            boolean = true;
+            return parseLiteral(ptr, end, "true", 4);
+        }
+        case 'f': {
+            boolean = false;
+            return parseLiteral(ptr, end, "false", 5);
+        }
+        case 'n': {
+            return parseLiteral(ptr, end, "null", 4);
+        }
+        default: {
+            if (*ptr == '-' || isJsonDigit(*ptr)) {
+                return parseNumber(ptr, end, eof);
+            }
+            break;
+        }
+    }
+    return fail(QCoreApplication::translate("QJsonStreamReader", "Unexpected character"));
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseEnd(const char *ptr)
+{
+    const char expected = (stack.last() == '{' ? '}' : ']');
+    if (*ptr != expected) {
+        if (expected == '}') {
+            return fail(QCoreApplication::translate("QJsonStreamReader", "Expected ',' or '}'"));
+        }
+        return fail(QCoreApplication::translate("QJsonStreamReader", "Expected ',' or ']'"));
+    }
+    stack.pop_back();
+    if (expected == '}') {
+        return finish(QJsonStreamReader::EndObject, ExpectSeparator, ptr + 1);
+    }
+    return finish(QJsonStreamReader::EndArray, ExpectSeparator, ptr + 1);
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseLiteral(const char *ptr, const char *end,
+                                                                        const char *literal, const int length)
+{
+    const int available = (end - ptr);
+    if (available < length) {
+        if (::memcmp(ptr, literal, available) != 0) {
+            return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid literal"));
+        }
+        return NeedMoreData;
+    } else if (::memcmp(ptr, literal, length) != 0) {
+        return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid literal"));
+    }
+    if (literal[0] == 'n') {
+        return finish(QJsonStreamReader::Null, ExpectSeparator, ptr + length);
+    }
+    return finish(QJsonStreamReader::Bool, ExpectSeparator, ptr + length);
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseNumber(const char *ptr, const char *end, const bool eof)
+{
+    // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    const char *start = ptr;
+    bool isreal = false;
+
+#define QJSON_NUMBER_CHECK_END \
+    if (ptr == end) { \
+        return NeedMoreData; \
+    }
+
+    if (*ptr == '-') {
+        ptr++;
+    }
+    QJSON_NUMBER_CHECK_END
+    if (*ptr == '0') {
+        ptr++;
+    } else if (isJsonDigit(*ptr)) {
+        while (ptr < end && isJsonDigit(*ptr)) {
+            ptr++;
+        }
+    } else {
+        return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid number"));
+    }
+
+    if (ptr < end && *ptr == '.') {
+        isreal = true;
+        ptr++;
+        QJSON_NUMBER_CHECK_END
+        if (!isJsonDigit(*ptr)) {
+            return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid number"));
+        }
+        while (ptr < end && isJsonDigit(*ptr)) {
+            ptr++;
+        }
+    }
+
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        isreal = true;
+        ptr++;
+        QJSON_NUMBER_CHECK_END
+        if (*ptr == '+' || *ptr == '-') {
+            ptr++;
+        }
+        QJSON_NUMBER_CHECK_END
+        if (!isJsonDigit(*ptr)) {
+            return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid number"));
+        }
+        while (ptr < end && isJsonDigit(*ptr)) {
+            ptr++;
+        }
+    }
+#undef QJSON_NUMBER_CHECK_END
+
+    // more digits may follow unless the data ended, only a root number can end the document
+    if (ptr == end && (!eof || !stack.isEmpty())) {
+        return NeedMoreData;
+    }
+
+    const QByteArray number = QByteArray::fromRawData(start, ptr - start);
+    bool ok = false;
+    if (!isreal) {
+        integer = number.toLongLong(&ok);
+        if (ok) {
+            return finish(QJsonStreamReader::Integer, ExpectSeparator, ptr);
+        }
+    }
+    // integers out of range are read as real numbers
+    real = number.toDouble(&ok);
+    if (!ok) {
+        return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid number"));
+    }
+    return finish(QJsonStreamReader::Real, ExpectSeparator, ptr);
+}
+
+QJsonStreamReaderPrivate::Status QJsonStreamReaderPrivate::parseString(const char **ptr, const char *end)
+{
+    const char *data = *ptr + 1;
+    const char *run = data;
+    text.clear();
+
+    while (true) {
+        if (data == end) {
+            return NeedMoreData;
+        }
+
+        const uchar c = *data;
+        if (c == '"') {
+            break;
+        } else if (Q_UNLIKELY(c < 0x20)) {
+            return fail(QCoreApplication::translate("QJsonStreamReader", "Control character in string"));
+        } else if (c != '\\') {
+            data++;
+            continue;
+        }
+
+        if (data != run) {
+            text.append(QString::fromUtf8(run, data - run));
+        }
+        data++;
+        if (data == end) {
+            return NeedMoreData;
+        }
+        switch (*data) {
+            case '"': {
+                text.append(QLatin1Char('"'));
+                break;
+            }
+            case '\\': {
+                text.append(QLatin1Char('\\'));
+                break;
+            }
+            case '/': {
+                text.append(QLatin1Char('/'));
+                break;
+            }
+            case 'b': {
+                text.append(QLatin1Char('\b'));
+                break;
+            }
+            case 'f': {
+                text.append(QLatin1Char('\f'));
+                break;
+            }
+            case 'n': {
+                text.append(QLatin1Char('\n'));
+                break;
+            }
+            case 'r': {
+                text.append(QLatin1Char('\r'));
+                break;
+            }
+            case 't': {
+                text.append(QLatin1Char('\t'));
+                break;
+            }
+            case 'u': {
+                if ((end - data) < 5) {
+                    return NeedMoreData;
+                }
+                const int unicode = jsonHexValue(data + 1);
+                if (unicode < 0) {
+                    return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid escape"));
+                }
+                data += 4;
+                if (QChar::isLowSurrogate(unicode)) {
+                    return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid Unicode escape"));
+                } else if (QChar::isHighSurrogate(unicode)) {
+                    const int available = (end - data);
+                    if ((available > 1 && data[1] != '\\') || (available > 2 && data[2] != 'u')) {
+                        return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid Unicode escape"));
+                    } else if (available < 7) {
+                        return NeedMoreData;
+                    }
+                    const int low = jsonHexValue(data + 3);
+                    if (low < 0 || !QChar::isLowSurrogate(low)) {
+                        return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid Unicode escape"));
+                    }
+                    text.append(QChar(ushort(unicode)));
+                    text.append(QChar(ushort(low)));
+                    data += 6;
+                } else {
+                    text.append(QChar(ushort(unicode)));
+                }
+                break;
+            }
+            default: {
+                return fail(QCoreApplication::translate("QJsonStreamReader", "Invalid escape"));
+            }
+        }
+        data++;
+        run = data;
+    }
+
+    if (run == (*ptr + 1)) {
+        text = QString::fromUtf8(run, data - run);
+    } else if (data != run) {
+        text.append(QString::fromUtf8(run, data - run));
+    }
+    *ptr = (data + 1);
+    return Ok;
+}
+
+/*!
+    \class QJsonStreamReader
+    \brief The QJsonStreamReader class provides a fast parser for reading
+    well-formed JSON via a simple streaming API.
+    \since 4.12
+    \reentrant
+
+    \ingroup io
+
+    QJsonStreamReader is a pull parser, the JSON document is read one token
+    at a time with readNext() without building a tree of the whole document
+    in memory. It is meant for large documents, QJsonDocument is usually
+    more convenient for small ones.
+
+    The data can be read from a QIODevice, see setDevice(), or added in
+    chunks with addData(). If the available data ends in the middle of the
+    document readNext() returns Invalid with PrematureEndOfDocumentError,
+    the error is recoverable and parsing continues from where it stopped
+    once more data is available.
+
+    A typical loop looks like this:
+
+    \code
+    QJsonStreamReader json(&file);
+    while (!json.atEnd()) {
+        json.readNext();
+        if (json.tokenType() == QJsonStreamReader::Name && json.text() == "name") {
+            json.readNext();
+            names.append(json.text());
+        }
+    }
+    if (json.hasError()) {
+        // ... error handling
+    }
+    \endcode
+
+    Nested values are limited to the same depth as QJsonDocument.
+
+    \sa QJsonDocument
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token the reader just read.
+
+    \value NoToken The reader has not yet read anything.
+    \value Invalid An error has occurred, reported in error() and errorString().
+    \value StartDocument The reader is at the start of the document.
+    \value EndDocument The reader reached the end of the document.
+    \value StartObject The reader is at the start of an object.
+    \value EndObject The reader is at the end of an object.
+    \value StartArray The reader is at the start of an array.
+    \value EndArray The reader is at the end of an array.
+    \value Name The reader read an object key, it is available from text().
+    \value String The reader read a string, it is available from text().
+    \value Integer The reader read an integer number, it is available from integerValue().
+    \value Real The reader read a real number, it is available from realValue().
+    \value Bool The reader read a boolean, it is available from boolValue().
+    \value Null The reader read a null value.
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum specifies different error cases.
+
+    \value NoError No error has occurred.
+    \value NotWellFormedError The parser internally raised an error due to
+    the read JSON not being well-formed.
+    \value PrematureEndOfDocumentError The input stream ended before a
+    well-formed JSON document was parsed. Recovery from this error is
+    possible if more JSON arrives in the stream, either by calling addData()
+    or by waiting for it to arrive on the device().
+*/
+
+/*!
+    Constructs a stream reader.
+
+    \sa setDevice(), addData()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d_ptr(new QJsonStreamReaderPrivate())
+{
+}
+
+/*!
+    Creates a new stream reader that reads from \a device.
+
+    \sa setDevice(), clear()
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d_ptr(new QJsonStreamReaderPrivate())
+{
+    setDevice(device);
+}
+
+/*!
+    Creates a new stream reader that reads from \a data.
+
+    \sa addData(), clear(), setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d_ptr(new QJsonStreamReaderPrivate())
+{
+    Q_D(QJsonStreamReader);
+    d->buffer = data;
+}
+
+/*!
+    Destructs the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+    delete d_ptr;
+}
+
+/*!
+    Sets the current device to \a device. Setting the device resets
+    the stream to its initial state.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    Q_D(QJsonStreamReader);
+    d->clear();
+    d->device = device;
+}
+
+/*!
+    Returns the current device associated with the QJsonStreamReader,
+    or 0 if no device has been assigned.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->device;
+}
+
+/*!
+    Adds more \a data for the reader to read. This function does nothing if
+    the reader has a device().
+
+    \sa readNext(), clear()
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    Q_D(QJsonStreamReader);
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with device()");
+        return;
+    }
+    if (d->position > 0) {
+        d->buffer.remove(0, d->position);
+        d->position = 0;
+    }
+    d->buffer.append(data);
+}
+
+/*!
+    Removes any device() or data from the reader and resets its internal
+    state to the initial state.
+
+    \sa addData()
+*/
+void QJsonStreamReader::clear()
+{
+    Q_D(QJsonStreamReader);
+    d->clear();
+}
+
+/*!
+    Returns true if the reader has read until the end of the JSON document,
+    or if an error() has occurred and reading has been aborted. Otherwise,
+    it returns false.
+
+    \sa hasError(), error(), device()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    Q_D(const QJsonStreamReader);
+    return (d->type == EndDocument || d->type == Invalid);
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    With one exception, once an error() is reported by readNext(), further
+    reading of the JSON stream is not possible. Then atEnd() returns true,
+    hasError() returns true, and this function returns
+    QJsonStreamReader::Invalid.
+
+    The exception is when error() returns PrematureEndOfDocumentError. This
+    error is reported when the end of an otherwise well-formed chunk of JSON
+    is reached, but the chunk doesn't represent a complete JSON document. In
+    that case, parsing \e can be resumed by calling addData() to add the next
+    chunk of JSON, when the stream is being read from a QByteArray, or by
+    waiting for more data to arrive when the stream is being read from a
+    device().
+
+    \sa tokenType()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    Q_D(QJsonStreamReader);
+    if (d->expect == QJsonStreamReaderPrivate::ExpectNothing) {
+        return d->type;
+    }
+    d->error = NoError;
+    d->errorString.clear();
+
+    QJsonStreamReaderPrivate::Status status = d->parse(false);
+    while (status == QJsonStreamReaderPrivate::NeedMoreData) {
+        if (!d->readMore()) {
+            status = d->parse(true);
+            if (status == QJsonStreamReaderPrivate::NeedMoreData) {
+                d->raiseError(PrematureEndOfDocumentError,
+                    QCoreApplication::translate("QJsonStreamReader", "Premature end of document"));
+            }
+            break;
+        }
+        status = d->parse(false);
+    }
+    return d->type;
+}
+
+/*!
+    Reads until the end of the current value, skipping any nested values.
+    If the current token is a Name the value that belongs to it is skipped.
+    Does nothing for tokens that are not the start of a value.
+*/
+void QJsonStreamReader::skipCurrentValue()
+{
+    Q_D(QJsonStreamReader);
+    if (d->type == Name) {
+        readNext();
+        if (d->type != StartObject && d->type != StartArray) {
+            return;
+        }
+    }
+    if (d->type != StartObject && d->type != StartArray) {
+        return;
+    }
+    const int level = depth();
+    while (!atEnd()) {
+        readNext();
+        if ((d->type == EndObject || d->type == EndArray) && depth() < level) {
+            return;
+        }
+    }
+}
+
+/*!
+    Returns the type of the current token.
+
+    \sa readNext()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->type;
+}
+
+/*!
+    Returns the number of objects and arrays that the current token is
+    nested in, including the object or array it starts.
+*/
+int QJsonStreamReader::depth() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->stack.size();
+}
+
+/*!
+    Returns the text of Name and String tokens, an empty string for any other.
+
+    \sa value()
+*/
+QString QJsonStreamReader::text() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type != Name && d->type != String) {
+        return QString();
+    }
+    return d->text;
+}
+
+/*!
+    Returns the value of Integer tokens, 0 for any other.
+
+    \sa value()
+*/
+qint64 QJsonStreamReader::integerValue() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type != Integer) {
+        return 0;
+    }
+    return d->integer;
+}
+
+/*!
+    Returns the value of Real and Integer tokens, 0 for any other.
+
+    \sa value()
+*/
+double QJsonStreamReader::realValue() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type == Integer) {
+        return double(d->integer);
+    } else if (d->type != Real) {
+        return 0.0;
+    }
+    return d->real;
+}
+
+/*!
+    Returns the value of Bool tokens, false for any other.
+
+    \sa value()
+*/
+bool QJsonStreamReader::boolValue() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type != Bool) {
+        return false;
+    }
+    return d->boolean;
+}
+
+/*!
+    Returns the current token as variant, the same way QJsonDocument
+    converts values. Returns invalid variant for any token that is not
+    a Name or scalar value.
+*/
+QVariant QJsonStreamReader::value() const
+{
+    Q_D(const QJsonStreamReader);
+    switch (d->type) {
+        case Name:
+        case String: {
+            return QVariant(d->text);
+        }
+        case Integer: {
+            return QVariant(d->integer);
+        }
+        case Real: {
+            return QVariant(d->real);
+        }
+        case Bool: {
+            return QVariant(d->boolean);
+        }
+        default: {
+            break;
+        }
+    }
+    return QVariant();
+}
+
+/*!
+    Returns the type of the current error, or NoError if no error occurred.
+
+    \sa errorString()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->error;
+}
+
+/*!
+    Returns the error message that was set with raiseError().
+
+    \sa error(), hasError()
+*/
+QString QJsonStreamReader::errorString() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->errorString;
+}
+
+/*!
+    \fn bool QJsonStreamReader::hasError() const
+
+    Returns true if an error has occurred, otherwise false.
+
+    \sa errorString(), error()
+*/
+
+QT_END_NAMESPACE
@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QJSONSTREAMREADER_H
+#define QJSONSTREAMREADER_H
+
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QJsonStreamReaderPrivate;
+
+class Q_CORE_EXPORT QJsonStreamReader
+{
+public:
+    enum TokenType {
+        NoToken = 0,
+        Invalid,
+        StartDocument,
+        EndDocument,
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Name,
+        String,
+        Integer,
+        Real,
+        Bool,
+        Null
+    };
+
+    enum Error {
+        NoError,
+        NotWellFormedError,
+        PrematureEndOfDocumentError
+    };
+
+    QJsonStreamReader();
+    QJsonStreamReader(QIODevice *device);
+    QJsonStreamReader(const QByteArray &data);
+    ~QJsonStreamReader();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+    void addData(const QByteArray &data);
+    void clear();
+
+    bool atEnd() const;
+    TokenType readNext();
+    void skipCurrentValue();
+
+    TokenType tokenType() const;
+    int depth() const;
+
+    QString text() const;
+    qint64 integerValue() const;
+    double realValue() const;
+    bool boolValue() const;
+    QVariant value() const;
+
+    Error error() const;
+    QString errorString() const;
+    inline bool hasError() const
+    {
+        return error() != NoError;
+    }
+
+private:
+    Q_DISABLE_COPY(QJsonStreamReader)
+    Q_DECLARE_PRIVATE(QJsonStreamReader)
+    QJsonStreamReaderPrivate *d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMREADER_H
@@ -0,0 +1,241 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qparallelalgorithms.h"
+#include "qthreadpool.h"
+#include "qelapsedtimer.h"
+#include "qwaitcondition.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+// ranges that are done within this time are not spread over the pool
+#define QT_PARALLEL_MIN_NSECS 100000
+// the time a chunk should take, long enough to hide the scheduling cost
+#define QT_PARALLEL_CHUNK_NSECS 50000
+
+class QParallelForJob
+{
+public:
+    QParallelForJob(int begin, int count, int chunk,
+                    void (*function)(void *, int, int), void *data)
+        : ref(1), next(begin), done(begin), count(count), chunk(chunk),
+        function(function), data(data)
+    { }
+
+    void work()
+    {
+        for (;;) {
+            const int begin = next.fetchAndAddRelaxed(chunk);
+            if (begin >= count) {
+                return;
+            }
+            const int end = qMin(count - begin, chunk) + begin;
+            function(data, begin, end);
+            if (done.fetchAndAddOrdered(end - begin) + (end - begin) == count) {
+                QMutexLocker locker(&mutex);
+                finished.wakeAll();
+            }
+        }
+    }
+
+    void wait()
+    {
+        QMutexLocker locker(&mutex);
+        while (done.load() < count) {
+            finished.wait(&mutex);
+        }
+    }
+
+    QAtomicInt ref;
+    QAtomicInt next;
+    QAtomicInt done;
+    const int count;
+    const int chunk;
+    // only used for chunks that are claimed, the caller waits for those
+    void (*function)(void *, int, int);
+    void *data;
+    QMutex mutex;
+    QWaitCondition finished;
+};
+
+class QParallelForRunnable : public QRunnable
+{
+public:
+    QParallelForRunnable(QParallelForJob *job)
+        : job(job)
+    { }
+
+    void run()
+    {
+        // the caller does not wait for helpers that start after the last
+        // chunk was claimed, the last one out deletes the job
+        job->work();
+        if (!job->ref.deref()) {
+            delete job;
+        }
+    }
+
+private:
+    QParallelForJob *job;
+};
+
+int qt_parallel_thread_count()
+{
+    return qMax(QThreadPool::globalInstance()->maxThreadCount(), 1);
+}
+
+void qt_parallel_for(int count, int grain, void (*function)(void *data, int begin, int end), void *data)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    const int threads = qt_parallel_thread_count();
+    if (threads < 2 || count == 1) {
+        function(data, 0, count);
+        return;
+    }
+
+    int begin = 0;
+    int chunk = grain;
+    if (chunk <= 0) {
+        // run batches of growing size here until they take long enough to
+        // be worth spreading, then size the chunks from the time per element
+        QElapsedTimer timer;
+        timer.start();
+        int batch = 1;
+        qint64 elapsed = 0;
+        while (begin < count) {
+            const int end = qMin(count - begin, batch) + begin;
+            function(data, begin, end);
+            begin = end;
+            elapsed = timer.nsecsElapsed();
+            if (elapsed >= QT_PARALLEL_MIN_NSECS) {
+                break;
+            }
+            batch = qMin(batch, count / 2) * 2;
+        }
+        if (begin >= count) {
+            return;
+        }
+
+        const qint64 elementnsecs = qMax(elapsed / begin, Q_INT64_C(1));
+        const int balanced = qMax((count - begin) / (threads * 4), 1);
+        chunk = int(qBound(Q_INT64_C(1), QT_PARALLEL_CHUNK_NSECS / elementnsecs, qint64(balanced)));
+    }
+
+    const int chunks = (count - begin + chunk - 1) / chunk;
+    const int helpers = qMin(threads, chunks) - 1;
+    QParallelForJob *job = new QParallelForJob(begin, count, chunk, function, data);
+    job->ref.fetchAndAddRelaxed(helpers);
+    QThreadPool *pool = QThreadPool::globalInstance();
+    for (int i = 0; i < helpers; i++) {
+        pool->start(new QParallelForRunnable(job));
+    }
+
+    job->work();
+    job->wait();
+    if (!job->ref.deref()) {
+        delete job;
+    }
+}
+
+/*!
+    \headerfile <qparallelalgorithms.h>
+    \title Parallel Algorithms
+
+    \brief The <qparallelalgorithms.h> header includes parallel versions of
+    some of the generic algorithms.
+
+    The functions run on the threads of QThreadPool::globalInstance() and
+    work on QList, QVector and other containers with random access
+    iterators. The calling thread takes part in the work and the functions
+    return when all of it is done.
+
+    The range is first processed in small batches by the calling thread.
+    If it is done before the batches take long enough to be worth the cost
+    of waking other threads, nothing is spread over the pool. Otherwise the
+    remaining elements are split into chunks sized from the time each
+    element took, which the threads take one at a time so that a thread
+    that is done early takes over work from slower ones.
+
+    The functions passed in are called from several threads at once and
+    must be thread-safe.
+*/
+
+/*!
+    \fn void qParallelFor(int count, F function)
+    \relates <qparallelalgorithms.h>
+
+    Calls \a function(begin, end) for consecutive ranges which together
+    cover the indexes from 0 to \a count.
+*/
+
+/*!
+    \fn void qParallelForEach(Container &container, F function)
+    \relates <qparallelalgorithms.h>
+
+    Calls \a function on each item of the \a container, the item is passed
+    by reference and may be modified.
+*/
+
+/*!
+    \fn Container qParallelMap(const Container &container, F function)
+    \relates <qparallelalgorithms.h>
+
+    Returns a container with the results of calling \a function on each item
+    of the \a container, in the same order.
+*/
+
+/*!
+    \fn Container qParallelFilter(const Container &container, F predicate)
+    \relates <qparallelalgorithms.h>
+
+    Returns a container with the items of the \a container for which
+    \a predicate returns true, in the same order.
+*/
+
+/*!
+    \fn T qParallelReduce(const Container &container, const T &identity, F function)
+    \relates <qparallelalgorithms.h>
+
+    Combines the items of the \a container with \a function, which must be
+    associative and for which \a identity must be the identity element.
+    The ranges are combined in parallel, starting from \a identity, and the
+    results of the ranges are then combined in order.
+*/
+
+/*!
+    \fn void qParallelSort(RandomAccessIterator begin, RandomAccessIterator end, LessThan lessThan)
+    \relates <qparallelalgorithms.h>
+
+    Sorts the items in range [\a begin, \a end) using \a lessThan. Ranges
+    shorter than twice QT_PARALLEL_SORT_THRESHOLD are sorted with qSort(),
+    longer ones are split into pieces that are sorted in parallel and then
+    merged. Like qSort() the sort is not stable.
+*/
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
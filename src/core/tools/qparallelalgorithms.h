@@ -0,0 +1,189 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QPARALLELALGORITHMS_H
+#define QPARALLELALGORITHMS_H
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qmutex.h>
+
+
+QT_BEGIN_NAMESPACE
+
+
+#ifndef QT_NO_THREAD
+
+// the smallest piece qParallelSort() sorts on its own
+#define QT_PARALLEL_SORT_THRESHOLD 8192
+
+// runs function over [0, count) in chunks on the global thread pool, the
+// calling thread takes part. with grain 0 the chunk size is picked from how
+// long the first elements take, cheap ranges are not spread at all
+Q_CORE_EXPORT void qt_parallel_for(int count, int grain, void (*function)(void *data, int begin, int end), void *data);
+Q_CORE_EXPORT int qt_parallel_thread_count();
+
+template <typename F>
+struct QParallelForFunction
+{
+    static void call(void *data, int begin, int end)
+    { (*static_cast<F *>(data))(begin, end); }
+};
+
+template <typename F>
+inline void qParallelFor(int count, F function)
+{
+    qt_parallel_for(count, 0, &QParallelForFunction<F>::call, &function);
+}
+
+template <typename Container, typename F>
+void qParallelForEach(Container &container, F function)
+{
+    const typename Container::iterator begin = container.begin();
+    qParallelFor(int(container.size()), [begin, &function](int from, int to) {
+        for (int i = from; i < to; ++i)
+            function(begin[i]);
+    });
+}
+
+template <typename Container, typename F>
+Container qParallelMap(const Container &container, F function)
+{
+    Container result(container);
+    const typename Container::const_iterator source = container.begin();
+    const typename Container::iterator destination = result.begin();
+    qParallelFor(int(container.size()), [source, destination, &function](int from, int to) {
+        for (int i = from; i < to; ++i)
+            destination[i] = function(source[i]);
+    });
+    return result;
+}
+
+template <typename Container, typename F>
+Container qParallelFilter(const Container &container, F predicate)
+{
+    const int count = int(container.size());
+    QVector<char> keep(count);
+    const typename Container::const_iterator source = container.begin();
+    char *flags = keep.data();
+    qParallelFor(count, [source, flags, &predicate](int from, int to) {
+        for (int i = from; i < to; ++i)
+            flags[i] = predicate(source[i]);
+    });
+
+    Container result;
+    for (int i = 0; i < count; ++i) {
+        if (flags[i])
+            result.push_back(source[i]);
+    }
+    return result;
+}
+
+// function must be associative and identity its identity element, the
+// partial results are combined in order
+template <typename Container, typename T, typename F>
+T qParallelReduce(const Container &container, const T &identity, F function)
+{
+    QMutex mutex;
+    QList<QPair<int, T> > partials;
+    const typename Container::const_iterator source = container.begin();
+    qParallelFor(int(container.size()), [source, &identity, &function, &mutex, &partials](int from, int to) {
+        T partial = identity;
+        for (int i = from; i < to; ++i)
+            partial = function(partial, source[i]);
+        QMutexLocker locker(&mutex);
+        partials.append(qMakePair(from, partial));
+    });
+
+    qSort(partials.begin(), partials.end(), [](const QPair<int, T> &left, const QPair<int, T> &right) {
+        return (left.first < right.first);
+    });
+    T result = identity;
+    for (int i = 0; i < partials.size(); ++i)
+        result = function(result, partials.at(i).second);
+    return result;
+}
+
+template <typename RandomAccessIterator, typename LessThan>
+void qParallelSort(RandomAccessIterator start, RandomAccessIterator end, LessThan lessThan)
+{
+    const int count = int(end - start);
+    int pieces = 1;
+    const int maxpieces = qMin(count / QT_PARALLEL_SORT_THRESHOLD, 4 * qt_parallel_thread_count());
+    while (pieces * 2 <= maxpieces)
+        pieces *= 2;
+    if (pieces < 2) {
+        qSort(start, end, lessThan);
+        return;
+    }
+
+    // sort pieces of about the same size, then merge them pairwise
+    QVector<int> bounds(pieces + 1);
+    for (int i = 0; i <= pieces; ++i)
+        bounds[i] = int(qint64(count) * i / pieces);
+
+    auto sortpieces = [start, &bounds, &lessThan](int from, int to) {
+        for (int i = from; i < to; ++i)
+            qSort(start + bounds.at(i), start + bounds.at(i + 1), lessThan);
+    };
+    qt_parallel_for(pieces, 1, &QParallelForFunction<decltype(sortpieces)>::call, &sortpieces);
+
+    for (int width = 1; width < pieces; width *= 2) {
+        auto mergepieces = [start, width, &bounds, &lessThan](int from, int to) {
+            for (int i = from; i < to; ++i) {
+                const int first = i * 2 * width;
+                std::inplace_merge(start + bounds.at(first),
+                                   start + bounds.at(first + width),
+                                   start + bounds.at(first + 2 * width),
+                                   lessThan);
+            }
+        };
+        qt_parallel_for(pieces / (2 * width), 1, &QParallelForFunction<decltype(mergepieces)>::call, &mergepieces);
+    }
+}
+
+template <typename RandomAccessIterator>
+inline void qParallelSort(RandomAccessIterator start, RandomAccessIterator end)
+{
+    qParallelSort(start, end, qLess<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+}
+
+template <typename Container>
+inline void qParallelSort(Container &container)
+{
+    qParallelSort(container.begin(), container.end());
+}
+
+template <typename Container, typename LessThan>
+inline void qParallelSort(Container &container, LessThan lessThan)
+{
+    qParallelSort(container.begin(), container.end(), lessThan);
+}
+
+#endif // QT_NO_THREAD
+
+QT_END_NAMESPACE
+
+
+#endif // QPARALLELALGORITHMS_H
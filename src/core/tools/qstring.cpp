@@ -3144,12 +3144,7 @@ static QByteArray toLatin1_helper(const QChar *data, int length)
     if (!length) {
         return QByteArray();
     }
-    QStdVector<char> result(length);
-    for (int i = 0; i < length; i++) {
-        const ushort ucs = data[i].unicode();
-        result[i] = (ucs > 0xff) ? '?' : char(ucs);
-    }
-    return QByteArray(result.constData(), length);
+    return QTextCodecPrivate::toLatin1(data, length);
 }
 
 /*!
@@ -3176,7 +3171,7 @@ QByteArray QString::toLatin1() const
 */
 QByteArray QString::toAscii() const
 {
-    return QTextCodecPrivate::convertFrom(constData(), length(), "US-ASCII");
+    return QTextCodecPrivate::toAscii(constData(), length());
 }
 
 static inline QByteArray toLocal8Bit_helper(const QChar *data, int length)
@@ -3226,7 +3221,7 @@ QByteArray QString::toUtf8() const
     if (isNull())
         return QByteArray();
 
-    return QTextCodecPrivate::convertFrom(constData(), length(), "UTF-8");
+    return QTextCodecPrivate::toUtf8(constData(), length());
 }
 
 /*!
@@ -3260,16 +3255,9 @@ QString::Data *QString::fromLatin1_helper(const char *str, int size)
     } else {
         if (size < 0)
             size = qstrlen(str);
-        d = static_cast<Data *>(::malloc(sizeof(Data) + size * sizeof(QChar)));
-        Q_CHECK_PTR(d);
-        d->ref = 1;
-        d->alloc = d->size = size;
-        d->capacity = 0;
-        d->data = d->array;
-        d->array[size] = '\0';
-        ushort *dst = d->data;
-        while (size--)
-            *dst++ = (uchar)*str++;
+        QString s = QTextCodecPrivate::fromLatin1(str, size);
+        d = s.d;
+        d->ref.ref();
     }
     return d;
 }
@@ -3286,7 +3274,7 @@ QString::Data *QString::fromAscii_helper(const char *str, int size)
     } else {
         if (size < 0)
             size = qstrlen(str);
-        QString s = QString::fromAscii(str, size);
+        QString s = QTextCodecPrivate::fromAscii(str, size);
         d = s.d;
         d->ref.ref();
     }
@@ -3310,7 +3298,7 @@ QString QString::fromLatin1(const char *str, int size)
     if (size < 0) {
         size = qstrlen(str);
     }
-    return QTextCodecPrivate::convertTo(str, size, "latin1");
+    return QTextCodecPrivate::fromLatin1(str, size);
 }
 
 /*!
@@ -3357,7 +3345,7 @@ QString QString::fromAscii(const char *str, int size)
     if (size < 0) {
         size = qstrlen(str);
     }
-    return QTextCodecPrivate::convertTo(str, size, "US-ASCII");
+    return QTextCodecPrivate::fromAscii(str, size);
 }
 
 /*!
@@ -3389,7 +3377,7 @@ QString QString::fromUtf8(const char *str, int size)
     if (size < 0) {
         size = qstrlen(str);
     }
-    return QTextCodecPrivate::convertTo(str, size, "UTF-8");
+    return QTextCodecPrivate::fromUtf8(str, size);
 }
 
 /*!
@@ -8099,7 +8087,7 @@ QByteArray QStringRef::toLatin1() const
 */
 QByteArray QStringRef::toAscii() const
 {
-    return QTextCodecPrivate::convertFrom(constData(), length(), "US-ASCII");
+    return QTextCodecPrivate::toAscii(constData(), length());
 }
 
 /*!
@@ -8146,7 +8134,7 @@ QByteArray QStringRef::toUtf8() const
 {
     if (isNull())
         return QByteArray();
-    return QTextCodecPrivate::convertFrom(constData(), length(), "UTF-8");
+    return QTextCodecPrivate::toUtf8(constData(), length());
 }
 
 /*!
@@ -368,6 +368,8 @@ void QDBusMetaObjectGenerator::write(QDBusMetaObject *obj)
     header->constructorData = 0;
     header->flags = RequiresVariantMetaObject;
     header->signalCount = signals_.count();
+    header->methodHashSize = 0;
+    header->methodHashData = 0;
     // These are specific to QDBusMetaObject:
     header->propertyDBusData = header->propertyData + header->propertyCount * 3;
     header->methodDBusData = header->propertyDBusData + header->propertyCount * intsPerProperty;
@@ -34,6 +34,8 @@
 
 #include <QtCore/qdebug.h>
 
+#include <mutex>
+
 
 QT_BEGIN_NAMESPACE
 
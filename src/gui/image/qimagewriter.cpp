@@ -75,6 +75,7 @@
 #include "qimagewriter.h"
 #include "qbytearray.h"
 #include "qfile.h"
+#include "qsavefile.h"
 #include "qimageiohandler.h"
 #include "qset.h"
 #include "qvariant.h"
@@ -193,8 +194,7 @@ QImageWriter::QImageWriter(QIODevice *device, const QByteArray &format)
 QImageWriter::QImageWriter(const QString &fileName, const QByteArray &format)
     : d(new QImageWriterPrivate())
 {
-    QFile *file = new QFile(fileName);
-    d->device = file;
+    d->device = new QSaveFile(fileName);
     d->deleteDevice = true;
     d->format = format;
     if (d->format.isEmpty()) {
@@ -273,14 +273,15 @@ QIODevice *QImageWriter::device() const
 
 /*!
     Sets the file name of QImageWriter to \a fileName. Internally,
-    QImageWriter will create a QFile and open it in \l
+    QImageWriter will create a QSaveFile and open it in \l
     QIODevice::WriteOnly mode, and use this file when writing images.
+    The file is replaced only once the whole image has been written.
 
     \sa fileName(), setDevice()
 */
 void QImageWriter::setFileName(const QString &fileName)
 {
-    setDevice(new QFile(fileName));
+    setDevice(new QSaveFile(fileName));
     d->deleteDevice = true;
 }
 
@@ -392,10 +393,23 @@ bool QImageWriter::write(const QImage &image)
     if (d->handler->supportsOption(QImageIOHandler::CompressionLevel))
         d->handler->setOption(QImageIOHandler::CompressionLevel, d->compression);
 
-    if (!d->handler->write(image))
+    // the file set by name is replaced as a whole, or not at all
+    QSaveFile *savefile = (d->deleteDevice ? qobject_cast<QSaveFile *>(d->device) : nullptr);
+    if (!d->handler->write(image)) {
+        if (savefile) {
+            savefile->cancelWriting();
+            savefile->commit();
+        }
         return false;
-    if (QFile *file = qobject_cast<QFile *>(d->device))
+    }
+    if (savefile) {
+        if (!savefile->commit()) {
+            d->imageWriterError = QImageWriter::DeviceError;
+            return false;
+        }
+    } else if (QFile *file = qobject_cast<QFile *>(d->device)) {
         file->flush();
+    }
     return true;
 }
 
@@ -23,6 +23,7 @@
 #include "qimage.h"
 #include "qimage_p.h"
 #include "qvariant.h"
+#include "qfile.h"
 #include "qdebug.h"
 #include "qcorecommon_p.h"
 
@@ -61,6 +62,15 @@ bool QKatHandler::canRead(QIODevice *device)
     return (::memcmp(head, "KATIE", 5) == 0);
 }
 
+static inline void freeCompressed(QFile *file, uchar *mapped, char *compressed)
+{
+    if (mapped) {
+        file->unmap(mapped);
+    } else {
+        ::free(compressed);
+    }
+}
+
 bool QKatHandler::read(QImage *image)
 {
     QDataStream imagestream(device());
@@ -91,14 +101,28 @@ bool QKatHandler::read(QImage *image)
         return false;
     }
 
-    char* compressedimage = static_cast<char*>(::malloc(compressedsize * sizeof(char)));
-    Q_CHECK_PTR(compressedimage);
-    imagestream.readRawData(compressedimage, compressedsize);
+    // decompress straight from the page cache when reading a file
+    QFile* imagefile = qobject_cast<QFile*>(device());
+    uchar* mappedimage = nullptr;
+    char* compressedimage = nullptr;
+    if (imagefile && compressedsize > 0) {
+        const qint64 imagepos = imagefile->pos();
+        mappedimage = imagefile->map(imagepos, compressedsize, QFile::MapSequentialHint);
+        if (mappedimage) {
+            compressedimage = reinterpret_cast<char*>(mappedimage);
+            imagefile->seek(imagepos + compressedsize);
+        }
+    }
+    if (!mappedimage) {
+        compressedimage = static_cast<char*>(::malloc(compressedsize * sizeof(char)));
+        Q_CHECK_PTR(compressedimage);
+        imagestream.readRawData(compressedimage, compressedsize);
+    }
 
     if (Q_UNLIKELY(imagestream.status() != QDataStream::Ok)) {
         qWarning("QKatHandler::read() Could not read image");
         *image = QImage();
-        ::free(compressedimage);
+        freeCompressed(imagefile, mappedimage, compressedimage);
         return false;
     }
 
@@ -106,7 +130,7 @@ bool QKatHandler::read(QImage *image)
     if (Q_UNLIKELY(!decomp)) {
         qWarning("QKatHandler::read(): Could not allocate decompressor");
         *image = QImage();
-        ::free(compressedimage);
+        freeCompressed(imagefile, mappedimage, compressedimage);
         return false;
     }
     size_t decompsize = uncompressedsize;
@@ -117,7 +141,7 @@ bool QKatHandler::read(QImage *image)
         &decompsize
     );
     libdeflate_free_decompressor(decomp);
-    ::free(compressedimage);
+    freeCompressed(imagefile, mappedimage, compressedimage);
 
     if (Q_UNLIKELY(decompresult != LIBDEFLATE_SUCCESS)) {
         qWarning("QKatHandler::read() Could not decompress image (%d)", decompresult);
@@ -1691,14 +1691,15 @@ void QHeaderView::sectionsInserted(const QModelIndex &parent,
     }
 
     // insert sections into hiddenSectionSize
-    QHash<int, int> newHiddenSectionSize; // from logical index to section size
+    QFlatHash<int, int> newHiddenSectionSize; // from logical index to section size
+    newHiddenSectionSize.reserve(d->hiddenSectionSize.count());
     for (int i = 0; i < logicalFirst; ++i)
         if (isSectionHidden(i))
-            newHiddenSectionSize[i] = d->hiddenSectionSize[i];
+            newHiddenSectionSize.insert(i, d->hiddenSectionSize.value(i));
     for (int j = logicalLast + 1; j < d->sectionCount; ++j)
         if (isSectionHidden(j))
-            newHiddenSectionSize[j] = d->hiddenSectionSize[j - insertCount];
-    d->hiddenSectionSize = newHiddenSectionSize;
+            newHiddenSectionSize.insert(j, d->hiddenSectionSize.value(j - insertCount));
+    d->hiddenSectionSize.swap(newHiddenSectionSize);
 
     d->doDelayedResizeSections();
     emit sectionCountChanged(oldCount, count());
@@ -1730,14 +1731,15 @@ void QHeaderViewPrivate::updateHiddenSections(int logicalFirst, int logicalLast)
     const int changeCount = logicalLast - logicalFirst + 1;
 
     // remove sections from hiddenSectionSize
-    QHash<int, int> newHiddenSectionSize; // from logical index to section size
+    QFlatHash<int, int> newHiddenSectionSize; // from logical index to section size
+    newHiddenSectionSize.reserve(hiddenSectionSize.count());
     for (int i = 0; i < logicalFirst; ++i)
         if (q->isSectionHidden(i))
-            newHiddenSectionSize[i] = hiddenSectionSize[i];
+            newHiddenSectionSize.insert(i, hiddenSectionSize.value(i));
     for (int j = logicalLast + 1; j < sectionCount; ++j)
         if (q->isSectionHidden(j))
-            newHiddenSectionSize[j - changeCount] = hiddenSectionSize[j];
-    hiddenSectionSize = newHiddenSectionSize;
+            newHiddenSectionSize.insert(j - changeCount, hiddenSectionSize.value(j));
+    hiddenSectionSize.swap(newHiddenSectionSize);
 
     // remove sections from sectionsHidden
     if (!sectionHidden.isEmpty()) {
@@ -1909,7 +1911,7 @@ void QHeaderView::initializeSections(int start, int end)
                 for (int i = end + 1; i < d->sectionCount; ++i)
                     d->hiddenSectionSize.remove(i);
             } else {
-                QHash<int, int>::iterator it = d->hiddenSectionSize.begin();
+                QFlatHash<int, int>::iterator it = d->hiddenSectionSize.begin();
                 while (it != d->hiddenSectionSize.end()) {
                     if (it.key() > end)
                         it = d->hiddenSectionSize.erase(it);
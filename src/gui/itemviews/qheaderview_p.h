@@ -38,6 +38,7 @@
 #ifndef QT_NO_ITEMVIEWS
 
 #include "QtCore/qbitarray.h"
+#include "qflathash_p.h"
 #include "QtGui/qapplication.h"
 #include "QtGui/qlabel.h"
 
@@ -227,8 +228,8 @@ public:
     mutable QVector<int> logicalIndices; // logicalIndex = row or column in the model
     mutable QBitArray sectionSelected; // from logical index to bit
     mutable QBitArray sectionHidden; // from visual index to bit
-    mutable QHash<int, int> hiddenSectionSize; // from logical index to section size
-    mutable QHash<int, int> cascadingSectionSize; // from visual index to section size
+    mutable QFlatHash<int, int> hiddenSectionSize; // from logical index to section size
+    mutable QFlatHash<int, int> cascadingSectionSize; // from visual index to section size
     mutable QSize cachedSizeHint;
     mutable QBasicTimer delayedResize;
 
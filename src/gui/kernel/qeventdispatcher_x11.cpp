@@ -123,6 +123,11 @@ bool QEventDispatcherX11::processEvents(QEventLoop::ProcessEventsFlags flags)
             QApplication::sendPostedEvents();
             return nevents > 0;
         }
+        // wake up when the X server sends something
+        const int xfd = ConnectionNumber(qt_x11Data->display);
+        if (Q_LIKELY(xfd > 0))
+            d->registerWakeUpFd(xfd);
+
         // return true if we handled events, false otherwise
         return QEventDispatcherUNIX::processEvents(flags) ||  (nevents > 0);
     }
@@ -141,17 +146,6 @@ void QEventDispatcherX11::flush()
     XFlush(qt_x11Data->display);
 }
 
-int QEventDispatcherX11::select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *exceptfds,
-                                timeval *timeout)
-{
-    int xfd = ConnectionNumber(qt_x11Data->display);
-    if (Q_LIKELY(xfd > 0)) {
-        nfds = qMax(nfds - 1, xfd) + 1;
-        FD_SET(xfd, readfds);
-    }
-    return QEventDispatcherUNIX::select(nfds, readfds, writefds, exceptfds, timeout);
-}
-
 QT_END_NAMESPACE
 
 
@@ -52,10 +52,6 @@ public:
     bool hasPendingEvents();
 
     void flush();
-
-protected:
-    int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *exceptfds,
-               timeval *timeout) final;
 };
 
 QT_END_NAMESPACE
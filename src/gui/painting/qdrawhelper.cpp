@@ -2843,6 +2843,31 @@ inline static void qt_rectfill_nonpremul_quint32(QRasterBuffer *rasterBuffer,
                          INV_PREMUL(color), x, y, width, height, rasterBuffer->bytesPerLine());
 }
 
+static void qt_alphamapblit_quint32(QRasterBuffer *rasterBuffer,
+                                    int x, int y, quint32 color,
+                                    const uchar *map,
+                                    int mapWidth, int mapHeight, int mapStride)
+{
+    const int destStride = rasterBuffer->bytesPerLine() / sizeof(quint32);
+    quint32 *dest = reinterpret_cast<quint32 *>(rasterBuffer->scanLine(y)) + x;
+    const bool opaque = (qAlpha(color) == 255);
+
+    while (mapHeight--) {
+        for (int i = 0; i < mapWidth; ++i) {
+            const int coverage = map[i];
+            if (coverage == 0) {
+                continue;
+            } else if (coverage == 255 && opaque) {
+                dest[i] = color;
+            } else {
+                const uint s = (coverage == 255 ? color : BYTE_MUL(color, coverage));
+                dest[i] = s + BYTE_MUL(dest[i], qAlpha(~s));
+            }
+        }
+        dest += destStride;
+        map += mapStride;
+    }
+}
 
 // Map table for destination image format. Contains function pointers
 // for blends of various types unto the destination
@@ -2850,42 +2875,48 @@ inline static void qt_rectfill_nonpremul_quint32(QRasterBuffer *rasterBuffer,
 DrawHelper qDrawHelper[QImage::NImageFormats] =
 {
     // Format_Invalid,
-    { 0, 0, 0 },
+    { 0, 0, 0, 0 },
     // Format_Mono,
     {
         blend_color_generic,
         blend_src_generic,
+        0,
         0
     },
     // Format_MonoLSB,
     {
         blend_color_generic,
         blend_src_generic,
+        0,
         0
     },
     // Format_RGB32,
     {
         blend_color_generic,
         qt_gradient_quint32,
-        qt_rectfill_quint32
+        qt_rectfill_quint32,
+        qt_alphamapblit_quint32
     },
     // Format_ARGB32,
     {
         blend_color_generic,
         qt_gradient_quint32,
-        qt_rectfill_nonpremul_quint32
+        qt_rectfill_nonpremul_quint32,
+        0
     },
     // Format_ARGB32_Premultiplied
     {
         blend_color_generic,
         qt_gradient_quint32,
-        qt_rectfill_quint32
+        qt_rectfill_quint32,
+        qt_alphamapblit_quint32
     },
     // Format_RGB16
     {
         blend_color_generic,
         qt_gradient_quint16,
-        qt_rectfill_quint16
+        qt_rectfill_quint16,
+        0
     }
 };
 
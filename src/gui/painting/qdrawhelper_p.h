@@ -99,10 +99,16 @@ typedef void (*RectFillFunc)(QRasterBuffer *rasterBuffer,
                              int x, int y, int width, int height,
                              quint32 color);
 
+typedef void (*AlphamapBlitFunc)(QRasterBuffer *rasterBuffer,
+                                 int x, int y, quint32 color,
+                                 const uchar *map,
+                                 int mapWidth, int mapHeight, int mapStride);
+
 struct DrawHelper {
     ProcessSpans blendColor;
     ProcessSpans blendGradient;
     RectFillFunc fillRect;
+    AlphamapBlitFunc alphamapBlit;
 };
 
 extern DrawHelper qDrawHelper[QImage::NImageFormats];
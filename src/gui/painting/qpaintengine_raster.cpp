@@ -31,6 +31,7 @@
 #include "qimage_p.h"
 #include "qpaintengine_raster_p.h"
 #include "qoutlinemapper_p.h"
+#include "qfontengine_ft_p.h"
 #include "qguicommon_p.h"
 #include "qcorecommon_p.h"
 
@@ -1873,9 +1874,135 @@ void QRasterPaintEngine::drawTextItem(const QPointF &p, const QTextItem &textIte
     ensurePen();
     ensureRasterState();
 
+    const QRasterPaintEngineState *s = state();
+    if (ti.fontEngine->type() == QFontEngine::Freetype
+        && s->matrix.type() <= QTransform::TxTranslate
+        && (s->renderHints & QPainter::TextAntialiasing)
+        && !(painter()->font().hintingPreference() & QFont::PreferNoHinting)) {
+        drawCachedGlyphs(p, ti);
+        return;
+    }
+
     QPaintEngineEx::drawTextItem(p, ti);
 }
 
+static void qt_alphamap_spans(int x, int y, const uchar *map,
+                              int mapWidth, int mapHeight, int mapStride,
+                              QSpanData *data)
+{
+    const int spanCount = 256;
+    QSTACKARRAY(QT_FT_Span, spans, spanCount);
+    int n = 0;
+
+    for (int row = 0; row < mapHeight; ++row) {
+        int i = 0;
+        while (i < mapWidth) {
+            const int coverage = map[i];
+            if (coverage == 0) {
+                ++i;
+                continue;
+            }
+            int len = 1;
+            while (i + len < mapWidth && map[i + len] == coverage)
+                ++len;
+            spans[n].x = x + i;
+            spans[n].y = y + row;
+            spans[n].len = len;
+            spans[n].coverage = coverage;
+            i += len;
+            ++n;
+            if (n == spanCount) {
+                data->blend(n, spans, data);
+                n = 0;
+            }
+        }
+        map += mapStride;
+    }
+    if (n) {
+        data->blend(n, spans, data);
+    }
+}
+
+/*!
+    \internal
+
+    Draws untransformed anti-aliased text from the coverage masks cached by
+    the font engine instead of filling the glyph outlines.
+*/
+void QRasterPaintEngine::drawCachedGlyphs(const QPointF &p, const QTextItemInt &ti)
+{
+    Q_D(QRasterPaintEngine);
+    QRasterPaintEngineState *s = state();
+    if (!s->penData.blend || !ti.glyphs.numGlyphs)
+        return;
+
+    QStdVector<QFixedPoint> positions(ti.glyphs.numGlyphs);
+    QStdVector<glyph_t> glyphs(ti.glyphs.numGlyphs);
+    ti.fontEngine->getGlyphPositions(ti.glyphs, p, glyphs, positions);
+
+    const QClipData *clip = d->clip();
+    QRect clipRect = d->deviceRect;
+    if (clip && clip->hasRectClip)
+        clipRect &= clip->clipRect;
+
+    AlphamapBlitFunc alphamapBlit = d->rasterBuffer->drawHelper->alphamapBlit;
+    if ((clip && !clip->hasRectClip)
+        || s->penData.type != QSpanData::Solid
+        || d->rasterBuffer->compositionMode != QPainter::CompositionMode_SourceOver) {
+        alphamapBlit = 0;
+    }
+
+    const QFixed dx = QFixed::fromReal(s->matrix.dx());
+    const QFixed dy = QFixed::fromReal(s->matrix.dy());
+    const int stride = QFontEngineFT::GlyphAtlasWidth;
+    QFontEngineFT *fe = static_cast<QFontEngineFT *>(ti.fontEngine);
+    QPainterPath path;
+    for (int i = 0; i < glyphs.size(); ++i) {
+        const QFixed gx = positions[i].x + dx;
+        const int subpixel = ((gx.value() & 63) * QFontEngineFT::GlyphSubpixelPositions) >> 6;
+        const QGlyphMask *mask = fe->glyphMask(glyphs[i], subpixel);
+        if (!mask) {
+            // too big for the atlas
+            fe->addGlyphsToPath(&glyphs[i], &positions[i], 1, &path);
+            continue;
+        }
+
+        int x = (gx.value() >> 6) + mask->left;
+        int y = (positions[i].y + dy).toInt() - mask->top;
+        int w = mask->width;
+        int h = mask->height;
+        const uchar *map = fe->glyphAtlas() + mask->offset;
+        if (x < clipRect.left()) {
+            map += clipRect.left() - x;
+            w -= clipRect.left() - x;
+            x = clipRect.left();
+        }
+        if (y < clipRect.top()) {
+            map += (clipRect.top() - y) * stride;
+            h -= clipRect.top() - y;
+            y = clipRect.top();
+        }
+        w = qMin(w, clipRect.right() + 1 - x);
+        h = qMin(h, clipRect.bottom() + 1 - y);
+        if (w <= 0 || h <= 0)
+            continue;
+
+        if (alphamapBlit)
+            alphamapBlit(d->rasterBuffer.data(), x, y, s->penData.solid.color, map, w, h, stride);
+        else
+            qt_alphamap_spans(x, y, map, w, h, stride, &s->penData);
+    }
+
+    if (!path.isEmpty()) {
+        const QBrush brush = s->pen.brush();
+        path.setFillRule(Qt::WindingFill);
+        painter()->save();
+        painter()->setRenderHint(QPainter::Antialiasing, true);
+        painter()->fillPath(path, brush);
+        painter()->restore();
+    }
+}
+
 /*!
     \reimp
 */
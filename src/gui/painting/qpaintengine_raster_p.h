@@ -172,6 +172,7 @@ private:
     void fillPath(const QPainterPath &path, QSpanData *fillData);
     void fillPolygon(const QPointF *points, int pointCount, PolygonDrawMode mode);
     void drawBitmap(const QPointF &pos, const QImage &image, QSpanData *fill);
+    void drawCachedGlyphs(const QPointF &p, const QTextItemInt &ti);
 
     bool setClipRectInDeviceCoords(const QRect &r, Qt::ClipOperation op);
 
@@ -41,6 +41,10 @@ QFontEngine::QFontEngine()
     fsType = 0;
 }
 
+QFontEngine::~QFontEngine()
+{
+}
+
 QFixed QFontEngine::lineThickness() const
 {
     // ad hoc algorithm
@@ -168,7 +168,10 @@ QFontEngineFT::QFontEngineFT(const QFontDef &fd, FcPattern *pattern)
     ysize(0),
     line_thickness(QFixed::fromFixed(1)),
     underline_position(QFixed::fromReal(0.8)),
-    kerning_pairs_loaded(false)
+    kerning_pairs_loaded(false),
+    atlasx(0),
+    atlasy(0),
+    shelfheight(0)
 {
     fontDef = fd;
 
@@ -200,7 +203,10 @@ QFontEngineFT::QFontEngineFT(const QFontDef &fd)
     ysize(0),
     line_thickness(QFixed::fromFixed(1)),
     underline_position(QFixed::fromReal(0.8)),
-    kerning_pairs_loaded(false)
+    kerning_pairs_loaded(false),
+    atlasx(0),
+    atlasy(0),
+    shelfheight(0)
 {
     fontDef = fd;
 
@@ -316,6 +322,80 @@ QFontGlyph* QFontEngineFT::getGlyph(glyph_t glyph) const
     return gcache;
 }
 
+// masks are packed in shelves of the atlas, once it is full all masks are dropped and packing
+// starts over so the returned mask is valid only until the next call
+const QGlyphMask* QFontEngineFT::glyphMask(glyph_t glyph, int subpixel) const
+{
+    const quint64 key = ((quint64(glyph) << 2) | subpixel);
+    MaskCache::const_iterator iter = maskcache.find(key);
+    if (iter != maskcache.end()) {
+        return &iter->second;
+    }
+
+    QFontGlyph* gcache = getGlyph(glyph);
+    Q_ASSERT(gcache);
+
+    FT_Outline *outline = &gcache->outline;
+    const FT_Pos shift = (subpixel * (64 / GlyphSubpixelPositions));
+    FT_Outline_Translate(outline, shift, 0);
+
+    FT_BBox cbox;
+    FT_Outline_Get_CBox(outline, &cbox);
+    const FT_Pos xmin = FLOOR(cbox.xMin);
+    const FT_Pos ymin = FLOOR(cbox.yMin);
+
+    QGlyphMask mask;
+    mask.left = TRUNC(xmin);
+    mask.top = TRUNC(CEIL(cbox.yMax));
+    mask.width = TRUNC(CEIL(cbox.xMax) - xmin);
+    mask.height = TRUNC(CEIL(cbox.yMax) - ymin);
+    mask.offset = 0;
+
+    if (Q_UNLIKELY(mask.width > GlyphAtlasWidth || mask.height > (GlyphAtlasHeight / 8))) {
+        FT_Outline_Translate(outline, -shift, 0);
+        return nullptr;
+    }
+
+    if (mask.width > 0 && mask.height > 0) {
+        if (atlasx + mask.width > GlyphAtlasWidth) {
+            atlasx = 0;
+            atlasy += shelfheight;
+            shelfheight = 0;
+        }
+        if (atlasy + mask.height > GlyphAtlasHeight) {
+            maskcache.clear();
+            atlas.clear();
+            atlasx = 0;
+            atlasy = 0;
+            shelfheight = 0;
+        }
+        shelfheight = qMax(shelfheight, mask.height);
+        const int atlassize = ((atlasy + shelfheight) * GlyphAtlasWidth);
+        if (atlas.size() < atlassize) {
+            atlas.resize(atlassize);
+        }
+        mask.offset = (atlasy * GlyphAtlasWidth + atlasx);
+        atlasx += mask.width;
+
+        // the atlas is zero-filled so the outline can be rendered in place
+        FT_Bitmap bitmap;
+        ::memset(&bitmap, 0, sizeof(FT_Bitmap));
+        bitmap.rows = mask.height;
+        bitmap.width = mask.width;
+        bitmap.pitch = GlyphAtlasWidth;
+        bitmap.buffer = atlas.data() + mask.offset;
+        bitmap.num_grays = 256;
+        bitmap.pixel_mode = FT_PIXEL_MODE_GRAY;
+
+        FT_Outline_Translate(outline, -xmin, -ymin);
+        FT_Outline_Get_Bitmap(freetype->library, outline, &bitmap);
+        FT_Outline_Translate(outline, xmin, ymin);
+    }
+    FT_Outline_Translate(outline, -shift, 0);
+
+    return &(maskcache.insert({key, mask}).first->second);
+}
+
 QFontEngine::FaceId QFontEngineFT::faceId() const
 {
     return face_id;
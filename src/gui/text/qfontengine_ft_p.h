@@ -59,6 +59,14 @@ struct QFontGlyph {
     FT_Outline outline;
 };
 
+struct QGlyphMask {
+    int left;
+    int top;
+    int width;
+    int height;
+    int offset;
+};
+
 /*
  * This struct represents one font file on disk.
  */
@@ -135,6 +143,14 @@ public:
 
     inline bool invalid() const { return xsize == 0 && ysize == 0; }
 
+    enum {
+        GlyphSubpixelPositions = 4,
+        GlyphAtlasWidth = 256,
+        GlyphAtlasHeight = 4096
+    };
+    const QGlyphMask* glyphMask(glyph_t glyph, int subpixel) const;
+    inline const uchar* glyphAtlas() const { return atlas.data(); }
+
 protected:
     int default_load_flags;
 
@@ -161,6 +177,13 @@ private:
 
     typedef QStdMap<glyph_t, QFontGlyph*> GlyphCache;
     mutable GlyphCache glyphcache;
+
+    typedef QStdMap<quint64, QGlyphMask> MaskCache;
+    mutable MaskCache maskcache;
+    mutable QStdVector<uchar> atlas;
+    mutable int atlasx;
+    mutable int atlasy;
+    mutable int shelfheight;
 };
 
 
@@ -66,6 +66,7 @@ public:
     };
 
     QFontEngine();
+    virtual ~QFontEngine();
 
     // all of these are in unscaled metrics if the engine supports uncsaled metrics,
     // otherwise in design metrics
@@ -21,6 +21,7 @@
 #include "qtextdocumentwriter.h"
 
 #include <QtCore/qfile.h>
+#include <QtCore/qsavefile.h>
 #include <QtCore/qbytearray.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qtextcodec.h>
@@ -37,6 +38,8 @@ class QTextDocumentWriterPrivate
 public:
     QTextDocumentWriterPrivate();
 
+    bool closeDevice();
+
     // device
     QByteArray format;
     QIODevice *device;
@@ -85,6 +88,20 @@ QTextDocumentWriterPrivate::QTextDocumentWriterPrivate()
 {
 }
 
+/*!
+    \internal
+*/
+bool QTextDocumentWriterPrivate::closeDevice()
+{
+    // the file set by name is replaced once it is complete
+    if (deleteDevice) {
+        if (QSaveFile *savefile = qobject_cast<QSaveFile *>(device))
+            return savefile->commit();
+    }
+    device->close();
+    return true;
+}
+
 /*!
     Constructs an empty QTextDocumentWriter object. Before writing, you must
     call setFormat() to set a document format, then setDevice() or
@@ -115,8 +132,7 @@ QTextDocumentWriter::QTextDocumentWriter(QIODevice *device, const QByteArray &fo
 QTextDocumentWriter::QTextDocumentWriter(const QString &fileName, const QByteArray &format)
     : d(new QTextDocumentWriterPrivate())
 {
-    QFile *file = new QFile(fileName);
-    d->device = file;
+    d->device = new QSaveFile(fileName);
     d->deleteDevice = true;
     d->format = format;
 }
@@ -191,14 +207,15 @@ QIODevice *QTextDocumentWriter::device() const
 
 /*!
     Sets the name of the file to be written to \a fileName. Internally,
-    QTextDocumentWriter will create a QFile and open it in \l
+    QTextDocumentWriter will create a QSaveFile and open it in \l
     QIODevice::WriteOnly mode, and use this file when writing the document.
+    The file is replaced only once the whole document has been written.
 
     \sa fileName(), setDevice()
 */
 void QTextDocumentWriter::setFileName(const QString &fileName)
 {
-    setDevice(new QFile(fileName));
+    setDevice(new QSaveFile(fileName));
     d->deleteDevice = true;
 }
 
@@ -243,8 +260,7 @@ bool QTextDocumentWriter::write(const QTextDocument *document)
         ts.setCodec(d->codec);
         ts << document->toHtml(d->codec->name());
 #endif
-        d->device->close();
-        return true;
+        return d->closeDevice();
     }
 #endif
     if (format == "txt" || format == "plaintext") {
@@ -257,8 +273,7 @@ bool QTextDocumentWriter::write(const QTextDocument *document)
         ts.setCodec(d->codec);
 #endif
         ts << document->toPlainText();
-        d->device->close();
-        return true;
+        return d->closeDevice();
     }
 
     return false;
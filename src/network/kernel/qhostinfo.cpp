@@ -29,7 +29,13 @@ QT_BEGIN_NAMESPACE
 
 // #define QHOSTINFO_DEBUG
 
+// lookups are done in a small number of threads, getaddrinfo() is blocking
+static const int QHOSTINFO_MAX_THREADS = 4;
+
 Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
+Q_GLOBAL_STATIC(QHostInfoLookupManager, globalHostInfoLookupManager)
+
+static QAtomicInt qt_qhostinfo_lookup_id(0);
 
 /*!
     \class QHostInfo
@@ -42,7 +48,14 @@ Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
     QHostInfo uses the lookup mechanisms provided by the operating
     system to find the IP address(es) associated with a host name,
     or the host name associated with an IP address. The class
-    provides static method that blocks and returns a QHostInfo object.
+    provides two static convenience functions: one that works
+    asynchronously and emits a signal once the host is found, and
+    one that blocks and returns a QHostInfo object.
+
+    To look up a host's IP addresses asynchronously, call lookupHost(),
+    which takes the host name or IP address, a receiver object, and a slot
+    signature as arguments and returns an ID. You can abort the
+    lookup by calling abortHostLookup() with the lookup ID.
 
     Call addresses() to get the list of IP addresses for the host, and
     hostName() to get the host name that was looked up.
@@ -51,8 +64,7 @@ Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
     occurred. errorString() gives a human-readable description of the
     lookup error.
 
-    If you want a non-blocking lookup, use the QHostInfo::fromName()
-    in a thread.
+    If you want a blocking lookup, use the QHostInfo::fromName() function.
 
     QHostInfo supports Internationalized Domain Names (IDNs) through the
     IDNA and Punycode standards.
@@ -62,11 +74,94 @@ Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
 
     \note Since 4.6.3 QHostInfo is using a small internal 60 second DNS cache
     for performance improvements.
-    \note Since 4.9.0 QHostInfo is not using multiple threads for DNS lookup.
+    \note Since 4.12 asynchronous lookups are done by a pool of up to 4
+    threads shared by the whole application, the cache is shared with
+    fromName().
 
     \sa QAbstractSocket, {http://www.rfc-editor.org/rfc/rfc3492.txt}{RFC 3492}
 */
 
+/*!
+    Looks up the IP address(es) associated with host name \a name, and
+    returns an ID for the lookup. When the result of the lookup is
+    ready, the slot or signal \a member in \a receiver is called with
+    a QHostInfo argument. The QHostInfo object can then be inspected
+    to get the results of the lookup.
+
+    The lookup is performed in a worker thread and the result is
+    delivered through the event loop of the calling thread, which must
+    be running for the result to arrive. Results found in the cache are
+    delivered the same way.
+
+    If you pass a literal IP address to \a name instead of a host name,
+    QHostInfo will search for the domain name for the IP (i.e., QHostInfo will
+    perform a \e reverse lookup). On success, the resulting QHostInfo will
+    contain both the resolved domain name and IP addresses for the host
+    name.
+
+    \since 4.12
+    \sa abortHostLookup(), addresses(), error(), fromName()
+*/
+int QHostInfo::lookupHost(const QString &name, QObject *receiver, const char *member)
+{
+#ifdef QHOSTINFO_DEBUG
+    qDebug("QHostInfo::lookupHost(\"%s\", %p, %s)",
+           name.toLatin1().constData(), receiver, member ? member + 1 : 0);
+#endif
+
+    if (Q_UNLIKELY(!receiver || !member)) {
+        qWarning("QHostInfo::lookupHost: receiver or member is null");
+        return -1;
+    }
+
+    QHostInfoLookupManager* manager = globalHostInfoLookupManager();
+    if (Q_UNLIKELY(!manager)) {
+        // application is shutting down
+        return -1;
+    }
+
+    const int id = qt_qhostinfo_lookup_id.fetchAndAddRelaxed(1) + 1;
+    QHostInfoResult *result = new QHostInfoResult(id);
+    QObject::connect(result, SIGNAL(resultsReady(QHostInfo)), receiver, member);
+
+    if (name.isEmpty()) {
+        QHostInfo info(id);
+        info.d->err = QHostInfo::HostNotFound;
+        info.d->errorStr = QCoreApplication::translate("QHostInfo", "No host name given");
+        manager->postResult(result, info);
+        return id;
+    }
+
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache && cache->isEnabled()) {
+        bool valid = false;
+        QHostInfo info = cache->get(name, &valid);
+        if (valid) {
+            info.d->lookupId = id;
+            manager->postResult(result, info);
+            return id;
+        }
+    }
+
+    manager->scheduleLookup(name, result, id);
+    return id;
+}
+
+/*!
+    Aborts the host lookup with the ID \a lookupId, as returned by
+    lookupHost(). The receiver will not be called for it.
+
+    \since 4.12
+    \sa lookupHost(), lookupId()
+*/
+void QHostInfo::abortHostLookup(int lookupId)
+{
+    QHostInfoLookupManager* manager = globalHostInfoLookupManager();
+    if (manager) {
+        manager->abortLookup(lookupId);
+    }
+}
+
 /*!
     Looks up the IP address(es) for the given host \a name. The
     method blocks during the lookup which means that execution of
@@ -116,13 +211,14 @@ QHostInfo QHostInfo::fromName(const QString &name)
 */
 
 /*!
-    Constructs an empty host info object.
+    Constructs an empty host info object with lookup ID \a lookupId.
 
     \sa lookupId()
 */
-QHostInfo::QHostInfo()
+QHostInfo::QHostInfo(int lookupId)
     : d(new QHostInfoPrivate())
 {
+    d->lookupId = lookupId;
 }
 
 /*!
@@ -135,6 +231,7 @@ QHostInfo::QHostInfo(const QHostInfo &other)
     d->errorStr = other.d->errorStr;
     d->addrs = other.d->addrs;
     d->hostName = other.d->hostName;
+    d->lookupId = other.d->lookupId;
 }
 
 /*!
@@ -147,6 +244,7 @@ QHostInfo &QHostInfo::operator=(const QHostInfo &other)
     d->errorStr = other.d->errorStr;
     d->addrs = other.d->addrs;
     d->hostName = other.d->hostName;
+    d->lookupId = other.d->lookupId;
     return *this;
 }
 
@@ -205,6 +303,17 @@ QString QHostInfo::errorString() const
     return d->errorStr;
 }
 
+/*!
+    Returns the ID of this lookup.
+
+    \since 4.12
+    \sa lookupHost()
+*/
+int QHostInfo::lookupId() const
+{
+    return d->lookupId;
+}
+
 /*!
     \fn QString QHostInfo::localHostName()
 
@@ -224,6 +333,26 @@ QString QHostInfo::errorString() const
     \sa hostName()
 */
 
+// Returns the cached result right away if there is one, otherwise starts an
+// asynchronous lookup and returns its ID in id
+QHostInfo qt_qhostinfo_lookup(const QString &name, QObject *receiver, const char *member,
+                              bool *valid, int *id)
+{
+    *valid = false;
+    *id = -1;
+
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache && cache->isEnabled()) {
+        QHostInfo info = cache->get(name, valid);
+        if (*valid) {
+            return info;
+        }
+    }
+
+    *id = QHostInfo::lookupHost(name, receiver, member);
+    return QHostInfo();
+}
+
 void qt_qhostinfo_clear_cache()
 {
     QHostInfoCache* cache = globalHostInfoCache();
@@ -264,6 +393,7 @@ void QHostInfoCache::setEnabled(bool e)
 QHostInfo QHostInfoCache::get(const QString &name, bool *valid) const
 {
     *valid = false;
+    QMutexLocker locker(&this->mutex);
     QHostInfoCacheElement *element = cache.object(name);
     if (element && element->age.elapsed() < 60000) {
         *valid = true;
@@ -293,4 +423,124 @@ void QHostInfoCache::clear()
     cache.clear();
 }
 
+QHostInfoResult::QHostInfoResult(int lookupId)
+    : id(lookupId)
+{
+}
+
+void QHostInfoResult::emitResultsReady(const QHostInfo &info)
+{
+    QHostInfoLookupManager* manager = globalHostInfoLookupManager();
+    if (!manager || !manager->takeAborted(id)) {
+        emit resultsReady(info);
+    }
+    deleteLater();
+}
+
+QHostInfoLookupThread::QHostInfoLookupThread(QHostInfoLookupManager *manager)
+    : manager(manager)
+{
+}
+
+void QHostInfoLookupThread::run()
+{
+    QMutexLocker locker(&manager->mutex);
+    while (true) {
+        while (manager->queue.isEmpty() && !manager->quit) {
+            manager->condition.wait(&manager->mutex);
+        }
+        if (manager->quit) {
+            return;
+        }
+
+        const QHostInfoLookupManager::QHostInfoLookup lookup = manager->queue.takeFirst();
+        manager->idlethreads--;
+        locker.unlock();
+
+#ifdef QHOSTINFO_DEBUG
+        qDebug("QHostInfoLookupThread::run() looking up \"%s\" for %d",
+               lookup.name.toLatin1().constData(), lookup.id);
+#endif
+        QHostInfo info = QHostInfo::fromName(lookup.name);
+        info.d->lookupId = lookup.id;
+        QMetaObject::invokeMethod(lookup.result, "emitResultsReady",
+                                  Qt::QueuedConnection, Q_ARG(QHostInfo, info));
+
+        locker.relock();
+        manager->idlethreads++;
+    }
+}
+
+QHostInfoLookupManager::QHostInfoLookupManager()
+    : idlethreads(0),
+    quit(false)
+{
+    qRegisterMetaType<QHostInfo>();
+}
+
+QHostInfoLookupManager::~QHostInfoLookupManager()
+{
+    {
+        QMutexLocker locker(&mutex);
+        quit = true;
+        condition.wakeAll();
+    }
+    foreach (QHostInfoLookupThread *thread, threads) {
+        thread->wait();
+        delete thread;
+    }
+}
+
+void QHostInfoLookupManager::scheduleLookup(const QString &name, QHostInfoResult *result, int id)
+{
+    QMutexLocker locker(&mutex);
+    const QHostInfoLookup lookup = { id, name, result };
+    queue.append(lookup);
+    pending.append(id);
+    if (idlethreads < queue.size() && threads.size() < QHOSTINFO_MAX_THREADS) {
+        QHostInfoLookupThread *thread = new QHostInfoLookupThread(this);
+        threads.append(thread);
+        idlethreads++;
+        thread->start();
+    }
+    condition.wakeOne();
+}
+
+void QHostInfoLookupManager::postResult(QHostInfoResult *result, const QHostInfo &info)
+{
+    {
+        QMutexLocker locker(&mutex);
+        pending.append(info.lookupId());
+    }
+    QMetaObject::invokeMethod(result, "emitResultsReady",
+                              Qt::QueuedConnection, Q_ARG(QHostInfo, info));
+}
+
+void QHostInfoLookupManager::abortLookup(int id)
+{
+    QMutexLocker locker(&mutex);
+    for (int i = 0; i < queue.size(); i++) {
+        if (queue.at(i).id == id) {
+            // not started yet
+            queue.at(i).result->deleteLater();
+            queue.removeAt(i);
+            pending.removeOne(id);
+            return;
+        }
+    }
+    // the result is delivered but not emitted
+    if (pending.contains(id) && !aborted.contains(id)) {
+        aborted.append(id);
+    }
+}
+
+bool QHostInfoLookupManager::takeAborted(int id)
+{
+    QMutexLocker locker(&mutex);
+    pending.removeOne(id);
+    return aborted.removeOne(id);
+}
+
 QT_END_NAMESPACE
+
+#include "moc_qhostinfo_p.h"
@@ -23,12 +23,14 @@
 #define QHOSTINFO_H
 
 #include <QtCore/qlist.h>
+#include <QtCore/qmetatype.h>
 #include <QtNetwork/qhostaddress.h>
 
 
 QT_BEGIN_NAMESPACE
 
 
+class QObject;
 class QHostInfoPrivate;
 
 class Q_NETWORK_EXPORT QHostInfo
@@ -40,7 +42,7 @@ public:
         UnknownError
     };
 
-    QHostInfo();
+    QHostInfo(int lookupId = -1);
     QHostInfo(const QHostInfo &d);
     QHostInfo &operator=(const QHostInfo &d);
     ~QHostInfo();
@@ -52,17 +54,25 @@ public:
 
     QString errorString() const;
 
+    int lookupId() const;
+
+    static int lookupHost(const QString &name, QObject *receiver, const char *member);
+    static void abortHostLookup(int lookupId);
+
     static QHostInfo fromName(const QString &name);
     static QString localHostName();
     static QString localDomainName();
 
 private:
     friend class QHostInfoPrivate;
+    friend class QHostInfoLookupThread;
     friend class QAbstractSocket;
     QHostInfoPrivate* d;
 };
 
 QT_END_NAMESPACE
 
+Q_DECLARE_METATYPE(QHostInfo);
+
 
 #endif // QHOSTINFO_H
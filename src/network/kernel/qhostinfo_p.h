@@ -40,6 +40,8 @@
 #include "QtCore/qobject.h"
 #include "QtCore/qpointer.h"
 #include "QtCore/qlist.h"
+#include "QtCore/qthread.h"
+#include "QtCore/qwaitcondition.h"
 #include <QElapsedTimer>
 #include <QCache>
 
@@ -50,7 +52,8 @@ class QHostInfoPrivate
 public:
     inline QHostInfoPrivate()
         : err(QHostInfo::HostNotFound),
-          errorStr(QLatin1String(QT_TRANSLATE_NOOP("QHostInfo", "Host not found")))
+          errorStr(QLatin1String(QT_TRANSLATE_NOOP("QHostInfo", "Host not found"))),
+          lookupId(-1)
     {
     }
 
@@ -60,13 +63,77 @@ public:
     QString errorStr;
     QList<QHostAddress> addrs;
     QString hostName;
+    int lookupId;
 };
 
 // These functions are outside of the QHostInfo class and strictly internal.
 // Do NOT use them outside of QAbstractSocket.
+QHostInfo Q_NETWORK_EXPORT qt_qhostinfo_lookup(const QString &name, QObject *receiver, const char *member,
+                                               bool *valid, int *id);
 void Q_AUTOTEST_EXPORT qt_qhostinfo_clear_cache();
 void Q_AUTOTEST_EXPORT qt_qhostinfo_enable_cache(bool e);
 
+// Lives in the thread that started the lookup, the result is delivered to it
+// from the lookup thread with a queued call
+class QHostInfoResult : public QObject
+{
+    Q_OBJECT
+public:
+    QHostInfoResult(int lookupId);
+
+public Q_SLOTS:
+    void emitResultsReady(const QHostInfo &info);
+
+Q_SIGNALS:
+    void resultsReady(const QHostInfo &info);
+
+private:
+    int id;
+};
+
+class QHostInfoLookupManager;
+
+class QHostInfoLookupThread : public QThread
+{
+public:
+    QHostInfoLookupThread(QHostInfoLookupManager *manager);
+
+    void run();
+
+private:
+    QHostInfoLookupManager *manager;
+};
+
+class QHostInfoLookupManager
+{
+public:
+    QHostInfoLookupManager();
+    ~QHostInfoLookupManager();
+
+    void scheduleLookup(const QString &name, QHostInfoResult *result, int id);
+    void postResult(QHostInfoResult *result, const QHostInfo &info);
+    void abortLookup(int id);
+    bool takeAborted(int id);
+
+private:
+    friend class QHostInfoLookupThread;
+
+    struct QHostInfoLookup {
+        int id;
+        QString name;
+        QHostInfoResult *result;
+    };
+
+    QMutex mutex;
+    QWaitCondition condition;
+    QList<QHostInfoLookup> queue;
+    QList<int> pending;
+    QList<int> aborted;
+    QList<QHostInfoLookupThread*> threads;
+    int idlethreads;
+    bool quit;
+};
+
 class QHostInfoCache
 {
 public:
@@ -85,7 +152,7 @@ private:
         QElapsedTimer age;
     };
     QCache<QString,QHostInfoCacheElement> cache;
-    QMutex mutex;
+    mutable QMutex mutex;
 };
 
 QT_END_NAMESPACE
@@ -345,6 +345,7 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
       closeCalled(false),
       pendingClose(false),
       port(0),
+      hostLookupId(-1),
       localPort(0),
       peerPort(0),
       socketEngine(0),
@@ -381,6 +382,11 @@ void QAbstractSocketPrivate::resetSocketLayer()
     qDebug("QAbstractSocketPrivate::resetSocketLayer()");
 #endif
 
+    if (hostLookupId != -1) {
+        QHostInfo::abortHostLookup(hostLookupId);
+        hostLookupId = -1;
+    }
+
     if (socketEngine) {
         socketEngine->close();
         socketEngine->disconnect();
@@ -653,6 +659,13 @@ void QAbstractSocketPrivate::_q_startConnecting(const QHostInfo &hostInfo)
         return;
     }
 
+    if (Q_UNLIKELY(hostLookupId != -1 && hostLookupId != hostInfo.lookupId())) {
+        qWarning("QAbstractSocketPrivate::_q_startConnecting() received hostInfo for wrong lookup ID %d expected %d",
+                 hostInfo.lookupId(), hostLookupId);
+        return;
+    }
+    hostLookupId = -1;
+
     addresses = hostInfo.addresses();
 
 #if defined(QABSTRACTSOCKET_DEBUG)
@@ -1086,9 +1099,15 @@ void QAbstractSocket::connectToHost(const QString &hostName, quint16 port,
         info.d->errorStr = QCoreApplication::translate("QHostInfo", "Unknown error");
         info.d->addrs.append(temp);
         d->_q_startConnecting(info);
-    } else {
-        if (d->threadData->eventDispatcher) {
-            d->_q_startConnecting(QHostInfo::fromName(hostName));
+    } else if (d->threadData->eventDispatcher) {
+        // a cached result is used right away, otherwise the lookup does not block and
+        // _q_startConnecting() is called from the event loop once it is done
+        bool immediateResultValid = false;
+        QHostInfo hostInfo = qt_qhostinfo_lookup(hostName, this, SLOT(_q_startConnecting(QHostInfo)),
+                                                 &immediateResultValid, &d->hostLookupId);
+        if (immediateResultValid) {
+            d->hostLookupId = -1;
+            d->_q_startConnecting(hostInfo);
         }
     }
 
@@ -1393,6 +1412,8 @@ bool QAbstractSocket::waitForConnected(int msecs)
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug("QAbstractSocket::waitForConnected(%i) doing host name lookup", msecs);
 #endif
+        QHostInfo::abortHostLookup(d->hostLookupId);
+        d->hostLookupId = -1;
         d->_q_startConnecting(QHostInfo::fromName(d->hostName));
     }
     if (state() == UnconnectedState)
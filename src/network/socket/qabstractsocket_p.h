@@ -82,6 +82,7 @@ public:
     quint16 port;
     QHostAddress host;
     QList<QHostAddress> addresses;
+    int hostLookupId;
 
     quint16 localPort;
     quint16 peerPort;
@@ -102,7 +102,19 @@ QSvgTinyDocument * QSvgTinyDocument::load(const QString &fileName)
         return nullptr;
     }
 
-    return load(file.readAll());
+    const qint64 filesize = file.size();
+    uchar *filedata = nullptr;
+    if (filesize > 0) {
+        filedata = file.map(0, filesize, QFile::MapSequentialHint);
+    }
+    if (!filedata) {
+        return load(file.readAll());
+    }
+    // the document does not reference the contents once it is loaded
+    QSvgTinyDocument *doc = load(QByteArray::fromRawData(
+        reinterpret_cast<const char*>(filedata), filesize));
+    file.unmap(filedata);
+    return doc;
 }
 
 QSvgTinyDocument * QSvgTinyDocument::load(const QByteArray &contents)
@@ -52,6 +52,29 @@ static bool isVariantType(const char* type)
 /*!
   Returns true if the type is qreal.
 */
+static QByteArray methodSignature(const FunctionDef &f)
+{
+    QByteArray sig = f.name + '(';
+    for (int j = 0; j < f.arguments.count(); ++j) {
+        if (j)
+            sig += ",";
+        sig += f.arguments.at(j).normalizedType;
+    }
+    sig += ')';
+    return sig;
+}
+
+// hash table of at most half load, the lookup probes until an empty slot
+static int methodHashSize(int methodCount)
+{
+    if (methodCount == 0)
+        return 0;
+    int size = 2;
+    while (size < methodCount * 2)
+        size *= 2;
+    return size;
+}
+
 static bool isQRealType(const char *type)
 {
     return strcmp(type, "qreal") == 0;
@@ -142,10 +165,10 @@ void Generator::generateCode()
     QByteArray qualifiedClassNameIdentifier = cdef->qualified;
     qualifiedClassNameIdentifier.replace(':', '_');
 
-    int index = 14;
+    int index = 16;
     fprintf(out, "static const uint qt_meta_data_%s[] = {\n", qualifiedClassNameIdentifier.constData());
     fprintf(out, "\n // content:\n");
-    fprintf(out, "    %4d,       // revision\n", 6);
+    fprintf(out, "    %4d,       // revision\n", 7);
     fprintf(out, "    %4d,       // classname\n", strreg(cdef->qualified.constData()));
     fprintf(out, "    %4d, %4d, // classinfo\n", cdef->classInfoList.count(), cdef->classInfoList.count() ? index : 0);
     index += cdef->classInfoList.count() * 2;
@@ -164,9 +187,13 @@ void Generator::generateCode()
         index += 4 + (cdef->enumList.at(i).values.count() * 2);
     fprintf(out, "    %4d, %4d, // constructors\n", isConstructible ? cdef->constructorList.count() : 0,
             isConstructible ? index : 0);
+    if (isConstructible)
+        index += cdef->constructorList.count() * 5;
 
     fprintf(out, "    %4d,       // flags\n", 0);
     fprintf(out, "    %4d,       // signalCount\n", cdef->signalList.count());
+    const int hashSize = methodHashSize(methodCount);
+    fprintf(out, "    %4d, %4d, // method hash\n", hashSize, hashSize ? index : 0);
 
 
 //
@@ -205,6 +232,11 @@ void Generator::generateCode()
     if (isConstructible)
         generateFunctions(cdef->constructorList, "constructor", MethodConstructor);
 
+//
+// Build method hash array
+//
+    generateMethodHash(hashSize);
+
 //
 // Terminate data array
 //
@@ -397,19 +429,14 @@ void Generator::generateFunctions(QList<FunctionDef>& list, const char *functype
     for (int i = 0; i < list.count(); ++i) {
         const FunctionDef &f = list.at(i);
 
-        QByteArray sig = f.name + '(';
+        const QByteArray sig = methodSignature(f);
         QByteArray arguments;
 
         for (int j = 0; j < f.arguments.count(); ++j) {
-            const ArgumentDef &a = f.arguments.at(j);
-            if (j) {
-                sig += ",";
+            if (j)
                 arguments += ",";
-            }
-            sig += a.normalizedType;
-            arguments += a.name;
+            arguments += f.arguments.at(j).name;
         }
-        sig += ')';
 
         unsigned char flags = type;
         if (f.access == FunctionDef::Private)
@@ -430,6 +457,34 @@ void Generator::generateFunctions(QList<FunctionDef>& list, const char *functype
     }
 }
 
+void Generator::generateMethodHash(int size)
+{
+    if (size == 0)
+        return;
+
+    QList<QByteArray> signatures;
+    foreach (const FunctionDef &f, cdef->signalList)
+        signatures += methodSignature(f);
+    foreach (const FunctionDef &f, cdef->slotList)
+        signatures += methodSignature(f);
+    foreach (const FunctionDef &f, cdef->methodList)
+        signatures += methodSignature(f);
+
+    QVector<uint> table(size * 2, 0);
+    for (int i = 0; i < signatures.count(); ++i) {
+        const uint hash = QMetaObjectPrivate::methodHash(signatures.at(i).constData());
+        int slot = (hash & (size - 1));
+        while (table.at(2 * slot + 1) != 0)
+            slot = ((slot + 1) & (size - 1));
+        table[2 * slot] = hash;
+        table[2 * slot + 1] = i + 1;
+    }
+
+    fprintf(out, "\n // method hash: hash, index + 1\n");
+    for (int i = 0; i < size; ++i)
+        fprintf(out, "    0x%.8x, %4u,\n", table.at(2 * i), table.at(2 * i + 1));
+}
+
 void Generator::generateProperties()
 {
     //
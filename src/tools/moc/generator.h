@@ -37,6 +37,7 @@ public:
 private:
     void generateClassInfos();
     void generateFunctions(QList<FunctionDef> &list, const char *functype, int type);
+    void generateMethodHash(int size);
     void generateEnums(int index);
     void generateProperties();
     void generateMetacall();
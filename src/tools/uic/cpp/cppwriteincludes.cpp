@@ -184,6 +184,7 @@ static const struct ClassTblData {
     { QLatin1String("QFormBuilder"), QLatin1String("QtUiTools/formbuilder.h") },
     { QLatin1String("QFormLayout"), QLatin1String("QtGui/qformlayout.h") },
     { QLatin1String("QFrame"), QLatin1String("QtGui/qframe.h") },
+    { QLatin1String("QFuture"), QLatin1String("QtCore/qfuture.h") },
     { QLatin1String("QGenericArgument"), QLatin1String("QtCore/qobjectdefs.h") },
     { QLatin1String("QGenericReturnArgument"), QLatin1String("QtCore/qobjectdefs.h") },
     { QLatin1String("QGradient"), QLatin1String("QtGui/qbrush.h") },
@@ -250,6 +251,7 @@ static const struct ClassTblData {
     { QLatin1String("QItemSelectionModel"), QLatin1String("QtGui/qitemselectionmodel.h") },
     { QLatin1String("QItemSelectionRange"), QLatin1String("QtGui/qitemselectionmodel.h") },
     { QLatin1String("QJsonDocument"), QLatin1String("QtCore/qjsondocument.h") },
+    { QLatin1String("QJsonStreamReader"), QLatin1String("QtCore/qjsonstreamreader.h") },
     { QLatin1String("QKeyEvent"), QLatin1String("QtGui/qevent.h") },
     { QLatin1String("QKeySequence"), QLatin1String("QtGui/qkeysequence.h") },
     { QLatin1String("QLCDNumber"), QLatin1String("QtGui/qlcdnumber.h") },
@@ -331,12 +333,15 @@ static const struct ClassTblData {
     { QLatin1String("QProcessEnvironment"), QLatin1String("QtCore/qprocess.h") },
     { QLatin1String("QProgressBar"), QLatin1String("QtGui/qprogressbar.h") },
     { QLatin1String("QProgressDialog"), QLatin1String("QtGui/qprogressdialog.h") },
+    { QLatin1String("QPromise"), QLatin1String("QtCore/qpromise.h") },
     { QLatin1String("QPropertyAnimation"), QLatin1String("QtGui/qpropertyanimation.h") },
     { QLatin1String("QProxyModel"), QLatin1String("QtGui/qproxymodel.h") },
     { QLatin1String("QProxyStyle"), QLatin1String("QtGui/qproxystyle.h") },
     { QLatin1String("QPushButton"), QLatin1String("QtGui/qpushbutton.h") },
     { QLatin1String("QRadialGradient"), QLatin1String("QtGui/qbrush.h") },
     { QLatin1String("QRadioButton"), QLatin1String("QtGui/qradiobutton.h") },
+    { QLatin1String("QReadLocker"), QLatin1String("QtCore/qreadwritelock.h") },
+    { QLatin1String("QReadWriteLock"), QLatin1String("QtCore/qreadwritelock.h") },
     { QLatin1String("QRect"), QLatin1String("QtCore/qrect.h") },
     { QLatin1String("QRectF"), QLatin1String("QtCore/qrect.h") },
     { QLatin1String("QRegExp"), QLatin1String("QtCore/qregexp.h") },
@@ -344,6 +349,7 @@ static const struct ClassTblData {
     { QLatin1String("QRegion"), QLatin1String("QtGui/qregion.h") },
     { QLatin1String("QResizeEvent"), QLatin1String("QtGui/qevent.h") },
     { QLatin1String("QRubberBand"), QLatin1String("QtGui/qrubberband.h") },
+    { QLatin1String("QRunnable"), QLatin1String("QtCore/qrunnable.h") },
     { QLatin1String("QScopedValueRollback"), QLatin1String("QtCore/qscopedvaluerollback.h") },
     { QLatin1String("QScrollArea"), QLatin1String("QtGui/qscrollarea.h") },
     { QLatin1String("QScrollBar"), QLatin1String("QtGui/qscrollbar.h") },
@@ -476,6 +482,7 @@ static const struct ClassTblData {
     { QLatin1String("QTextTableCellFormat"), QLatin1String("QtGui/qtextformat.h") },
     { QLatin1String("QTextTableFormat"), QLatin1String("QtGui/qtextformat.h") },
     { QLatin1String("QThread"), QLatin1String("QtCore/qthread.h") },
+    { QLatin1String("QThreadPool"), QLatin1String("QtCore/qthreadpool.h") },
     { QLatin1String("QTime"), QLatin1String("QtCore/qdatetime.h") },
     { QLatin1String("QTimeEdit"), QLatin1String("QtGui/qdatetimeedit.h") },
     { QLatin1String("QTimeLine"), QLatin1String("QtCore/qtimeline.h") },
@@ -519,6 +526,7 @@ static const struct ClassTblData {
     { QLatin1String("QWindowsStyle"), QLatin1String("QtGui/qwindowsstyle.h") },
     { QLatin1String("QWizard"), QLatin1String("QtGui/qwizard.h") },
     { QLatin1String("QWizardPage"), QLatin1String("QtGui/qwizard.h") },
+    { QLatin1String("QWriteLocker"), QLatin1String("QtCore/qreadwritelock.h") },
     { QLatin1String("QX11Info"), QLatin1String("QtGui/qx11info_x11.h") },
     { QLatin1String("QXmlAttributes"), QLatin1String("QtXml/qxml.h") },
     { QLatin1String("QXmlContentHandler"), QLatin1String("QtXml/qxml.h") },
@@ -27,6 +27,7 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QBuffer>
 #include <QProcess>
 #include <QTextStream>
 
@@ -147,6 +148,16 @@ private slots:
     void resize_data();
     void resize();
 
+    void map_data();
+    void map();
+    void mapPrivate();
+    void mapOpenMode();
+
+    void writeBuffer();
+    void writeBufferReadBack();
+    void writeBufferSize();
+    void writeBufferAboutToClose();
+
     void objectConstructors();
     void caseSensitivity();
 
@@ -2502,6 +2513,262 @@ void tst_QFile::resize()
     QVERIFY(QFile::remove(filename));
 }
 
+void tst_QFile::map_data()
+{
+    QTest::addColumn<int>("fileSize");
+    QTest::addColumn<int>("offset");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<QFile::FileError>("error");
+
+    QTest::newRow("zero") << 4096 << 0 << 0 << QFile::UnspecifiedError;
+    QTest::newRow("small") << 4096 << 100 << 100 << QFile::NoError;
+    QTest::newRow("whole") << 4096 << 0 << 4096 << QFile::NoError;
+    QTest::newRow("unaligned") << 100000 << 4097 << 50000 << QFile::NoError;
+    QTest::newRow("negative offset") << 4096 << -1 << 100 << QFile::UnspecifiedError;
+    QTest::newRow("past end") << 4096 << 4000 << 100 << QFile::UnspecifiedError;
+}
+
+void tst_QFile::map()
+{
+    QFETCH(int, fileSize);
+    QFETCH(int, offset);
+    QFETCH(int, size);
+    QFETCH(QFile::FileError, error);
+
+    QString fileName = QDir::currentPath() + '/' + "qfile_map_testfile";
+    if (QFile::exists(fileName)) {
+        QVERIFY(QFile::setPermissions(fileName,
+            QFile::WriteOwner | QFile::ReadOwner | QFile::WriteUser | QFile::ReadUser));
+        QFile::remove(fileName);
+    }
+
+    QByteArray contents(fileSize, '\0');
+    for (int i = 0; i < fileSize; ++i)
+        contents[i] = char(i % 251);
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::ReadWrite | QFile::Truncate));
+    QCOMPARE(file.write(contents), qint64(fileSize));
+
+    uchar *memory = file.map(offset, size);
+    if (error != QFile::NoError) {
+        QVERIFY(!memory);
+        QCOMPARE(file.error(), error);
+        file.remove();
+        return;
+    }
+    QCOMPARE(file.error(), QFile::NoError);
+    QVERIFY(memory);
+    QVERIFY(::memcmp(memory, contents.constData() + offset, size) == 0);
+
+    // a shared mapping writes through to the file
+    memory[0] = 'Q';
+    QVERIFY(file.unmap(memory));
+    QCOMPARE(file.error(), QFile::NoError);
+    QVERIFY(!file.unmap(memory));
+    QCOMPARE(file.error(), QFile::PermissionsError);
+
+    // the mapping stays valid after the file is closed
+    memory = file.map(offset, size, QFile::MapSequentialHint | QFile::MapWillNeedHint);
+    QVERIFY(memory);
+    file.close();
+    QCOMPARE(char(memory[0]), 'Q');
+
+    // and can be read zero-copy through QBuffer
+    QBuffer buffer;
+    buffer.setData(QByteArray::fromRawData(reinterpret_cast<const char *>(memory), size));
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QVERIFY(buffer.seek(size - 1));
+    QCOMPARE(buffer.read(1), contents.mid(offset + size - 1, 1));
+    buffer.close();
+    QVERIFY(file.unmap(memory));
+
+    QVERIFY(file.open(QFile::ReadOnly));
+    QVERIFY(file.seek(offset));
+    QCOMPARE(file.read(1), QByteArray(1, 'Q'));
+    file.close();
+
+    QVERIFY(!file.map(0, 1));
+    QCOMPARE(file.error(), QFile::PermissionsError);
+    file.remove();
+}
+
+void tst_QFile::mapPrivate()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_map_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::ReadWrite | QFile::Truncate));
+    QCOMPARE(file.write(QByteArray(4096, 'a')), qint64(4096));
+    QVERIFY(file.flush());
+    file.close();
+
+    // private mappings are writable even for read-only files
+    QVERIFY(file.open(QFile::ReadOnly));
+    uchar *memory = file.map(0, 4096, QFile::MapPrivateOption);
+    QVERIFY(memory);
+    memory[0] = 'b';
+    QCOMPARE(char(memory[0]), 'b');
+    QVERIFY(file.unmap(memory));
+
+    QVERIFY(file.seek(0));
+    QCOMPARE(file.read(1), QByteArray(1, 'a'));
+    file.close();
+    file.remove();
+}
+
+void tst_QFile::mapOpenMode()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_map_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::ReadWrite | QFile::Truncate));
+    QCOMPARE(file.write(QByteArray(4096, 'a')), qint64(4096));
+    file.close();
+
+    QVERIFY(file.open(QFile::ReadOnly));
+    uchar *memory = file.map(0, 4096);
+    QVERIFY(memory);
+    QCOMPARE(char(memory[4095]), 'a');
+    file.close();
+
+    // write-only files cannot be mapped
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Append));
+    QVERIFY(!file.map(0, 4096));
+    QCOMPARE(file.error(), QFile::PermissionsError);
+    file.close();
+
+    // reopening unmaps what was left mapped
+    QVERIFY(file.open(QFile::ReadWrite));
+    QVERIFY(!file.unmap(memory));
+    memory = file.map(0, 4096);
+    QVERIFY(memory);
+    memory[0] = 'c';
+    file.close();
+
+    QVERIFY(file.open(QFile::ReadOnly));
+    QCOMPARE(file.read(1), QByteArray(1, 'c'));
+    file.close();
+    file.remove();
+}
+
+void tst_QFile::writeBuffer()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_writebuffer_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Truncate));
+    QCOMPARE(file.writeBufferSize(), qint64(16384));
+
+    // small writes are held back until flush()
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(file.write("0123456789", 10), qint64(10));
+    QCOMPARE(file.pos(), qint64(1000));
+    QCOMPARE(QFileInfo(fileName).size(), qint64(0));
+    QVERIFY(file.flush());
+    QCOMPARE(QFileInfo(fileName).size(), qint64(1000));
+
+    // a large write goes out together with what is buffered
+    QVERIFY(file.putChar('a'));
+    QByteArray large(100000, 'b');
+    QCOMPARE(file.write(large), qint64(large.size()));
+    QCOMPARE(QFileInfo(fileName).size(), qint64(101001));
+
+    // seeking writes the buffer out at the position it was written at
+    QVERIFY(file.putChar('c'));
+    QVERIFY(file.seek(5));
+    QVERIFY(file.putChar('d'));
+    QCOMPARE(file.size(), qint64(101002));
+    file.close();
+
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QByteArray contents = file.readAll();
+    QCOMPARE(contents.size(), 101002);
+    QCOMPARE(contents.left(12), QByteArray("01234d678901"));
+    QCOMPARE(contents.at(1000), 'a');
+    QCOMPARE(contents.mid(1001, 100000), large);
+    QCOMPARE(contents.at(101001), 'c');
+    file.close();
+    file.remove();
+}
+
+void tst_QFile::writeBufferReadBack()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_writebuffer_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::ReadWrite | QFile::Truncate));
+    QVERIFY(file.write("hello world") == 11);
+    QCOMPARE(file.size(), qint64(11));
+    QVERIFY(file.seek(6));
+    QCOMPARE(file.read(5), QByteArray("world"));
+    QVERIFY(file.atEnd());
+
+    QVERIFY(file.seek(0));
+    QVERIFY(file.write("HELLO") == 5);
+    QCOMPARE(file.read(6), QByteArray(" world"));
+    QVERIFY(file.resize(5));
+    QVERIFY(file.seek(0));
+    QCOMPARE(file.readAll(), QByteArray("HELLO"));
+    file.close();
+
+    // files opened unbuffered or from a handle write through
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Truncate | QFile::Unbuffered));
+    QVERIFY(file.write("abc") == 3);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(3));
+    file.close();
+
+    int fd = QT_OPEN(QFile::encodeName(fileName).constData(), QT_OPEN_WRONLY | QT_OPEN_TRUNC);
+    QVERIFY(fd != -1);
+    QFile handleFile;
+    QVERIFY(handleFile.open(fd, QFile::WriteOnly, QFile::AutoCloseHandle));
+    QVERIFY(handleFile.write("abcd") == 4);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(4));
+    handleFile.close();
+    QFile::remove(fileName);
+}
+
+void tst_QFile::writeBufferSize()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_writebuffer_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Truncate));
+    QVERIFY(file.write("abc") == 3);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(0));
+
+    // changing the size writes out what is buffered
+    file.setWriteBufferSize(0);
+    QCOMPARE(file.writeBufferSize(), qint64(0));
+    QCOMPARE(QFileInfo(fileName).size(), qint64(3));
+    QVERIFY(file.write("def") == 3);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(6));
+
+    file.setWriteBufferSize(4);
+    QVERIFY(file.write("gh") == 2);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(6));
+    QVERIFY(file.write("ijk") == 3);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(8));
+    QVERIFY(file.write("lmnop") == 5);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(16));
+    file.close();
+
+    QVERIFY(file.open(QFile::ReadOnly));
+    QCOMPARE(file.readAll(), QByteArray("abcdefghijklmnop"));
+    file.close();
+    file.remove();
+}
+
+void tst_QFile::writeBufferAboutToClose()
+{
+    QString fileName = QDir::currentPath() + '/' + "qfile_writebuffer_testfile";
+    QFile file(fileName);
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Truncate));
+    {
+        // the stream writes what it holds when the file is closed
+        QTextStream stream(&file);
+        stream << "abc";
+        file.close();
+        QCOMPARE(file.error(), QFile::NoError);
+    }
+    QCOMPARE(QFileInfo(fileName).size(), qint64(3));
+    file.remove();
+}
+
 void tst_QFile::objectConstructors()
 {
     QObject ob;
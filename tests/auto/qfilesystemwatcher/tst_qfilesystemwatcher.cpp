@@ -27,6 +27,10 @@
 #include <QTimer>
 #include <QDebug>
 
+#include "../../shared/util.h"
+
+#include <stdio.h>
+
 //TESTED_CLASS=
 //TESTED_FILES=
 
@@ -55,6 +59,8 @@ private slots:
 
     void removeFileAndUnWatch();
 
+    void inotify();
+
     void cleanup();
 
     void QTBUG15255_deadlock();
@@ -525,6 +531,54 @@ void tst_QFileSystemWatcher::removeFileAndUnWatch()
     watcher.addPath(filename);
 }
 
+void tst_QFileSystemWatcher::inotify()
+{
+#ifndef QT_HAVE_INOTIFY_INIT1
+    QSKIP("inotify is not supported", SkipAll);
+#else
+    if (!qgetenv("QT_NO_INOTIFY").isNull())
+        QSKIP("inotify is disabled", SkipAll);
+
+    static const char * const filename = "inotify.txt";
+    static const char * const replacename = "inotify_replace.txt";
+    QFile::remove(filename);
+    QFile::remove(replacename);
+
+    QFile testFile(filename);
+    QVERIFY(testFile.open(QIODevice::WriteOnly));
+    testFile.close();
+
+    // changes must be reported without waiting for the polling interval
+    QFileSystemWatcher watcher;
+    watcher.setInterval(60000);
+    watcher.addPath(filename);
+    QSignalSpy changedSpy(&watcher, SIGNAL(fileChanged(const QString &)));
+
+    QVERIFY(testFile.open(QIODevice::WriteOnly | QIODevice::Append));
+    testFile.write("hello");
+    testFile.close();
+    QTRY_COMPARE(changedSpy.count(), 1);
+
+    // replacing the file keeps the path watched
+    changedSpy.clear();
+    QFile replaceFile(replacename);
+    QVERIFY(replaceFile.open(QIODevice::WriteOnly));
+    replaceFile.close();
+    QVERIFY(::rename(replacename, filename) == 0);
+    QTRY_COMPARE(changedSpy.count(), 1);
+    QCOMPARE(watcher.files(), QStringList() << filename);
+
+    changedSpy.clear();
+    QVERIFY(testFile.open(QIODevice::WriteOnly | QIODevice::Append));
+    testFile.write("world");
+    testFile.close();
+    QTRY_COMPARE(changedSpy.count(), 1);
+
+    QVERIFY(testFile.remove());
+    QTRY_VERIFY(watcher.files().isEmpty());
+#endif
+}
+
 class SomeSingleton : public QObject
 {
 public:
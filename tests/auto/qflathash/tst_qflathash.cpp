@@ -0,0 +1,265 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <qflathash_p.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void insertRemove();
+    void complexValues();
+    void erase();
+    void copyAndMove();
+    void compare();
+    void randomAgainstQHash();
+    void dataStream();
+};
+
+void tst_QFlatHash::insertRemove()
+{
+    QFlatHash<int, int> hash;
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(1));
+    QCOMPARE(hash.value(1), 0);
+    QCOMPARE(hash.value(1, -1), -1);
+    QVERIFY(hash.constFind(1) == hash.constEnd());
+
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i * 2);
+    QCOMPARE(hash.size(), 1000);
+    for (int i = 0; i < 1000; ++i)
+        QCOMPARE(hash.value(i), i * 2);
+
+    hash.insert(10, 42);
+    QCOMPARE(hash.size(), 1000);
+    QCOMPARE(hash.value(10), 42);
+
+    hash[2000] = 7;
+    QCOMPARE(hash.size(), 1001);
+    QCOMPARE(hash[2000], 7);
+
+    QCOMPARE(hash.remove(2000), 1);
+    QCOMPARE(hash.remove(2000), 0);
+    QCOMPARE(hash.take(10), 42);
+    QCOMPARE(hash.take(10), 0);
+    QCOMPARE(hash.size(), 999);
+
+    // tombstones are reused and cleaned up by rehashing
+    for (int round = 1; round <= 100; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            hash.remove(i + round - 1);
+        QVERIFY(hash.isEmpty());
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(i + round, i);
+        QCOMPARE(hash.size(), 1000);
+        QCOMPARE(hash.value(round), 0);
+    }
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(hash.begin() == hash.end());
+}
+
+void tst_QFlatHash::complexValues()
+{
+    QFlatHash<QString, QString> hash;
+    for (int i = 0; i < 500; ++i)
+        hash.insert(QString::number(i), QString(i % 50, QLatin1Char('x')));
+    QCOMPARE(hash.size(), 500);
+    for (int i = 0; i < 500; ++i)
+        QCOMPARE(hash.value(QString::number(i)), QString(i % 50, QLatin1Char('x')));
+
+    for (int i = 0; i < 500; i += 2)
+        QVERIFY(hash.remove(QString::number(i)));
+    QCOMPARE(hash.size(), 250);
+    QVERIFY(!hash.contains(QLatin1String("0")));
+    QVERIFY(hash.contains(QLatin1String("1")));
+
+    QStringList keys = hash.keys();
+    QCOMPARE(keys.size(), 250);
+    QCOMPARE(hash.values().size(), 250);
+    foreach (const QString &key, keys)
+        QVERIFY(key.toInt() % 2 == 1);
+}
+
+void tst_QFlatHash::erase()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+
+    // erasing must not move the remaining elements
+    QFlatHash<int, int>::iterator kept = hash.find(51);
+    QFlatHash<int, int>::iterator it = hash.begin();
+    int visited = 0;
+    while (it != hash.end()) {
+        ++visited;
+        if (it.key() % 2 == 0)
+            it = hash.erase(it);
+        else
+            ++it;
+    }
+    QCOMPARE(visited, 100);
+    QCOMPARE(hash.size(), 50);
+    QCOMPARE(kept.key(), 51);
+    QCOMPARE(kept.value(), 51);
+
+    int count = 0;
+    for (QFlatHash<int, int>::const_iterator cit = hash.constBegin(); cit != hash.constEnd(); ++cit) {
+        QVERIFY(cit.key() % 2 == 1);
+        QCOMPARE(cit.key(), *cit);
+        ++count;
+    }
+    QCOMPARE(count, 50);
+}
+
+void tst_QFlatHash::copyAndMove()
+{
+    QFlatHash<int, QString> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, QString::number(i));
+
+    QFlatHash<int, QString> copy(hash);
+    QCOMPARE(copy.size(), 100);
+    copy.insert(100, QLatin1String("100"));
+    QCOMPARE(hash.size(), 100);
+    QCOMPARE(copy.value(50), QLatin1String("50"));
+
+    QFlatHash<int, QString> assigned;
+    assigned.insert(-1, QLatin1String("gone"));
+    assigned = copy;
+    QCOMPARE(assigned.size(), 101);
+    QVERIFY(!assigned.contains(-1));
+
+    QFlatHash<int, QString> moved(std::move(assigned));
+    QCOMPARE(moved.size(), 101);
+    QVERIFY(assigned.isEmpty());
+    assigned.insert(1, QLatin1String("1"));
+    QCOMPARE(assigned.size(), 1);
+
+    QFlatHash<int, QString> swapped;
+    swapped.swap(moved);
+    QCOMPARE(swapped.size(), 101);
+    QVERIFY(moved.isEmpty());
+}
+
+void tst_QFlatHash::compare()
+{
+    QFlatHash<int, int> a;
+    QFlatHash<int, int> b;
+    QVERIFY(a == b);
+
+    for (int i = 0; i < 100; ++i)
+        a.insert(i, i);
+    // different insertion order and table history, same contents
+    b.reserve(1000);
+    for (int i = 99; i >= 0; --i)
+        b.insert(i, i);
+    b.insert(1000, 0);
+    b.remove(1000);
+    QVERIFY(a == b);
+
+    b.insert(5, 6);
+    QVERIFY(a != b);
+    b.remove(5);
+    QVERIFY(a != b);
+}
+
+void tst_QFlatHash::randomAgainstQHash()
+{
+    QFlatHash<int, int> flat;
+    QHash<int, int> hash;
+    qsrand(42);
+    for (int i = 0; i < 100000; ++i) {
+        const int key = qrand() % 2000;
+        switch (qrand() % 4) {
+            case 0:
+            case 1: {
+                flat.insert(key, i);
+                hash.insert(key, i);
+                break;
+            }
+            case 2: {
+                QCOMPARE(flat.remove(key), hash.remove(key));
+                break;
+            }
+            case 3: {
+                QCOMPARE(flat.contains(key), hash.contains(key));
+                QCOMPARE(flat.value(key, -1), hash.value(key, -1));
+                break;
+            }
+        }
+        QCOMPARE(flat.size(), hash.size());
+    }
+
+    int count = 0;
+    for (QFlatHash<int, int>::const_iterator it = flat.constBegin(); it != flat.constEnd(); ++it) {
+        QCOMPARE(it.value(), hash.value(it.key(), -1));
+        ++count;
+    }
+    QCOMPARE(count, hash.size());
+}
+
+void tst_QFlatHash::dataStream()
+{
+    QFlatHash<int, QString> flat;
+    QHash<int, QString> hash;
+    for (int i = 0; i < 100; ++i) {
+        flat.insert(i, QString::number(i));
+        hash.insert(i, QString::number(i));
+    }
+
+    // the stream format is the one of QHash
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << flat;
+    }
+    QHash<int, QString> fromFlat;
+    {
+        QDataStream in(data);
+        in >> fromFlat;
+    }
+    QCOMPARE(fromFlat, hash);
+
+    data.clear();
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << hash;
+    }
+    QFlatHash<int, QString> fromHash;
+    fromHash.insert(-1, QLatin1String("gone"));
+    {
+        QDataStream in(data);
+        in >> fromHash;
+    }
+    QVERIFY(fromHash == flat);
+}
+
+QTEST_MAIN(tst_QFlatHash)
+
+#include "moc_tst_qflathash.cpp"
@@ -0,0 +1,270 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+
+#include <QtTest/QtTest>
+
+#include <qfuture.h>
+#include <qpromise.h>
+#include <qthreadpool.h>
+#include <qthread.h>
+
+#include "../../shared/util.h"
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+// finishes the promise with value from a pool thread after a delay
+class PromiseRunnable : public QRunnable
+{
+public:
+    PromiseRunnable(int value, int delay = 10) : value(value), delay(delay) { }
+
+    void run()
+    {
+        promise.start();
+        QThread::msleep(delay);
+        promise.addResult(value);
+        promise.finish();
+    }
+
+    QPromise<int> promise;
+
+private:
+    int value;
+    int delay;
+};
+
+static QFuture<int> startValue(int value, int delay = 10)
+{
+    PromiseRunnable *runnable = new PromiseRunnable(value, delay);
+    QFuture<int> future = runnable->promise.future();
+    QThreadPool::globalInstance()->start(runnable);
+    return future;
+}
+
+class tst_QFuture : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaultFuture();
+    void promiseResult();
+    void waitForResult();
+    void then();
+    void thenFinished();
+    void thenVoid();
+    void thenContext();
+    void thenContextDestroyed();
+    void thenPool();
+    void failed();
+    void cancel();
+    void progress();
+    void abandonedPromise();
+};
+
+void tst_QFuture::defaultFuture()
+{
+    QFuture<int> future;
+    QVERIFY(future.isFinished());
+    QVERIFY(future.isCanceled());
+    QVERIFY(!future.isRunning());
+    QCOMPARE(future.result(), 0);
+
+    QFuture<int> copy = future;
+    QVERIFY(copy == future);
+}
+
+void tst_QFuture::promiseResult()
+{
+    QPromise<int> promise;
+    QFuture<int> future = promise.future();
+    QVERIFY(!future.isStarted());
+
+    promise.start();
+    QVERIFY(future.isStarted());
+    QVERIFY(future.isRunning());
+
+    promise.addResult(42);
+    QVERIFY(!future.isFinished());
+    promise.finish();
+    QVERIFY(future.isFinished());
+    QVERIFY(!future.isRunning());
+    QVERIFY(!future.isCanceled());
+    QVERIFY(!future.isFailed());
+    QCOMPARE(future.result(), 42);
+}
+
+void tst_QFuture::waitForResult()
+{
+    QFuture<int> future = startValue(7, 50);
+    QCOMPARE(future.result(), 7);
+    QVERIFY(future.isFinished());
+}
+
+void tst_QFuture::then()
+{
+    QFuture<QString> future = startValue(21)
+        .then([](int value) { return value * 2; })
+        .then([](int value) { return QString::number(value); });
+    QCOMPARE(future.result(), QString::fromLatin1("42"));
+}
+
+void tst_QFuture::thenFinished()
+{
+    QPromise<int> promise;
+    promise.addResult(1);
+    promise.finish();
+
+    // the continuation of a finished future is called right away
+    bool called = false;
+    promise.future().then([&called](int value) { called = (value == 1); });
+    QVERIFY(called);
+}
+
+void tst_QFuture::thenVoid()
+{
+    QPromise<void> promise;
+    QAtomicInt called(0);
+    QFuture<int> future = promise.future()
+        .then([&called]() { called.ref(); })
+        .then([&called]() { called.ref(); return 3; });
+    QVERIFY(!future.isFinished());
+    promise.finish();
+    QCOMPARE(future.result(), 3);
+    QCOMPARE(called.load(), 2);
+}
+
+void tst_QFuture::thenContext()
+{
+    QObject context;
+    QThread *thread = nullptr;
+    QFuture<int> future = startValue(5).then(&context, [&thread](int value) {
+        thread = QThread::currentThread();
+        return value + 1;
+    });
+
+    // the continuation is posted to the event loop of the context
+    QTRY_VERIFY(future.isFinished());
+    QCOMPARE(future.result(), 6);
+    QCOMPARE(thread, context.thread());
+}
+
+void tst_QFuture::thenContextDestroyed()
+{
+    QObject *context = new QObject();
+    bool called = false;
+    QPromise<int> promise;
+    QFuture<int> future = promise.future().then(context, [&called](int value) {
+        called = true;
+        return value;
+    });
+
+    // the event is posted but the context is gone before it is delivered
+    promise.finish();
+    delete context;
+    QVERIFY(future.isFinished());
+    QVERIFY(future.isCanceled());
+    QTest::qWait(10);
+    QVERIFY(!called);
+}
+
+void tst_QFuture::thenPool()
+{
+    QThreadPool pool;
+    QPromise<int> promise;
+    QFuture<bool> future = promise.future().then(&pool, [](int) {
+        return (QThread::currentThread() != qApp->thread());
+    });
+    promise.finish();
+    QVERIFY(future.result());
+}
+
+void tst_QFuture::failed()
+{
+    QPromise<int> promise;
+    bool thencalled = false;
+    QString error;
+    QFuture<int> future = promise.future()
+        .then([&thencalled](int value) { thencalled = true; return value; })
+        .onFailed([&error](const QString &errorString) { error = errorString; return -1; });
+
+    promise.setFailed(QLatin1String("Lookup failed"));
+    promise.finish();
+    QVERIFY(!thencalled);
+    QCOMPARE(error, QString::fromLatin1("Lookup failed"));
+    QVERIFY(!future.isFailed());
+    QCOMPARE(future.result(), -1);
+
+    // onFailed() passes results on
+    QPromise<int> other;
+    QFuture<int> passed = other.future().onFailed([](const QString &) { return -1; });
+    other.addResult(3);
+    other.finish();
+    QCOMPARE(passed.result(), 3);
+}
+
+void tst_QFuture::cancel()
+{
+    QPromise<int> promise;
+    bool called = false;
+    QFuture<int> future = promise.future();
+    QFuture<int> next = future.then([&called](int value) { called = true; return value; });
+
+    future.cancel();
+    QVERIFY(promise.isCanceled());
+    QVERIFY(!future.isFinished());
+    promise.finish();
+    QVERIFY(future.isFinished());
+    QVERIFY(next.isFinished());
+    QVERIFY(next.isCanceled());
+    QVERIFY(!called);
+}
+
+void tst_QFuture::progress()
+{
+    QPromise<int> promise;
+    QFuture<int> future = promise.future();
+    promise.setProgressRange(0, 100);
+    QCOMPARE(future.progressMinimum(), 0);
+    QCOMPARE(future.progressMaximum(), 100);
+    promise.setProgressValue(40);
+    QCOMPARE(future.progressValue(), 40);
+    promise.setProgressValue(200);
+    QCOMPARE(future.progressValue(), 100);
+    promise.finish();
+}
+
+void tst_QFuture::abandonedPromise()
+{
+    QFuture<int> future;
+    {
+        QPromise<int> promise;
+        future = promise.future();
+        promise.start();
+    }
+    QVERIFY(future.isFinished());
+    QVERIFY(future.isCanceled());
+}
+
+QTEST_MAIN(tst_QFuture)
+
+#include "moc_tst_qfuture.cpp"
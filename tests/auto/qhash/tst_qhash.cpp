@@ -23,6 +23,7 @@
 
 #include <qhash.h>
 #include <qbitarray.h>
+#include <qset.h>
 
 //TESTED_CLASS=
 //TESTED_FILES=
@@ -52,6 +53,8 @@ private slots:
     void rehash_isnt_quadratic();
     void dont_need_default_constructor();
     void qhash();
+    void qhashStrings();
+    void qhashStringCollisions();
     void qmultihash_specific();
 
     void compare();
@@ -1030,6 +1033,56 @@ void tst_QHash::qhash()
     }
 }
 
+void tst_QHash::qhashStrings()
+{
+    const QString string = QLatin1String("The quick brown fox jumps over the lazy dog");
+    const QByteArray bytes = string.toLatin1();
+
+    QCOMPARE(qHash(QString()), 0U);
+    QCOMPARE(qHash(QByteArray()), 0U);
+    QCOMPARE(qHash(string), qHash(QString(string.constData(), string.size())));
+    QCOMPARE(qHash(string), qHash(QStringRef(&string)));
+    QCOMPARE(qHash(string.midRef(4, 5)), qHash(QString::fromLatin1("quick")));
+    QCOMPARE(qHash(bytes), qHash(bytes.constData(), bytes.size()));
+
+    // every character contributes to the hash, not only the last few
+    for (int i = 0; i < string.size(); ++i) {
+        QString changed = string;
+        changed[i] = QLatin1Char('#');
+        QVERIFY(qHash(changed) != qHash(string));
+    }
+}
+
+// every concatenation of the "AQ" and "BA" blocks had the same hash with the
+// shift and xor string hash, all keys ended up in a single bucket
+void tst_QHash::qhashStringCollisions()
+{
+    QList<QByteArray> keys;
+    for (int i = 0; i < 4096; ++i) {
+        QByteArray key;
+        for (int bit = 0; bit < 12; ++bit)
+            key += (i & (1 << bit)) ? "BA" : "AQ";
+        keys.append(key);
+    }
+
+    QSet<uint> stringHashes;
+    QSet<uint> byteArrayHashes;
+    QHash<QString, int> hash;
+    for (int i = 0; i < keys.size(); ++i) {
+        const QString key = QString::fromLatin1(keys.at(i));
+        stringHashes.insert(qHash(key));
+        byteArrayHashes.insert(qHash(keys.at(i)));
+        hash.insert(key, i);
+    }
+
+    // a few collisions of the 32-bit values are expected by chance
+    QVERIFY(stringHashes.size() > keys.size() - 8);
+    QVERIFY(byteArrayHashes.size() > keys.size() - 8);
+    QCOMPARE(hash.size(), keys.size());
+    for (int i = 0; i < keys.size(); ++i)
+        QCOMPARE(hash.value(QString::fromLatin1(keys.at(i))), i);
+}
+
 void tst_QHash::qmultihash_specific()
 {
     QMultiHash<int, int> hash1;
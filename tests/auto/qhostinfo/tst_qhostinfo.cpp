@@ -66,8 +66,19 @@ private slots:
 
     void raceCondition();
 
+    void localLookup_data();
+    void localLookup();
+    void abortHostLookup();
+    void multipleLookups();
+    void connectToHostLookup();
+
+protected slots:
+    void resultsReady(const QHostInfo &info);
+
 private:
     bool ipv6Available;
+    bool lookupDone;
+    int lookupsDoneCounter;
     QHostInfo lookupResults;
 };
 
@@ -134,8 +145,12 @@ void tst_QHostInfo::lookupIPv4()
     QFETCH(int, err);
     QFETCH(QString, addresses);
 
-    QHostInfo lookupResults = QHostInfo::fromName(hostname);
-    QTestEventLoop::instance().enterLoop(1);
+    lookupDone = false;
+    QHostInfo::lookupHost(hostname, this, SLOT(resultsReady(const QHostInfo&)));
+
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QVERIFY(lookupDone);
 
     if ((int)lookupResults.error() != (int)err) {
         qWarning() << hostname << "=>" << lookupResults.errorString();
@@ -176,8 +191,12 @@ void tst_QHostInfo::lookupIPv6()
     if (!ipv6Available)
         QSKIP("This platform does not support IPv6 lookups", SkipAll);
 
-    QHostInfo lookupResults = QHostInfo::fromName(hostname);
-    QTestEventLoop::instance().enterLoop(1);
+    lookupDone = false;
+    QHostInfo::lookupHost(hostname, this, SLOT(resultsReady(const QHostInfo&)));
+
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QVERIFY(lookupDone);
 
     QCOMPARE((int)lookupResults.error(), (int)err);
 
@@ -263,6 +282,93 @@ void tst_QHostInfo::raceCondition()
     }
 }
 
+void tst_QHostInfo::localLookup_data()
+{
+    QTest::addColumn<QString>("hostname");
+    QTest::addColumn<QString>("address");
+    QTest::addColumn<int>("err");
+
+    QTest::newRow("localhost") << "localhost" << "127.0.0.1" << int(QHostInfo::NoError);
+    QTest::newRow("literal_ip4") << "127.0.0.1" << "127.0.0.1" << int(QHostInfo::NoError);
+    QTest::newRow("empty") << "" << "" << int(QHostInfo::HostNotFound);
+}
+
+void tst_QHostInfo::localLookup()
+{
+    QFETCH(QString, hostname);
+    QFETCH(QString, address);
+    QFETCH(int, err);
+
+    // the result is delivered from the event loop, even when it is cached
+    for (int i = 0; i < 2; ++i) {
+        lookupDone = false;
+        const int id = QHostInfo::lookupHost(hostname, this, SLOT(resultsReady(const QHostInfo&)));
+        QVERIFY(id != -1);
+        QVERIFY(!lookupDone);
+
+        QTestEventLoop::instance().enterLoop(10);
+        QVERIFY(!QTestEventLoop::instance().timeout());
+        QVERIFY(lookupDone);
+        QCOMPARE(lookupResults.lookupId(), id);
+        QCOMPARE((int)lookupResults.error(), err);
+        if (!address.isEmpty())
+            QVERIFY(lookupResults.addresses().contains(QHostAddress(address.toLatin1())));
+    }
+}
+
+void tst_QHostInfo::abortHostLookup()
+{
+    // reset counter
+    lookupsDoneCounter = 0;
+    bool valid = false;
+    int id = -1;
+    QHostInfo result = qt_qhostinfo_lookup("localhost", this, SLOT(resultsReady(QHostInfo)), &valid, &id);
+    if (valid) {
+        // cached result, nothing to abort
+        QCOMPARE(result.error(), QHostInfo::NoError);
+        return;
+    }
+    QVERIFY(id != -1);
+    QHostInfo::abortHostLookup(id);
+    QTestEventLoop::instance().enterLoop(2);
+    QCOMPARE(lookupsDoneCounter, 0);
+}
+
+void tst_QHostInfo::multipleLookups()
+{
+    static const int COUNT = 10;
+    lookupsDoneCounter = 0;
+
+    for (int i = 0; i < COUNT; i++)
+        QHostInfo::lookupHost("localhost", this, SLOT(resultsReady(QHostInfo)));
+
+    QTRY_COMPARE(lookupsDoneCounter, COUNT);
+    // wait a bit more to check that no further results arrive
+    QTest::qWait(100);
+    QCOMPARE(lookupsDoneCounter, COUNT);
+}
+
+void tst_QHostInfo::connectToHostLookup()
+{
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+
+    // the lookup does not block, the socket is still looking up after connectToHost()
+    qt_qhostinfo_clear_cache();
+    QTcpSocket socket;
+    socket.connectToHost("localhost", server.serverPort());
+    QCOMPARE(socket.state(), QAbstractSocket::HostLookupState);
+    QTRY_COMPARE(socket.state(), QAbstractSocket::ConnectedState);
+}
+
+void tst_QHostInfo::resultsReady(const QHostInfo &hi)
+{
+    lookupDone = true;
+    lookupResults = hi;
+    lookupsDoneCounter++;
+    QTestEventLoop::instance().exitLoop();
+}
+
 QTEST_MAIN(tst_QHostInfo)
 
 #include "moc_tst_qhostinfo.cpp"
@@ -39,6 +39,7 @@ public slots:
 
 private slots:
     void read();
+    void nested();
     void write();
     void error();
     void eq_not_eq();
@@ -122,6 +123,27 @@ void tst_QJsonDocument::read()
     // TODO: test other types too
 }
 
+void tst_QJsonDocument::nested()
+{
+    QJsonDocument jsondoc = QJsonDocument::fromJson("[[1, [2, {\"a\": [3, null]}]], {\"b\": {\"c\": [true]}}]");
+    QVERIFY(jsondoc.errorString().isEmpty());
+    const QVariantList jsonlist = jsondoc.toVariant().toList();
+    QCOMPARE(jsonlist.size(), 2);
+
+    const QVariantList NestedArray = jsonlist.at(0).toList();
+    QCOMPARE(NestedArray.size(), 2);
+    QCOMPARE(NestedArray.at(0).toInt(), 1);
+    const QVariantList NestedArray2 = NestedArray.at(1).toList();
+    QCOMPARE(NestedArray2.at(0).toInt(), 2);
+    const QVariantList NestedArray3 = NestedArray2.at(1).toMap().value("a").toList();
+    QCOMPARE(NestedArray3.size(), 2);
+    QCOMPARE(NestedArray3.at(0).toInt(), 3);
+    QVERIFY(NestedArray3.at(1).isNull());
+
+    const QVariantMap NestedObject = jsonlist.at(1).toMap().value("b").toMap();
+    QCOMPARE(NestedObject.value("c").toList(), QVariantList() << true);
+}
+
 void tst_QJsonDocument::write()
 {
     QJsonDocument jsondoc = QJsonDocument::fromVariant(testjsondata);
@@ -0,0 +1,339 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCore/QtCore>
+
+//TESTED_CLASS=QJsonStreamReader
+//TESTED_FILES=qjsonstreamreader.cpp,qjsonstreamreader.h
+
+static const char testjson[] = "{\"name\": \"Katie\", \"list\": [1, -2.5, true, false, null], \"object\": {}}";
+
+// one character per token type, object keys are prefixed with ':'
+static QString tokenString(QJsonStreamReader &reader)
+{
+    QString result;
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+            case QJsonStreamReader::StartDocument: {
+                result += QLatin1Char('<');
+                break;
+            }
+            case QJsonStreamReader::EndDocument: {
+                result += QLatin1Char('>');
+                break;
+            }
+            case QJsonStreamReader::StartObject: {
+                result += QLatin1Char('{');
+                break;
+            }
+            case QJsonStreamReader::EndObject: {
+                result += QLatin1Char('}');
+                break;
+            }
+            case QJsonStreamReader::StartArray: {
+                result += QLatin1Char('[');
+                break;
+            }
+            case QJsonStreamReader::EndArray: {
+                result += QLatin1Char(']');
+                break;
+            }
+            case QJsonStreamReader::Name: {
+                result += QLatin1Char(':') + reader.text();
+                break;
+            }
+            case QJsonStreamReader::String: {
+                result += QLatin1Char('s');
+                break;
+            }
+            case QJsonStreamReader::Integer: {
+                result += QLatin1Char('i');
+                break;
+            }
+            case QJsonStreamReader::Real: {
+                result += QLatin1Char('r');
+                break;
+            }
+            case QJsonStreamReader::Bool: {
+                result += QLatin1Char('b');
+                break;
+            }
+            case QJsonStreamReader::Null: {
+                result += QLatin1Char('n');
+                break;
+            }
+            case QJsonStreamReader::NoToken:
+            case QJsonStreamReader::Invalid: {
+                result += QLatin1Char('!');
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+class tst_QJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tokens_data();
+    void tokens();
+    void values();
+    void strings_data();
+    void strings();
+    void chunked();
+    void device();
+    void skipCurrentValue();
+    void error_data();
+    void error();
+    void premature();
+};
+
+void tst_QJsonStreamReader::tokens_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("tokens");
+
+    QTest::newRow("object") << QByteArray(testjson) << QString::fromLatin1("<{:names:list[irbbn]:object{}}>");
+    QTest::newRow("array") << QByteArray(" [ [], [[1]], {\"a\": []} ] ") << QString::fromLatin1("<[[][[i]]{:a[]}]>");
+    QTest::newRow("number") << QByteArray("42") << QString::fromLatin1("<i>");
+    QTest::newRow("string") << QByteArray("\"abc\"\n") << QString::fromLatin1("<s>");
+    QTest::newRow("large") << QByteArray("[9223372036854775807, 9223372036854775808, 1e3, 0.5E-2]") << QString::fromLatin1("<[irrr]>");
+}
+
+void tst_QJsonStreamReader::tokens()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, tokens);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(tokenString(reader), tokens);
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::values()
+{
+    const QByteArray json(testjson);
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartDocument);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.text(), QString::fromLatin1("name"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), QString::fromLatin1("Katie"));
+    QCOMPARE(reader.value(), QVariant(QString::fromLatin1("Katie")));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.depth(), 2);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Integer);
+    QCOMPARE(reader.integerValue(), qint64(1));
+    QCOMPARE(reader.realValue(), 1.0);
+    QCOMPARE(reader.value(), QVariant(qint64(1)));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Real);
+    QCOMPARE(reader.realValue(), -2.5);
+    QCOMPARE(reader.integerValue(), qint64(0));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.boolValue(), true);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.boolValue(), false);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Null);
+    QVERIFY(reader.value().isNull());
+    QVERIFY(reader.text().isEmpty());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 1);
+}
+
+void tst_QJsonStreamReader::strings_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("empty") << QByteArray("\"\"") << QString::fromLatin1("");
+    QTest::newRow("escapes") << QByteArray("\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\"") << QString::fromLatin1("a\"b\\c/d\b\f\n\r\t");
+    QTest::newRow("unicode") << QByteArray("\"\\u0423\\u0442\\u0444\"") << QString::fromUtf8("Утф");
+    QTest::newRow("surrogate") << QByteArray("\"x\\uD834\\uDD1Ey\"") << QString::fromUtf8("x\xF0\x9D\x84\x9Ey");
+    QTest::newRow("utf8") << QByteArray("\"УТФ\"") << QString::fromUtf8("УТФ");
+}
+
+void tst_QJsonStreamReader::strings()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, text);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartDocument);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), text);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::chunked()
+{
+    const QByteArray json("{\"key\": \"\\uD834\\uDD1E value\", \"numbers\": [12345, 6.25e1, true]}");
+
+    QJsonStreamReader reader;
+    QString tokens;
+    QString value;
+    for (int i = 0; i < json.size(); i++) {
+        reader.addData(json.mid(i, 1));
+        while (true) {
+            const QJsonStreamReader::TokenType type = reader.readNext();
+            if (type == QJsonStreamReader::Invalid) {
+                QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+                break;
+            } else if (type == QJsonStreamReader::EndDocument) {
+                tokens += QString::number(type) + QLatin1Char(',');
+                break;
+            } else if (type == QJsonStreamReader::String) {
+                value = reader.text();
+            } else if (type == QJsonStreamReader::Integer) {
+                QCOMPARE(reader.integerValue(), qint64(12345));
+            } else if (type == QJsonStreamReader::Real) {
+                QCOMPARE(reader.realValue(), 62.5);
+            }
+            tokens += QString::number(type) + QLatin1Char(',');
+        }
+    }
+    QCOMPARE(value, QString::fromUtf8("\xF0\x9D\x84\x9E value"));
+
+    // the whole document at once gives the same tokens
+    QJsonStreamReader reader2(json);
+    QString tokens2;
+    while (!reader2.atEnd()) {
+        tokens2 += QString::number(reader2.readNext()) + QLatin1Char(',');
+    }
+    QCOMPARE(tokens, tokens2);
+}
+
+void tst_QJsonStreamReader::device()
+{
+    QByteArray json("[");
+    for (int i = 0; i < 10000; i++) {
+        json += "{\"index\": " + QByteArray::number(i) + ", \"text\": \"some text to make the document larger\"},";
+    }
+    json += "null]";
+
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+
+    qint64 sum = 0;
+    int objects = 0;
+    while (!reader.atEnd()) {
+        reader.readNext();
+        if (reader.tokenType() == QJsonStreamReader::StartObject) {
+            objects++;
+        } else if (reader.tokenType() == QJsonStreamReader::Integer) {
+            sum += reader.integerValue();
+        }
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndDocument);
+    QCOMPARE(objects, 10000);
+    QCOMPARE(sum, qint64(9999) * 10000 / 2);
+}
+
+void tst_QJsonStreamReader::skipCurrentValue()
+{
+    const QByteArray json("{\"skip\": {\"a\": [1, [2]], \"b\": {}}, \"keep\": 3}");
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartDocument);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    reader.skipCurrentValue();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.text(), QString::fromLatin1("keep"));
+    reader.skipCurrentValue();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Integer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStreamReader::error_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("garbage") << QByteArray("{} x");
+    QTest::newRow("two roots") << QByteArray("[] []");
+    QTest::newRow("key") << QByteArray("{1: 2}");
+    QTest::newRow("colon") << QByteArray("{\"a\" 2}");
+    QTest::newRow("separator") << QByteArray("[1 2]");
+    QTest::newRow("mismatch") << QByteArray("[1}");
+    QTest::newRow("trailing comma") << QByteArray("[1,]");
+    QTest::newRow("literal") << QByteArray("[tru]");
+    QTest::newRow("leading zero") << QByteArray("[01]");
+    QTest::newRow("fraction") << QByteArray("[1.]");
+    QTest::newRow("exponent") << QByteArray("[1e+]");
+    QTest::newRow("escape") << QByteArray("[\"\\x\"]");
+    QTest::newRow("lone surrogate") << QByteArray("[\"\\uD834 \"]");
+    QTest::newRow("control") << QByteArray("[\"a\nb\"]");
+    QTest::newRow("depth") << QByteArray(4096, '[');
+}
+
+void tst_QJsonStreamReader::error()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonStreamReader reader(json);
+    tokenString(reader);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    // not testing for specific string on purpose
+    QVERIFY(!reader.errorString().isEmpty());
+    QVERIFY(reader.atEnd());
+
+    // the error is not recoverable
+    reader.addData("]");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+}
+
+void tst_QJsonStreamReader::premature()
+{
+    const QByteArray json("{\"a\": [1");
+    QJsonStreamReader reader(json);
+    QCOMPARE(tokenString(reader), QString::fromLatin1("<{:a[!"));
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+    QVERIFY(reader.atEnd());
+
+    reader.addData("2]}");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Integer);
+    QCOMPARE(reader.integerValue(), qint64(12));
+    QVERIFY(!reader.hasError());
+    QCOMPARE(tokenString(reader), QString::fromLatin1("]}>"));
+
+    reader.clear();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(tokenString(reader), QString::fromLatin1("<!"));
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+}
+
+QTEST_MAIN(tst_QJsonStreamReader)
+
+#include "moc_tst_qjsonstreamreader.cpp"
@@ -25,9 +25,12 @@
 #include <qobject.h>
 #include <qmetaobject.h>
 #include <qlabel.h>
+#include <qtreeview.h>
 #include <qthread.h>
 #include <qdebug.h>
 
+Q_DECLARE_METATYPE(const QMetaObject *)
+
 //TESTED_CLASS=
 //TESTED_FILES=
 
@@ -151,6 +154,8 @@ private slots:
 
     void indexOfMethod_data();
     void indexOfMethod();
+    void indexOfMethodHierarchy_data();
+    void indexOfMethodHierarchy();
 
 signals:
     void value6Changed();
@@ -1060,6 +1065,37 @@ void tst_QMetaObject::indexOfMethod()
     QCOMPARE(object->metaObject()->indexOfSignal(name), !isSignal ? -1 : idx);
 }
 
+void tst_QMetaObject::indexOfMethodHierarchy_data()
+{
+    QTest::addColumn<const QMetaObject *>("metaObject");
+    QTest::newRow("QObject") << &QObject::staticMetaObject;
+    QTest::newRow("QtTestObject") << &QtTestObject::staticMetaObject;
+    QTest::newRow("tst_QMetaObject") << &tst_QMetaObject::staticMetaObject;
+    QTest::newRow("QTreeView") << &QTreeView::staticMetaObject;
+}
+
+void tst_QMetaObject::indexOfMethodHierarchy()
+{
+    QFETCH(const QMetaObject *, metaObject);
+    for (int i = 0; i < metaObject->methodCount(); ++i) {
+        const QMetaMethod method = metaObject->method(i);
+        const char *signature = method.signature();
+        // methods redeclared in a subclass are found there
+        const int idx = metaObject->indexOfMethod(signature);
+        QVERIFY(idx >= i);
+        QCOMPARE(metaObject->method(idx).signature(), signature);
+        if (method.methodType() == QMetaMethod::Signal) {
+            QCOMPARE(metaObject->indexOfSignal(signature), idx);
+            QCOMPARE(metaObject->indexOfSlot(signature), -1);
+        } else if (method.methodType() == QMetaMethod::Slot) {
+            QCOMPARE(metaObject->indexOfSlot(signature), idx);
+            QCOMPARE(metaObject->indexOfSignal(signature), -1);
+        }
+    }
+    QCOMPARE(metaObject->indexOfMethod("noSuchMethod()"), -1);
+    QCOMPARE(metaObject->indexOfMethod("destroyed(QObject)"), -1);
+    QCOMPARE(metaObject->indexOfMethod(""), -1);
+}
 
 QTEST_MAIN(tst_QMetaObject)
 
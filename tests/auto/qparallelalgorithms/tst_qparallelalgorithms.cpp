@@ -0,0 +1,279 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+
+#include <QtTest/QtTest>
+
+#include <qparallelalgorithms.h>
+#include <qthreadpool.h>
+#include <qthread.h>
+#include <qset.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+// enough work per element for the range to be spread over the pool
+static int slowSquare(int value)
+{
+    volatile int spin = 0;
+    for (int i = 0; i < 2000; ++i) {
+        spin += i;
+    }
+    return value * value;
+}
+
+static QVector<int> randomVector(int size)
+{
+    qsrand(size);
+    QVector<int> result(size);
+    for (int i = 0; i < size; ++i) {
+        result[i] = qrand();
+    }
+    return result;
+}
+
+class tst_QParallelAlgorithms : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void parallelFor_data();
+    void parallelFor();
+    void forEach();
+    void spreadsWork();
+    void map();
+    void filter();
+    void reduce();
+    void sort_data();
+    void sort();
+    void sortList();
+    void sortLessThan();
+    void nested();
+
+private:
+    int maxThreadCount;
+};
+
+void tst_QParallelAlgorithms::initTestCase()
+{
+    // exercise the parallel paths even on a single CPU
+    QThreadPool *pool = QThreadPool::globalInstance();
+    maxThreadCount = pool->maxThreadCount();
+    pool->setMaxThreadCount(qMax(maxThreadCount, 4));
+}
+
+void tst_QParallelAlgorithms::cleanupTestCase()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+}
+
+void tst_QParallelAlgorithms::parallelFor_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("empty") << 0;
+    QTest::newRow("one") << 1;
+    QTest::newRow("small") << 100;
+    QTest::newRow("large") << 1000000;
+}
+
+void tst_QParallelAlgorithms::parallelFor()
+{
+    QFETCH(int, count);
+
+    // every index is visited exactly once
+    QVector<int> visits(count, 0);
+    int *data = visits.data();
+    qParallelFor(count, [data](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            data[i]++;
+        }
+    });
+    QCOMPARE(visits, QVector<int>(count, 1));
+}
+
+void tst_QParallelAlgorithms::forEach()
+{
+    QVector<int> vector(100000, 2);
+    qParallelForEach(vector, [](int &value) { value *= 3; });
+    QCOMPARE(vector, QVector<int>(100000, 6));
+
+    QList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.append(i);
+    }
+    qParallelForEach(list, [](int &value) { value = slowSquare(value); });
+    for (int i = 0; i < list.size(); ++i) {
+        QCOMPARE(list.at(i), i * i);
+    }
+}
+
+void tst_QParallelAlgorithms::spreadsWork()
+{
+    QMutex mutex;
+    QSet<QThread *> threads;
+    qParallelFor(200, [&mutex, &threads](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            QThread::msleep(1);
+        }
+        QMutexLocker locker(&mutex);
+        threads.insert(QThread::currentThread());
+    });
+    QVERIFY(threads.size() > 1);
+    QVERIFY(threads.contains(QThread::currentThread()));
+
+    // cheap ranges stay in the calling thread
+    threads.clear();
+    qParallelFor(10, [&mutex, &threads](int, int) {
+        QMutexLocker locker(&mutex);
+        threads.insert(QThread::currentThread());
+    });
+    QCOMPARE(threads.size(), 1);
+    QVERIFY(threads.contains(QThread::currentThread()));
+}
+
+void tst_QParallelAlgorithms::map()
+{
+    QVector<int> vector;
+    for (int i = 0; i < 5000; ++i) {
+        vector.append(i);
+    }
+    const QVector<int> squares = qParallelMap(vector, slowSquare);
+    QCOMPARE(squares.size(), vector.size());
+    for (int i = 0; i < squares.size(); ++i) {
+        QCOMPARE(squares.at(i), i * i);
+    }
+
+    QStringList strings;
+    strings << QLatin1String("a") << QLatin1String("b") << QLatin1String("c");
+    const QStringList upper = qParallelMap(strings, [](const QString &string) { return string.toUpper(); });
+    QCOMPARE(upper, QStringList() << QLatin1String("A") << QLatin1String("B") << QLatin1String("C"));
+}
+
+void tst_QParallelAlgorithms::filter()
+{
+    QVector<int> vector;
+    QVector<int> expected;
+    for (int i = 0; i < 200000; ++i) {
+        vector.append(i);
+        if (i % 3 == 0) {
+            expected.append(i);
+        }
+    }
+    QCOMPARE(qParallelFilter(vector, [](int value) { return (value % 3 == 0); }), expected);
+    QCOMPARE(qParallelFilter(QList<int>(), [](int) { return true; }), QList<int>());
+}
+
+void tst_QParallelAlgorithms::reduce()
+{
+    QVector<qint64> vector;
+    qint64 sum = 0;
+    for (int i = 0; i < 1000000; ++i) {
+        vector.append(i);
+        sum += i;
+    }
+    QCOMPARE(qParallelReduce(vector, qint64(0), [](qint64 left, qint64 right) { return left + right; }), sum);
+
+    // the ranges are combined in order
+    QStringList strings;
+    QString expected;
+    for (int i = 0; i < 20000; ++i) {
+        strings.append(QString::number(i % 10));
+        expected.append(strings.last());
+    }
+    QCOMPARE(qParallelReduce(strings, QString(), [](const QString &left, const QString &right) { return left + right; }), expected);
+}
+
+void tst_QParallelAlgorithms::sort_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("empty") << 0;
+    QTest::newRow("small") << 100;
+    QTest::newRow("threshold") << 2 * QT_PARALLEL_SORT_THRESHOLD;
+    QTest::newRow("uneven") << 3 * QT_PARALLEL_SORT_THRESHOLD + 17;
+    QTest::newRow("large") << 1000000;
+}
+
+void tst_QParallelAlgorithms::sort()
+{
+    QFETCH(int, size);
+
+    QVector<int> vector = randomVector(size);
+    QVector<int> expected = vector;
+    qSort(expected);
+    qParallelSort(vector);
+    QCOMPARE(vector, expected);
+}
+
+void tst_QParallelAlgorithms::sortList()
+{
+    QList<int> list = randomVector(100000).toList();
+    QList<int> expected = list;
+    qSort(expected);
+    qParallelSort(list);
+    QCOMPARE(list, expected);
+}
+
+void tst_QParallelAlgorithms::sortLessThan()
+{
+    QVector<int> vector = randomVector(100000);
+    QVector<int> expected = vector;
+    qSort(expected.begin(), expected.end(), qGreater<int>());
+    qParallelSort(vector.begin(), vector.end(), qGreater<int>());
+    QCOMPARE(vector, expected);
+}
+
+class NestedRunnable : public QRunnable
+{
+public:
+    void run()
+    {
+        QVector<int> vector = randomVector(100000);
+        QVector<int> expected = vector;
+        qSort(expected);
+        qParallelSort(vector);
+        if (vector == expected) {
+            sorted.ref();
+        }
+    }
+
+    static QAtomicInt sorted;
+};
+
+QAtomicInt NestedRunnable::sorted(0);
+
+void tst_QParallelAlgorithms::nested()
+{
+    // algorithms called from the pool threads do not wait on each other
+    QThreadPool *pool = QThreadPool::globalInstance();
+    for (int i = 0; i < 8; ++i) {
+        pool->start(new NestedRunnable());
+    }
+    QVERIFY(pool->waitForDone());
+    QCOMPARE(NestedRunnable::sorted.load(), 8);
+}
+
+QTEST_MAIN(tst_QParallelAlgorithms)
+
+#include "moc_tst_qparallelalgorithms.cpp"
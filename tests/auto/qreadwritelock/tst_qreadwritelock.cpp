@@ -0,0 +1,271 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+
+#include <QtTest/QtTest>
+
+#include <qreadwritelock.h>
+#include <qthread.h>
+#include <qatomic.h>
+
+#include "../../shared/util.h"
+
+//TESTED_CLASS=QReadWriteLock
+//TESTED_FILES=
+
+class LockThread : public QThread
+{
+public:
+    LockThread(QReadWriteLock *lock, bool write, int timeout)
+        : lock(lock), write(write), timeout(timeout), locked(false) { }
+
+    void run() final
+    {
+        locked = (write ? lock->tryLockForWrite(timeout) : lock->tryLockForRead(timeout));
+        if (locked) {
+            lock->unlock();
+        }
+    }
+
+    QReadWriteLock *lock;
+    bool write;
+    int timeout;
+    bool locked;
+};
+
+class tst_QReadWriteLock : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void readLock();
+    void writeLock();
+    void readersShare_data();
+    void readersShare();
+    void tryLockTimeout();
+    void writerPreference();
+    void lockers();
+    void stressTest();
+};
+
+void tst_QReadWriteLock::readLock()
+{
+    QReadWriteLock lock;
+    lock.lockForRead();
+    QVERIFY(lock.tryLockForRead());
+    QVERIFY(!lock.tryLockForWrite());
+    lock.unlock();
+    QVERIFY(!lock.tryLockForWrite());
+    lock.unlock();
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::writeLock()
+{
+    QReadWriteLock lock;
+    lock.lockForWrite();
+    QVERIFY(!lock.tryLockForRead());
+    QVERIFY(!lock.tryLockForWrite());
+    QVERIFY(!lock.tryLockForRead(10));
+    lock.unlock();
+    QVERIFY(lock.tryLockForRead());
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::readersShare_data()
+{
+    QTest::addColumn<bool>("heldForWrite");
+    QTest::addColumn<bool>("write");
+    QTest::addColumn<bool>("locked");
+
+    QTest::newRow("read/read") << false << false << true;
+    QTest::newRow("read/write") << false << true << false;
+    QTest::newRow("write/read") << true << false << false;
+    QTest::newRow("write/write") << true << true << false;
+}
+
+void tst_QReadWriteLock::readersShare()
+{
+    QFETCH(bool, heldForWrite);
+    QFETCH(bool, write);
+    QFETCH(bool, locked);
+
+    QReadWriteLock lock;
+    if (heldForWrite) {
+        lock.lockForWrite();
+    } else {
+        lock.lockForRead();
+    }
+
+    LockThread thread(&lock, write, 0);
+    thread.start();
+    QVERIFY(thread.wait(5000));
+    QCOMPARE(thread.locked, locked);
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::tryLockTimeout()
+{
+    QReadWriteLock lock;
+    lock.lockForWrite();
+
+    QElapsedTimer timer;
+    timer.start();
+    LockThread thread(&lock, false, 200);
+    thread.start();
+    QVERIFY(thread.wait(5000));
+    QVERIFY(!thread.locked);
+    QVERIFY(timer.elapsed() >= 150);
+
+    // released while the other thread is waiting
+    LockThread thread2(&lock, true, 5000);
+    thread2.start();
+    QTest::qWait(100);
+    lock.unlock();
+    QVERIFY(thread2.wait(5000));
+    QVERIFY(thread2.locked);
+
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::writerPreference()
+{
+    QReadWriteLock lock;
+    lock.lockForRead();
+
+    const auto readable = [&lock]() {
+        if (!lock.tryLockForRead()) {
+            return false;
+        }
+        lock.unlock();
+        return true;
+    };
+
+    // a blocked writer keeps new readers out
+    LockThread writer(&lock, true, -1);
+    writer.start();
+    QTRY_VERIFY(!readable());
+    QVERIFY(writer.isRunning());
+
+    lock.unlock();
+    QVERIFY(writer.wait(5000));
+    QVERIFY(writer.locked);
+
+    // a writer giving up lets readers in again
+    lock.lockForRead();
+    LockThread impatient(&lock, true, 100);
+    impatient.start();
+    QVERIFY(impatient.wait(5000));
+    QVERIFY(!impatient.locked);
+    QVERIFY(readable());
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::lockers()
+{
+    QReadWriteLock lock;
+    {
+        QReadLocker locker(&lock);
+        QCOMPARE(locker.readWriteLock(), &lock);
+        QVERIFY(!lock.tryLockForWrite());
+        locker.unlock();
+        QVERIFY(lock.tryLockForWrite());
+        lock.unlock();
+        locker.relock();
+        QVERIFY(!lock.tryLockForWrite());
+    }
+    {
+        QWriteLocker locker(&lock);
+        QCOMPARE(locker.readWriteLock(), &lock);
+        QVERIFY(!lock.tryLockForRead());
+        locker.unlock();
+        QVERIFY(lock.tryLockForRead());
+        lock.unlock();
+        locker.relock();
+        QVERIFY(!lock.tryLockForRead());
+    }
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+
+    QReadLocker nullReadLocker(nullptr);
+    QVERIFY(!nullReadLocker.readWriteLock());
+    QWriteLocker nullWriteLocker(nullptr);
+    QVERIFY(!nullWriteLocker.readWriteLock());
+}
+
+class StressThread : public QThread
+{
+public:
+    StressThread(QReadWriteLock *lock, int *a, int *b, QAtomicInt *errors, bool write)
+        : lock(lock), a(a), b(b), errors(errors), write(write) { }
+
+    void run() final
+    {
+        for (int i = 0; i < 10000; i++) {
+            if (write) {
+                QWriteLocker locker(lock);
+                (*a)++;
+                (*b)++;
+            } else {
+                QReadLocker locker(lock);
+                if (*a != *b) {
+                    errors->ref();
+                }
+            }
+        }
+    }
+
+    QReadWriteLock *lock;
+    int *a;
+    int *b;
+    QAtomicInt *errors;
+    bool write;
+};
+
+void tst_QReadWriteLock::stressTest()
+{
+    QReadWriteLock lock;
+    int a = 0;
+    int b = 0;
+    QAtomicInt errors(0);
+
+    QList<StressThread*> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.append(new StressThread(&lock, &a, &b, &errors, (i % 4) == 0));
+    }
+    foreach (StressThread *thread, threads) {
+        thread->start();
+    }
+    foreach (StressThread *thread, threads) {
+        QVERIFY(thread->wait(60000));
+    }
+    qDeleteAll(threads);
+
+    QCOMPARE(errors.load(), 0);
+    QCOMPARE(a, 20000);
+    QCOMPARE(b, 20000);
+}
+
+QTEST_MAIN(tst_QReadWriteLock)
+
+#include "moc_tst_qreadwritelock.cpp"
@@ -0,0 +1,258 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <qsavefile.h>
+#include <qfile.h>
+#include <qdir.h>
+#include <qtextstream.h>
+
+#include <unistd.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+class tst_QSaveFile : public QObject
+{
+    Q_OBJECT
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void transactionalWrite();
+    void newFile();
+    void cancelWriting();
+    void destroyWithoutCommit();
+    void size();
+    void textStream();
+    void keepPermissions();
+    void writeThroughSymlink();
+    void readOnlyTarget();
+    void openMode();
+
+private:
+    QString dirPath() const;
+    QString targetPath() const;
+    QStringList entries() const;
+};
+
+QString tst_QSaveFile::dirPath() const
+{
+    return QDir::currentPath() + QLatin1String("/qsavefile_testdir");
+}
+
+QString tst_QSaveFile::targetPath() const
+{
+    return dirPath() + QLatin1String("/target");
+}
+
+QStringList tst_QSaveFile::entries() const
+{
+    return QDir(dirPath()).entryList(QDir::Files | QDir::System | QDir::Hidden, QDir::Name);
+}
+
+static QByteArray readFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly))
+        return QByteArray();
+    return file.readAll();
+}
+
+static bool writeFile(const QString &fileName, const QByteArray &data)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly))
+        return false;
+    return (file.write(data) == data.size());
+}
+
+void tst_QSaveFile::init()
+{
+    QVERIFY(QDir().mkpath(dirPath()));
+}
+
+void tst_QSaveFile::cleanup()
+{
+    foreach (const QString &entry, entries())
+        QFile::remove(dirPath() + QLatin1Char('/') + entry);
+    QDir().rmdir(dirPath());
+}
+
+void tst_QSaveFile::transactionalWrite()
+{
+    QVERIFY(writeFile(targetPath(), "old"));
+
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.fileName(), targetPath());
+    QCOMPARE(file.write("new contents"), qint64(12));
+    QVERIFY(file.flush());
+
+    // the file is not touched until commit
+    QCOMPARE(readFile(targetPath()), QByteArray("old"));
+
+    QVERIFY(file.commit());
+    QVERIFY(!file.isOpen());
+    QCOMPARE(file.error(), QFile::NoError);
+    QCOMPARE(readFile(targetPath()), QByteArray("new contents"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+
+    // and can be saved again
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("again"), qint64(5));
+    QVERIFY(file.commit());
+    QCOMPARE(readFile(targetPath()), QByteArray("again"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+}
+
+void tst_QSaveFile::newFile()
+{
+    QVERIFY(!QFile::exists(targetPath()));
+
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("data"), qint64(4));
+    QVERIFY(!QFile::exists(targetPath()));
+    QVERIFY(file.commit());
+    QCOMPARE(readFile(targetPath()), QByteArray("data"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+}
+
+void tst_QSaveFile::cancelWriting()
+{
+    QVERIFY(writeFile(targetPath(), "old"));
+
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("new"), qint64(3));
+    file.cancelWriting();
+    QCOMPARE(file.write("more"), qint64(-1));
+    QVERIFY(!file.commit());
+    QCOMPARE(file.error(), QFile::WriteError);
+    QVERIFY(!file.isOpen());
+
+    QCOMPARE(readFile(targetPath()), QByteArray("old"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+}
+
+void tst_QSaveFile::destroyWithoutCommit()
+{
+    QVERIFY(writeFile(targetPath(), "old"));
+    {
+        QSaveFile file(targetPath());
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write("new"), qint64(3));
+    }
+    QCOMPARE(readFile(targetPath()), QByteArray("old"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+}
+
+void tst_QSaveFile::size()
+{
+    QVERIFY(writeFile(targetPath(), "some old contents"));
+
+    // the size is the one of what is written, not of the file replaced
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.size(), qint64(0));
+    QCOMPARE(file.write("new"), qint64(3));
+    QCOMPARE(file.size(), qint64(3));
+    QCOMPARE(file.pos(), qint64(3));
+    QVERIFY(file.commit());
+}
+
+void tst_QSaveFile::textStream()
+{
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QTextStream stream(&file);
+    stream << "line" << 1 << '\n';
+    stream.flush();
+    QVERIFY(file.commit());
+    QCOMPARE(readFile(targetPath()), QByteArray("line1\n"));
+}
+
+void tst_QSaveFile::keepPermissions()
+{
+    QVERIFY(writeFile(targetPath(), "old"));
+    const QFile::Permissions permissions = QFile::ReadOwner | QFile::WriteOwner | QFile::ReadGroup;
+    QVERIFY(QFile::setPermissions(targetPath(), permissions));
+
+    QSaveFile file(targetPath());
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("new"), qint64(3));
+    QVERIFY(file.commit());
+    QCOMPARE(QFile::permissions(targetPath()) & ~(QFile::ReadUser | QFile::WriteUser), permissions);
+}
+
+void tst_QSaveFile::writeThroughSymlink()
+{
+    const QString linkPath = dirPath() + QLatin1String("/link");
+    QVERIFY(writeFile(targetPath(), "old"));
+    QVERIFY(QFile::link(targetPath(), linkPath));
+
+    QSaveFile file(linkPath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write("new"), qint64(3));
+    QVERIFY(file.commit());
+
+    QVERIFY(QFileInfo(linkPath).isSymLink());
+    QCOMPARE(readFile(targetPath()), QByteArray("new"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("link") << QLatin1String("target"));
+}
+
+void tst_QSaveFile::readOnlyTarget()
+{
+    if (::geteuid() == 0)
+        QSKIP("Running this test as root doesn't make sense", SkipAll);
+
+    QVERIFY(writeFile(targetPath(), "old"));
+    QVERIFY(QFile::setPermissions(targetPath(), QFile::ReadOwner));
+
+    QSaveFile file(targetPath());
+    QVERIFY(!file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.error(), QFile::OpenError);
+    QCOMPARE(readFile(targetPath()), QByteArray("old"));
+    QCOMPARE(entries(), QStringList() << QLatin1String("target"));
+}
+
+void tst_QSaveFile::openMode()
+{
+    QSaveFile file(targetPath());
+    QTest::ignoreMessage(QtWarningMsg, "QSaveFile::open: Open mode not supported");
+    QVERIFY(!file.open(QIODevice::ReadOnly));
+    QTest::ignoreMessage(QtWarningMsg, "QSaveFile::open: Open mode not supported");
+    QVERIFY(!file.open(QIODevice::WriteOnly | QIODevice::Append));
+    QVERIFY(!file.isOpen());
+
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.commit());
+    QVERIFY(QFile::exists(targetPath()));
+
+    const QByteArray warning = "QSaveFile::commit: File (" + targetPath().toLocal8Bit() + ") is not open";
+    QTest::ignoreMessage(QtWarningMsg, warning.constData());
+    QVERIFY(!file.commit());
+}
+
+QTEST_MAIN(tst_QSaveFile)
+
+#include "moc_tst_qsavefile.cpp"
@@ -32,6 +32,7 @@
 #include "qnet_unix_p.h"
 
 #include <sys/select.h>
+#include <sys/resource.h>
 #include <netinet/in.h>
 #include <limits>
 
@@ -47,6 +48,7 @@ private slots:
     void mixingWithTimers();
     void posixSockets();
     void invalidFD();
+    void highFD();
 };
 
 tst_QSocketNotifier::tst_QSocketNotifier()
@@ -288,6 +290,11 @@ void tst_QSocketNotifier::posixSockets()
 
 void tst_QSocketNotifier::invalidFD()
 {
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (qgetenv("QT_NO_EPOLL").isNull())
+        QSKIP("Closed fds are removed from the epoll set by the kernel", SkipSingle);
+#endif
+
     int posixSocket = qt_safe_socket(AF_INET, SOCK_STREAM, 0);
     QSocketNotifier sn(posixSocket, QSocketNotifier::Write);
     QCoreApplication::processEvents();
@@ -300,6 +307,50 @@ void tst_QSocketNotifier::invalidFD()
     QCoreApplication::processEvents();
 }
 
+void tst_QSocketNotifier::highFD()
+{
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (!qgetenv("QT_NO_EPOLL").isNull())
+        QSKIP("select() can not watch fds past FD_SETSIZE", SkipSingle);
+#else
+    QSKIP("select() can not watch fds past FD_SETSIZE", SkipSingle);
+#endif
+
+    struct rlimit limit;
+    QVERIFY(::getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    if (limit.rlim_cur <= FD_SETSIZE + 1) {
+        limit.rlim_cur = qMin(limit.rlim_max, rlim_t(FD_SETSIZE * 2));
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+        QVERIFY(::getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    }
+    if (limit.rlim_cur <= FD_SETSIZE + 1)
+        QSKIP("Can not open enough files", SkipSingle);
+
+    int pipefds[2];
+    QVERIFY(qt_safe_pipe(pipefds, O_NONBLOCK) == 0);
+    const int highfd = FD_SETSIZE + 1;
+    QCOMPARE(qt_safe_dup2(pipefds[0], highfd), highfd);
+
+    {
+        QSocketNotifier rn(highfd, QSocketNotifier::Read);
+        connect(&rn, SIGNAL(activated(int)), &QTestEventLoop::instance(), SLOT(exitLoop()));
+        QSignalSpy readSpy(&rn, SIGNAL(activated(int)));
+
+        QCOMPARE(qt_safe_write(pipefds[1], "hello", 6), qint64(6));
+        QTestEventLoop::instance().enterLoop(3);
+        QCOMPARE(readSpy.count(), 1);
+        QCOMPARE(readSpy.at(0).at(0).toInt(), highfd);
+
+        char buffer[100];
+        QCOMPARE(qt_safe_read(highfd, buffer, 100), qint64(6));
+        QCOMPARE(buffer, "hello");
+    }
+
+    qt_safe_close(highfd);
+    qt_safe_close(pipefds[0]);
+    qt_safe_close(pipefds[1]);
+}
+
 QTEST_MAIN(tst_QSocketNotifier)
 
 #include "moc_tst_qsocketnotifier.cpp"
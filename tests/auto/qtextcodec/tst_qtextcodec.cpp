@@ -39,6 +39,10 @@ private slots:
 
     void hasFailure_data();
     void hasFailure();
+
+    void toUnicodeChunked_data();
+    void toUnicodeChunked();
+    void copyKeepsState();
 };
 
 void tst_QTextCodec::init()
@@ -93,6 +97,60 @@ void tst_QTextCodec::hasFailure()
     }
 }
 
+void tst_QTextCodec::toUnicodeChunked_data()
+{
+    QTest::addColumn<QByteArray>("codecname");
+    QTest::addColumn<QByteArray>("data");
+
+    const QString text = QString::fromUtf8("f\xc3\xb6\xc3\xb6 \xd0\xb1\xd0\xb0\xd1\x80 \xe6\x97\xa5\xe6\x9c\xac \xf0\x9f\x98\x80!");
+    QTest::newRow("UTF-8") << QByteArray("UTF-8") << text.toUtf8();
+    QTest::newRow("UTF-16LE") << QByteArray("UTF-16LE") << QTextCodec::codecForName("UTF-16LE")->fromUnicode(text);
+    QTest::newRow("UTF-32BE") << QByteArray("UTF-32BE") << QTextCodec::codecForName("UTF-32BE")->fromUnicode(text);
+    const QString japanese = QString::fromUtf8("\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e abc \xe3\x81\x8b\xe3\x81\xaa");
+    QTest::newRow("Shift_JIS") << QByteArray("Shift_JIS") << QTextCodec::codecForName("Shift_JIS")->fromUnicode(japanese);
+    QTest::newRow("EUC-JP") << QByteArray("EUC-JP") << QTextCodec::codecForName("EUC-JP")->fromUnicode(japanese);
+}
+
+void tst_QTextCodec::toUnicodeChunked()
+{
+    QFETCH(QByteArray, codecname);
+    QFETCH(QByteArray, data);
+
+    const QString expected = QTextCodec::codecForName(codecname)->toUnicode(data);
+    QVERIFY(!expected.isEmpty());
+    for (int split = 0; split <= data.size(); split++) {
+        QTextConverter converter(codecname);
+        QString result = converter.toUnicode(data.constData(), split);
+        converter.toUnicode(&result, data.constData() + split, data.size() - split);
+        QCOMPARE(result, expected);
+        QVERIFY(!converter.hasFailure());
+    }
+
+    // byte by byte
+    QTextConverter converter(codecname);
+    QString result;
+    for (int i = 0; i < data.size(); i++) {
+        converter.toUnicode(&result, data.constData() + i, 1);
+    }
+    QCOMPARE(result, expected);
+    QVERIFY(!converter.hasFailure());
+}
+
+void tst_QTextCodec::copyKeepsState()
+{
+    const QByteArray data = QString::fromUtf8("\xe6\x97\xa5\xe6\x9c\xac").toUtf8();
+
+    QTextConverter converter("UTF-8");
+    QCOMPARE(converter.toUnicode(data.constData(), 4), QString::fromUtf8("\xe6\x97\xa5"));
+
+    QTextConverter copy(converter);
+    QCOMPARE(copy.toUnicode(data.constData() + 4, 2), QString::fromUtf8("\xe6\x9c\xac"));
+    QCOMPARE(converter.toUnicode(data.constData() + 4, 2), QString::fromUtf8("\xe6\x9c\xac"));
+
+    converter.reset();
+    QCOMPARE(converter.toUnicode(data), QString::fromUtf8("\xe6\x97\xa5\xe6\x9c\xac"));
+}
+
 QTEST_MAIN(tst_QTextCodec)
 
 #include "moc_tst_qtextcodec.cpp"
@@ -0,0 +1,348 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+
+#include <QtTest/QtTest>
+
+#include <qthreadpool.h>
+#include <qthread.h>
+#include <qsemaphore.h>
+#include <qmutex.h>
+#include <qset.h>
+
+#include "../../shared/util.h"
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+class FunctionRunnable : public QRunnable
+{
+public:
+    typedef void (*Function)();
+
+    FunctionRunnable(Function function) : function(function) { }
+    void run() { function(); }
+
+private:
+    Function function;
+};
+
+static QRunnable *createRunnable(FunctionRunnable::Function function)
+{
+    return new FunctionRunnable(function);
+}
+
+static QAtomicInt counter(0);
+static void countFunction()
+{
+    counter.ref();
+}
+
+static QSemaphore blocker;
+static void blockFunction()
+{
+    blocker.acquire();
+}
+
+static QMutex ordermutex;
+static QList<int> order;
+class OrderRunnable : public QRunnable
+{
+public:
+    OrderRunnable(int value) : value(value) { }
+    void run()
+    {
+        QMutexLocker locker(&ordermutex);
+        order.append(value);
+    }
+
+private:
+    int value;
+};
+
+static QAtomicInt deleted(0);
+class DeleteCountRunnable : public QRunnable
+{
+public:
+    ~DeleteCountRunnable() { deleted.ref(); }
+    void run() { }
+};
+
+static QMutex threadsmutex;
+static QSet<QThread *> threads;
+class FanOutRunnable : public QRunnable
+{
+public:
+    FanOutRunnable(int children) : children(children) { }
+    void run()
+    {
+        for (int i = 0; i < children; i++) {
+            QThreadPool::globalInstance()->start(new FanOutRunnable(0));
+        }
+        if (children == 0) {
+            QThread::msleep(5);
+            QMutexLocker locker(&threadsmutex);
+            threads.insert(QThread::currentThread());
+        }
+        counter.ref();
+    }
+
+private:
+    int children;
+};
+
+static QAtomicInt objectsdeleted(0);
+class AffinityObject : public QObject
+{
+public:
+    ~AffinityObject() { objectsdeleted.ref(); }
+};
+
+static QAtomicInt affinityok(0);
+class AffinityRunnable : public QRunnable
+{
+public:
+    void run()
+    {
+        AffinityObject *object = new AffinityObject();
+        if (object->thread() == QThread::currentThread()
+            && object->thread() != qApp->thread()) {
+            affinityok.ref();
+        }
+        object->deleteLater();
+    }
+};
+
+class tst_QThreadPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void runFunction();
+    void runMultiple();
+    void autoDelete();
+    void priority();
+    void tryStart();
+    void expiryTimeout();
+    void reserveThread();
+    void fanOut();
+    void objectAffinity();
+    void waitForDoneTimeout();
+    void clear();
+    void destruction();
+};
+
+void tst_QThreadPool::init()
+{
+    counter.store(0);
+    deleted.store(0);
+    order.clear();
+    threads.clear();
+}
+
+void tst_QThreadPool::runFunction()
+{
+    {
+        QThreadPool manager;
+        manager.start(createRunnable(countFunction));
+    }
+    QCOMPARE(counter.load(), 1);
+}
+
+void tst_QThreadPool::runMultiple()
+{
+    const int runs = 1000;
+    QThreadPool manager;
+    for (int i = 0; i < runs; ++i) {
+        manager.start(createRunnable(countFunction));
+    }
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(counter.load(), runs);
+}
+
+void tst_QThreadPool::autoDelete()
+{
+    QThreadPool manager;
+    for (int i = 0; i < 10; ++i) {
+        manager.start(new DeleteCountRunnable());
+    }
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(deleted.load(), 10);
+
+    DeleteCountRunnable runnable;
+    runnable.setAutoDelete(false);
+    manager.start(&runnable);
+    manager.start(&runnable);
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(deleted.load(), 10);
+}
+
+void tst_QThreadPool::priority()
+{
+    QThreadPool manager;
+    manager.setMaxThreadCount(1);
+
+    // keep the only thread busy while the runnables are queued
+    manager.start(createRunnable(blockFunction));
+    QTRY_COMPARE(manager.activeThreadCount(), 1);
+    manager.start(new OrderRunnable(1), 1);
+    manager.start(new OrderRunnable(3), 3);
+    manager.start(new OrderRunnable(2), 2);
+    manager.start(new OrderRunnable(0));
+    manager.start(new OrderRunnable(-1), 3);
+    blocker.release();
+
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(order, QList<int>() << 3 << -1 << 2 << 1 << 0);
+}
+
+void tst_QThreadPool::tryStart()
+{
+    QThreadPool manager;
+    manager.setMaxThreadCount(1);
+
+    manager.start(createRunnable(blockFunction));
+    QTRY_COMPARE(manager.activeThreadCount(), 1);
+
+    QRunnable *runnable = createRunnable(countFunction);
+    QVERIFY(!manager.tryStart(runnable));
+    blocker.release();
+    QTRY_COMPARE(manager.activeThreadCount(), 0);
+    QVERIFY(manager.tryStart(runnable));
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(counter.load(), 1);
+}
+
+void tst_QThreadPool::expiryTimeout()
+{
+    QThreadPool manager;
+    QCOMPARE(manager.expiryTimeout(), 30000);
+    manager.setExpiryTimeout(10);
+    QCOMPARE(manager.expiryTimeout(), 10);
+
+    // expired threads are started again when needed
+    for (int i = 0; i < 3; ++i) {
+        manager.start(createRunnable(countFunction));
+        QVERIFY(manager.waitForDone());
+        QTest::qWait(50);
+        QCOMPARE(manager.activeThreadCount(), 0);
+    }
+    QCOMPARE(counter.load(), 3);
+}
+
+void tst_QThreadPool::reserveThread()
+{
+    QThreadPool manager;
+    manager.setMaxThreadCount(2);
+    QCOMPARE(manager.activeThreadCount(), 0);
+
+    manager.reserveThread();
+    QCOMPARE(manager.activeThreadCount(), 1);
+    manager.reserveThread();
+    manager.reserveThread();
+    QCOMPARE(manager.activeThreadCount(), 3);
+
+    // there is always one thread even if all are reserved
+    manager.start(createRunnable(countFunction));
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(counter.load(), 1);
+
+    manager.releaseThread();
+    manager.releaseThread();
+    manager.releaseThread();
+    QTRY_COMPARE(manager.activeThreadCount(), 0);
+}
+
+void tst_QThreadPool::fanOut()
+{
+    QThreadPool *manager = QThreadPool::globalInstance();
+    QVERIFY(manager->maxThreadCount() >= 1);
+    const int oldcount = manager->maxThreadCount();
+    manager->setMaxThreadCount(4);
+
+    // the children are pushed onto the deque of the thread running the
+    // parent, the other threads steal them
+    const int children = 32;
+    manager->start(new FanOutRunnable(children));
+    QVERIFY(manager->waitForDone());
+    QCOMPARE(counter.load(), children + 1);
+    QVERIFY(threads.size() > 1);
+    QVERIFY(!threads.contains(QThread::currentThread()));
+
+    manager->setMaxThreadCount(oldcount);
+}
+
+void tst_QThreadPool::objectAffinity()
+{
+    affinityok.store(0);
+    objectsdeleted.store(0);
+
+    QThreadPool manager;
+    for (int i = 0; i < 4; ++i) {
+        manager.start(new AffinityRunnable());
+    }
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(affinityok.load(), 4);
+    // deleteLater() is delivered by the pool thread after the runnable
+    QCOMPARE(objectsdeleted.load(), 4);
+}
+
+void tst_QThreadPool::waitForDoneTimeout()
+{
+    QThreadPool manager;
+    manager.start(createRunnable(blockFunction));
+    QVERIFY(!manager.waitForDone(50));
+    blocker.release();
+    QVERIFY(manager.waitForDone(5000));
+}
+
+void tst_QThreadPool::clear()
+{
+    QThreadPool manager;
+    manager.setMaxThreadCount(1);
+    manager.start(createRunnable(blockFunction));
+    QTRY_COMPARE(manager.activeThreadCount(), 1);
+    for (int i = 0; i < 10; ++i) {
+        manager.start(new DeleteCountRunnable());
+    }
+    manager.clear();
+    QCOMPARE(deleted.load(), 10);
+    blocker.release();
+    QVERIFY(manager.waitForDone());
+    QCOMPARE(deleted.load(), 10);
+}
+
+void tst_QThreadPool::destruction()
+{
+    // the pool waits for its runnables before it is destroyed
+    QThreadPool *manager = new QThreadPool();
+    manager->setMaxThreadCount(2);
+    for (int i = 0; i < 100; ++i) {
+        manager->start(createRunnable(countFunction));
+    }
+    delete manager;
+    QCOMPARE(counter.load(), 100);
+}
+
+QTEST_MAIN(tst_QThreadPool)
+
+#include "moc_tst_qthreadpool.cpp"
@@ -36,6 +36,45 @@ public slots:
 
 private slots:
     void fromdata();
+    void lookup();
+    void threaded();
+};
+
+static QByteArray generateTranslation(int count)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << QByteArray("KATIE_TRANSLATION");
+    stream << QByteArray("UTF-8");
+    for (int i = 0; i < count; i++) {
+        stream << QByteArray("context") + QByteArray::number(i % 7);
+        stream << QByteArray("message ") + QByteArray::number(i);
+        stream << QByteArray("translation ") + QByteArray::number(i);
+        stream << QByteArray("messages ") + QByteArray::number(i);
+        stream << QByteArray("translations ") + QByteArray::number(i);
+    }
+    return data;
+}
+
+class TranslateThread : public QThread
+{
+public:
+    TranslateThread(const QTranslator *translator)
+        : translator(translator), failures(0)
+    { }
+
+    void run()
+    {
+        for (int i = 0; i < 1000; i++) {
+            const QByteArray context = QByteArray("context") + QByteArray::number(i % 7);
+            const QByteArray message = QByteArray("message ") + QByteArray::number(i);
+            if (translator->translate(context.constData(), message.constData()) != QString::fromLatin1("translation %1").arg(i))
+                failures++;
+        }
+    }
+
+    const QTranslator *translator;
+    int failures;
 };
 
 void tst_QTranslator::init()
@@ -55,6 +94,43 @@ void tst_QTranslator::fromdata()
     QVERIFY(translator.loadFromData(trfile.readAll()));
     QCOMPARE(translator.translate("", "foo"), QString::fromUtf8("фоо"));
     QCOMPARE(translator.translate("foo", "bar"), QString::fromUtf8("фообар"));
+    QCOMPARE(translator.translate("bar", "foo"), QString::fromUtf8("foo"));
+    QCOMPARE(translator.translateStrict("bar", "foo"), QString());
+}
+
+void tst_QTranslator::lookup()
+{
+    QTranslator translator;
+    QVERIFY(translator.loadFromData(generateTranslation(10000)));
+    for (int i = 0; i < 10000; i += 97) {
+        const QByteArray context = QByteArray("context") + QByteArray::number(i % 7);
+        const QByteArray message = QByteArray("message ") + QByteArray::number(i);
+        const QByteArray plural = QByteArray("messages ") + QByteArray::number(i);
+        QCOMPARE(translator.translate(context.constData(), message.constData()), QString::fromLatin1("translation %1").arg(i));
+        QCOMPARE(translator.translate(context.constData(), plural.constData()), QString::fromLatin1("translations %1").arg(i));
+        // wrong context
+        QCOMPARE(translator.translateStrict("context", message.constData()), QString());
+    }
+    QCOMPARE(translator.translate("context0", "missing"), QString::fromLatin1("missing"));
+}
+
+void tst_QTranslator::threaded()
+{
+    QTranslator translator;
+    QVERIFY(translator.loadFromData(generateTranslation(1000)));
+
+    QList<TranslateThread*> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.append(new TranslateThread(&translator));
+    }
+    foreach (TranslateThread *thread, threads) {
+        thread->start();
+    }
+    foreach (TranslateThread *thread, threads) {
+        QVERIFY(thread->wait());
+        QCOMPARE(thread->failures, 0);
+    }
+    qDeleteAll(threads);
 }
 
 QTEST_MAIN(tst_QTranslator)
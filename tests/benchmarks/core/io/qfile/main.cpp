@@ -23,6 +23,7 @@
 #include <QTemporaryFile>
 #include <QString>
 #include <QDirIterator>
+#include <QFileInfo>
 #include <qtest.h>
 #include "qplatformdefs.h"
 
@@ -86,6 +87,8 @@ private slots:
     void writeFileBackwards();
     void writeFileSequentialWithSeeks_data();
     void writeFileSequentialWithSeeks();
+    void writeSmallRecords_data();
+    void writeSmallRecords();
 
 private:
     void readBigFile_data(BenchmarkType type, QIODevice::OpenModeFlag t, QIODevice::OpenModeFlag b);
@@ -538,6 +541,63 @@ void tst_qfile::writeFileSequentialWithSeeks()
     }
 }
 
+void tst_qfile::writeSmallRecords_data()
+{
+    QTest::addColumn<tst_qfile::BenchmarkType>("testType");
+    QTest::addColumn<int>("recordSize");
+
+    const int recordSizes[] = { 4, 16, 64, 256 };
+    for (int i = 0; i < 4; ++i) {
+        const QByteArray size = QByteArray::number(recordSizes[i]);
+        QTest::newRow(QByteArray("QFile " + size + "b").constData())
+            << QFileBenchmark << recordSizes[i];
+        QTest::newRow(QByteArray("Posix FILE* " + size + "b").constData())
+            << PosixBenchmark << recordSizes[i];
+    }
+}
+
+void tst_qfile::writeSmallRecords()
+{
+    const int limit = 1024 * 1024;
+    QFETCH(tst_qfile::BenchmarkType, testType);
+    QFETCH(int, recordSize);
+
+    createFile();
+    QByteArray record;
+    record.fill('@', recordSize);
+
+    switch (testType) {
+        case(QFileBenchmark): {
+            QFile file(filename);
+            QBENCHMARK {
+                QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+                for (int pos = 0; pos < limit; pos += recordSize) {
+                    file.write(record.constData(), recordSize);
+                }
+                file.close();
+            }
+            QCOMPARE(QFileInfo(filename).size(), qint64(limit));
+            break;
+        }
+        case(PosixBenchmark): {
+            QBENCHMARK {
+                FILE *cfile = QT_FOPEN(QFile::encodeName(filename).constData(), "wb");
+                QVERIFY(cfile);
+                for (int pos = 0; pos < limit; pos += recordSize) {
+                    ::fwrite(record.constData(), recordSize, 1, cfile);
+                }
+                ::fclose(cfile);
+            }
+            break;
+        }
+        case(QFileFromPosixBenchmark): {
+            break;
+        }
+    }
+
+    removeFile();
+}
+
 QTEST_MAIN(tst_qfile)
 
 #include "moc_main.cpp"
@@ -45,6 +45,8 @@ private slots:
     void equality_data();
     void equality();
     void qmlPropertyWriteUseCase();
+    void topLevelDomain_data();
+    void topLevelDomain();
 
 private:
     void generateFirstRunData();
@@ -221,6 +223,30 @@ void tst_qurl::qmlPropertyWriteUseCase()
     }
 }
 
+void tst_qurl::topLevelDomain_data()
+{
+    QTest::addColumn<QUrl>("url");
+    QTest::addColumn<QString>("tld");
+
+    QTest::newRow("com") << QUrl(QLatin1String("http://www.example.com")) << QString::fromLatin1(".com");
+    QTest::newRow("co.uk") << QUrl(QLatin1String("http://www.bbc.co.uk")) << QString::fromLatin1(".co.uk");
+    QTest::newRow("deep") << QUrl(QLatin1String("http://a.b.c.d.e.f.example.co.uk")) << QString::fromLatin1(".co.uk");
+    QTest::newRow("wildcard") << QUrl(QLatin1String("http://foo.bar.kawasaki.jp")) << QString::fromLatin1(".bar.kawasaki.jp");
+    QTest::newRow("exception") << QUrl(QLatin1String("http://www.city.kawasaki.jp")) << QString::fromLatin1(".jp");
+    QTest::newRow("unknown") << QUrl(QLatin1String("http://www.example.invalidtld")) << QString();
+}
+
+void tst_qurl::topLevelDomain()
+{
+    QFETCH(QUrl, url);
+    QFETCH(QString, tld);
+
+    QCOMPARE(url.topLevelDomain(), tld);
+    QBENCHMARK {
+        (void)url.topLevelDomain();
+    }
+}
+
 QTEST_MAIN(tst_qurl)
 
 #include "moc_main.cpp"
@@ -78,6 +78,52 @@ int EventTester::foo(int bar)
     return bar + 1;
 }
 
+class EventCounter : public QObject
+{
+public:
+    EventCounter() : m_expected(0), m_counter(0) {}
+    void reset(int expected) { m_expected = expected; m_counter = 0; }
+    int counter() const { return m_counter; }
+
+protected:
+    bool event(QEvent *e);
+
+private:
+    int m_expected;
+    int m_counter;
+};
+
+bool EventCounter::event(QEvent *e)
+{
+    if (e->type() == QEvent::User) {
+        if (++m_counter == m_expected)
+            QTestEventLoop::instance().exitLoop();
+        return true;
+    }
+    return QObject::event(e);
+}
+
+class EventProducer : public QThread
+{
+public:
+    EventProducer(QObject *receiver, int count, int priority)
+        : m_receiver(receiver), m_count(count), m_priority(priority) {}
+
+protected:
+    void run();
+
+private:
+    QObject *m_receiver;
+    int m_count;
+    int m_priority;
+};
+
+void EventProducer::run()
+{
+    for (int i = 0; i < m_count; ++i)
+        QCoreApplication::postEvent(m_receiver, new QEvent(QEvent::User), m_priority);
+}
+
 class EventsBench : public QObject
 {
     Q_OBJECT
@@ -91,6 +137,8 @@ private slots:
     void sendEvent();
     void postEvent_data();
     void postEvent();
+    void postEventManyProducers_data();
+    void postEventManyProducers();
 };
 
 void EventsBench::initTestCase()
@@ -164,6 +212,47 @@ void EventsBench::postEvent()
     }
 }
 
+void EventsBench::postEventManyProducers_data()
+{
+    QTest::addColumn<int>("producers");
+    QTest::addColumn<int>("priority");
+
+    // events of normal priority are queued without locking, the others are
+    // sorted into the posted events list
+    static const int producerCounts[] = { 1, 2, 4, 8 };
+    for (int i = 0; i < 4; ++i) {
+        const int producers = producerCounts[i];
+        QTest::newRow(qPrintable(QString::fromLatin1("%1 producers, normal priority").arg(producers)))
+            << producers << int(Qt::NormalEventPriority);
+        QTest::newRow(qPrintable(QString::fromLatin1("%1 producers, high priority").arg(producers)))
+            << producers << int(Qt::HighEventPriority);
+    }
+}
+
+void EventsBench::postEventManyProducers()
+{
+    QFETCH(int, producers);
+    QFETCH(int, priority);
+
+    const int eventsPerProducer = 10000;
+    EventCounter counter;
+
+    QBENCHMARK {
+        counter.reset(producers * eventsPerProducer);
+        QList<EventProducer*> threads;
+        for (int i = 0; i < producers; ++i) {
+            threads.append(new EventProducer(&counter, eventsPerProducer, priority));
+            threads.last()->start();
+        }
+        QTestEventLoop::instance().enterLoop(60);
+        foreach (EventProducer *thread, threads)
+            thread->wait();
+        qDeleteAll(threads);
+        QVERIFY(!QTestEventLoop::instance().timeout());
+    }
+    QCOMPARE(counter.counter(), producers * eventsPerProducer);
+}
+
 QTEST_MAIN(EventsBench)
 
 #include "moc_main.cpp"
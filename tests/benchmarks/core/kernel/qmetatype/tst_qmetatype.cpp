@@ -43,6 +43,8 @@ private slots:
     void typeCustomNotNormalized();
     void typeNotRegistered();
     void typeNotRegisteredNotNormalized();
+    void typeManyCustom_data();
+    void typeManyCustom();
 
     void typeNameBuiltin_data();
     void typeNameBuiltin();
@@ -146,6 +148,33 @@ void tst_QMetaType::typeNotRegisteredNotNormalized()
     }
 }
 
+// looks up names in a registry that holds 1000 custom types
+void tst_QMetaType::typeManyCustom_data()
+{
+    QTest::addColumn<QByteArray>("typeName");
+
+    for (int i = 0; i < 1000; ++i) {
+        const QByteArray name = "Custom" + QByteArray::number(i);
+        if (!QMetaType::type(name.constData()))
+            qRegisterMetaType<Foo>(name.constData());
+    }
+
+    QTest::newRow("first") << QByteArray("Custom0");
+    QTest::newRow("middle") << QByteArray("Custom500");
+    QTest::newRow("last") << QByteArray("Custom999");
+    QTest::newRow("not registered") << QByteArray("Custom1000");
+}
+
+void tst_QMetaType::typeManyCustom()
+{
+    QFETCH(QByteArray, typeName);
+    const char *nm = typeName.constData();
+    QBENCHMARK {
+        for (int i = 0; i < 10000; ++i)
+            QMetaType::type(nm);
+    }
+}
+
 void tst_QMetaType::typeNameBuiltin_data()
 {
     QTest::addColumn<int>("type");
@@ -38,6 +38,8 @@ Q_OBJECT
 private slots:
     void signal_slot_benchmark();
     void signal_slot_benchmark_data();
+    void signal_slot_threads_benchmark_data();
+    void signal_slot_threads_benchmark();
     void qproperty_benchmark_data();
     void qproperty_benchmark();
     void dynamic_property_benchmark();
@@ -104,6 +106,66 @@ void QObjectBenchmark::signal_slot_benchmark()
     }
 }
 
+// emits the same signal of a shared sender, the receivers are connected
+// directly so the slots are invoked in the emitting thread
+class EmitterThread : public QThread
+{
+    Object *sender;
+    int iterations;
+public:
+    EmitterThread(Object *sender, int iterations)
+        : sender(sender), iterations(iterations)
+    { }
+    void run() {
+        for (int i = 0; i < iterations; ++i)
+            sender->emitSignal0();
+    }
+};
+
+void QObjectBenchmark::signal_slot_threads_benchmark_data()
+{
+    QTest::addColumn<int>("receivers");
+    QTest::addColumn<int>("threads");
+
+    static const int receiverCounts[] = { 1, 10, 100 };
+    static const int threadCounts[] = { 1, 2, 4 };
+    for (int r = 0; r < 3; ++r) {
+        for (int t = 0; t < 3; ++t) {
+            QTest::newRow(qPrintable(QString::fromLatin1("%1 receivers, %2 threads")
+                .arg(receiverCounts[r]).arg(threadCounts[t])))
+                << receiverCounts[r] << threadCounts[t];
+        }
+    }
+}
+
+void QObjectBenchmark::signal_slot_threads_benchmark()
+{
+    QFETCH(int, receivers);
+    QFETCH(int, threads);
+
+    Object sender;
+    QVector<Object *> receiverObjects(receivers);
+    for (int i = 0; i < receivers; ++i) {
+        receiverObjects[i] = new Object;
+        QObject::connect(&sender, SIGNAL(signal0()), receiverObjects[i], SLOT(slot0()), Qt::DirectConnection);
+    }
+
+    // keep the number of slot invocations per thread the same for every row
+    const int iterations = 100000 / receivers;
+    QBENCHMARK {
+        QVector<EmitterThread *> emitters(threads);
+        for (int i = 0; i < emitters.count(); ++i) {
+            emitters[i] = new EmitterThread(&sender, iterations);
+            emitters[i]->start();
+        }
+        for (int i = 0; i < emitters.count(); ++i)
+            emitters[i]->wait();
+        qDeleteAll(emitters);
+    }
+
+    qDeleteAll(receiverObjects);
+}
+
 void QObjectBenchmark::qproperty_benchmark_data()
 {
     QTest::addColumn<QByteArray>("name");
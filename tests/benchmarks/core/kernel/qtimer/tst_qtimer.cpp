@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore>
+#include <QtTest/QtTest>
+
+#define TIMER_COUNT 100000
+
+QT_USE_NAMESPACE
+
+class tst_qtimer : public QObject
+{
+    Q_OBJECT
+private slots:
+    void startStop();
+    void restart();
+    void deleteObjects();
+    void activate();
+};
+
+class TimerCounter : public QObject
+{
+    Q_OBJECT
+public:
+    TimerCounter() : count(0), expected(0) { }
+
+    int count;
+    int expected;
+
+protected:
+    void timerEvent(QTimerEvent *event)
+    {
+        killTimer(event->timerId());
+        count++;
+        if (count == expected)
+            QTestEventLoop::instance().exitLoop();
+    }
+};
+
+// starting and stopping idle timeouts, e.g. one per connection
+void tst_qtimer::startStop()
+{
+    QObject object;
+    QVector<int> ids(TIMER_COUNT);
+    QBENCHMARK {
+        for (int i = 0; i < TIMER_COUNT; ++i)
+            ids[i] = object.startTimer(60000 + i);
+        for (int i = 0; i < TIMER_COUNT; ++i)
+            object.killTimer(ids.at(i));
+    }
+}
+
+// restarting timeouts on activity
+void tst_qtimer::restart()
+{
+    QVector<QTimer*> timers(TIMER_COUNT);
+    for (int i = 0; i < TIMER_COUNT; ++i) {
+        timers[i] = new QTimer();
+        timers[i]->start(60000 + (i % 1000));
+    }
+    QBENCHMARK {
+        for (int i = 0; i < TIMER_COUNT; ++i)
+            timers.at(i)->start();
+    }
+    qDeleteAll(timers);
+}
+
+// objects with running timers going away
+void tst_qtimer::deleteObjects()
+{
+    QBENCHMARK {
+        QVector<QObject*> objects(TIMER_COUNT);
+        for (int i = 0; i < TIMER_COUNT; ++i) {
+            objects[i] = new QObject();
+            objects.at(i)->startTimer(60000 + i);
+        }
+        qDeleteAll(objects);
+    }
+}
+
+// timers expiring in a burst
+void tst_qtimer::activate()
+{
+    QBENCHMARK {
+        TimerCounter counter;
+        counter.expected = TIMER_COUNT;
+        for (int i = 0; i < TIMER_COUNT; ++i)
+            counter.startTimer(i % 10);
+        QTestEventLoop::instance().enterLoop(30);
+        QVERIFY(!QTestEventLoop::instance().timeout());
+        QCOMPARE(counter.count, TIMER_COUNT);
+    }
+}
+
+QTEST_MAIN(tst_qtimer)
+
+#include "moc_tst_qtimer.cpp"
@@ -81,6 +81,11 @@ private slots:
     void contendedNative();
     void contendedQMutex();
     void contendedQMutexLocker();
+
+    void contendedShortSection_data();
+    void contendedShortSection();
+    void readMostly_data();
+    void readMostly();
 };
 
 QSemaphore tst_QMutex::semaphore1;
@@ -396,6 +401,174 @@ void tst_QMutex::contendedQMutexLocker()
     qDeleteAll(threads);
 }
 
+enum LockType {
+    NativeLock,
+    QMutexLock,
+    QReadWriteLockLock
+};
+
+// many threads hammering on a lock that is held only for an increment, the
+// case where spinning pays off and sleeping in the kernel does not
+class ShortSectionThread : public QThread
+{
+    LockType type;
+    NativeMutexType *nativeMutex;
+    QMutex *mutex;
+    QReadWriteLock *readWriteLock;
+    volatile int *counter;
+public:
+    static const int iterations = 20000;
+
+    ShortSectionThread(LockType type, NativeMutexType *nativeMutex, QMutex *mutex,
+                       QReadWriteLock *readWriteLock, volatile int *counter)
+        : type(type), nativeMutex(nativeMutex), mutex(mutex), readWriteLock(readWriteLock), counter(counter)
+    { }
+    void run() {
+        for (int i = 0; i < iterations; ++i) {
+            switch (type) {
+                case NativeLock:
+                    NativeMutexLock(nativeMutex);
+                    (*counter)++;
+                    NativeMutexUnlock(nativeMutex);
+                    break;
+                case QMutexLock:
+                    mutex->lock();
+                    (*counter)++;
+                    mutex->unlock();
+                    break;
+                case QReadWriteLockLock:
+                    readWriteLock->lockForWrite();
+                    (*counter)++;
+                    readWriteLock->unlock();
+                    break;
+            }
+        }
+    }
+};
+
+void tst_QMutex::contendedShortSection_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("threads");
+
+    static const int threadCounts[] = { 1, 2, 4, 8 };
+    for (int i = 0; i < 4; ++i) {
+        const int threads = threadCounts[i];
+        QTest::newRow(qPrintable(QString::fromLatin1("native, %1 threads").arg(threads)))
+            << int(NativeLock) << threads;
+        QTest::newRow(qPrintable(QString::fromLatin1("QMutex, %1 threads").arg(threads)))
+            << int(QMutexLock) << threads;
+        QTest::newRow(qPrintable(QString::fromLatin1("QReadWriteLock, %1 threads").arg(threads)))
+            << int(QReadWriteLockLock) << threads;
+    }
+}
+
+void tst_QMutex::contendedShortSection()
+{
+    QFETCH(int, type);
+    QFETCH(int, threads);
+
+    NativeMutexType nativeMutex;
+    NativeMutexInitialize(&nativeMutex);
+    QMutex mutex;
+    QReadWriteLock readWriteLock;
+    volatile int counter = 0;
+
+    QBENCHMARK {
+        counter = 0;
+        QVector<ShortSectionThread *> workers(threads);
+        for (int i = 0; i < workers.count(); ++i) {
+            workers[i] = new ShortSectionThread(LockType(type), &nativeMutex, &mutex, &readWriteLock, &counter);
+            workers[i]->start();
+        }
+        for (int i = 0; i < workers.count(); ++i)
+            workers[i]->wait();
+        qDeleteAll(workers);
+    }
+    QCOMPARE(int(counter), threads * ShortSectionThread::iterations);
+
+    NativeMutexDestroy(&nativeMutex);
+}
+
+// lookups in a shared hash with an occasional insert, readers only exclude
+// each other when the hash is protected by a QMutex
+class ReadMostlyThread : public QThread
+{
+    bool useReadWriteLock;
+    QMutex *mutex;
+    QReadWriteLock *readWriteLock;
+    QHash<int, int> *hash;
+public:
+    static const int iterations = 20000;
+    int found;
+
+    ReadMostlyThread(bool useReadWriteLock, QMutex *mutex, QReadWriteLock *readWriteLock, QHash<int, int> *hash)
+        : useReadWriteLock(useReadWriteLock), mutex(mutex), readWriteLock(readWriteLock), hash(hash), found(0)
+    { }
+    void run() {
+        for (int i = 0; i < iterations; ++i) {
+            const int key = i % 1000;
+            if (i % 100 == 0) {
+                if (useReadWriteLock) {
+                    QWriteLocker locker(readWriteLock);
+                    hash->insert(key, i);
+                } else {
+                    QMutexLocker locker(mutex);
+                    hash->insert(key, i);
+                }
+            } else {
+                if (useReadWriteLock) {
+                    QReadLocker locker(readWriteLock);
+                    found += hash->contains(key);
+                } else {
+                    QMutexLocker locker(mutex);
+                    found += hash->contains(key);
+                }
+            }
+        }
+    }
+};
+
+void tst_QMutex::readMostly_data()
+{
+    QTest::addColumn<bool>("useReadWriteLock");
+    QTest::addColumn<int>("threads");
+
+    static const int threadCounts[] = { 1, 2, 4, 8 };
+    for (int i = 0; i < 4; ++i) {
+        const int threads = threadCounts[i];
+        QTest::newRow(qPrintable(QString::fromLatin1("QMutex, %1 threads").arg(threads)))
+            << false << threads;
+        QTest::newRow(qPrintable(QString::fromLatin1("QReadWriteLock, %1 threads").arg(threads)))
+            << true << threads;
+    }
+}
+
+void tst_QMutex::readMostly()
+{
+    QFETCH(bool, useReadWriteLock);
+    QFETCH(int, threads);
+
+    QMutex mutex;
+    QReadWriteLock readWriteLock;
+    QHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+
+    QBENCHMARK {
+        QVector<ReadMostlyThread *> workers(threads);
+        for (int i = 0; i < workers.count(); ++i) {
+            workers[i] = new ReadMostlyThread(useReadWriteLock, &mutex, &readWriteLock, &hash);
+            workers[i]->start();
+        }
+        for (int i = 0; i < workers.count(); ++i) {
+            workers[i]->wait();
+            QCOMPARE(workers[i]->found, ReadMostlyThread::iterations - ReadMostlyThread::iterations / 100);
+        }
+        qDeleteAll(workers);
+    }
+}
+
 QTEST_MAIN(tst_QMutex)
 
 #include "moc_tst_qmutex.cpp"
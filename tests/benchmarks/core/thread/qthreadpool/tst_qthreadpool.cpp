@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+static QAtomicInt counter(0);
+
+// a small amount of work so that the pool overhead dominates
+class SumRunnable : public QRunnable
+{
+public:
+    void run()
+    {
+        volatile int sum = 0;
+        for (int i = 0; i < 100; i++) {
+            sum += i;
+        }
+        counter.ref();
+    }
+};
+
+class FanOutRunnable : public QRunnable
+{
+public:
+    FanOutRunnable(QThreadPool *pool, int children) : pool(pool), children(children) { }
+    void run()
+    {
+        for (int i = 0; i < children; i++) {
+            pool->start(new SumRunnable());
+        }
+    }
+
+private:
+    QThreadPool *pool;
+    int children;
+};
+
+class SumThread : public QThread
+{
+public:
+    void run()
+    {
+        SumRunnable runnable;
+        runnable.run();
+    }
+};
+
+class tst_QThreadPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void fanOutFanIn_data();
+    void fanOutFanIn();
+    void nestedFanOut_data();
+    void nestedFanOut();
+    void threadPerTask_data();
+    void threadPerTask();
+};
+
+void tst_QThreadPool::fanOutFanIn_data()
+{
+    QTest::addColumn<int>("tasks");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("10000") << 10000;
+    QTest::newRow("100000") << 100000;
+}
+
+// runnables started from the main thread go through the shared queue
+void tst_QThreadPool::fanOutFanIn()
+{
+    QFETCH(int, tasks);
+
+    QThreadPool pool;
+    QBENCHMARK {
+        counter.store(0);
+        for (int i = 0; i < tasks; i++) {
+            pool.start(new SumRunnable());
+        }
+        pool.waitForDone();
+    }
+    QCOMPARE(counter.load(), tasks);
+}
+
+void tst_QThreadPool::nestedFanOut_data()
+{
+    fanOutFanIn_data();
+}
+
+// runnables started from a pool thread go to its own deque and are stolen
+// by the other threads
+void tst_QThreadPool::nestedFanOut()
+{
+    QFETCH(int, tasks);
+
+    QThreadPool pool;
+    QBENCHMARK {
+        counter.store(0);
+        pool.start(new FanOutRunnable(&pool, tasks));
+        pool.waitForDone();
+    }
+    QCOMPARE(counter.load(), tasks);
+}
+
+void tst_QThreadPool::threadPerTask_data()
+{
+    QTest::addColumn<int>("tasks");
+
+    QTest::newRow("100") << 100;
+}
+
+void tst_QThreadPool::threadPerTask()
+{
+    QFETCH(int, tasks);
+
+    QBENCHMARK {
+        counter.store(0);
+        QList<SumThread *> threads;
+        for (int i = 0; i < tasks; i++) {
+            SumThread *thread = new SumThread();
+            thread->start();
+            threads.append(thread);
+        }
+        foreach (SumThread *thread, threads) {
+            thread->wait();
+            delete thread;
+        }
+    }
+    QCOMPARE(counter.load(), tasks);
+}
+
+QTEST_MAIN(tst_QThreadPool)
+
+#include "moc_tst_qthreadpool.cpp"
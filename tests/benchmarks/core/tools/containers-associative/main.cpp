@@ -21,6 +21,8 @@
 #include <QString>
 
 #include <qtest.h>
+#include <qvector.h>
+#include <qflathash_p.h>
 
 QT_USE_NAMESPACE
 
@@ -32,6 +34,16 @@ private slots:
     void insert();
     void lookup_data();
     void lookup();
+    void insertLarge_data();
+    void insertLarge();
+    void lookupLarge_data();
+    void lookupLarge();
+};
+
+enum Container {
+    Hash,
+    Map,
+    FlatHash
 };
 
 template <typename T> 
@@ -47,30 +59,34 @@ void testInsert(int size)
 
 void tst_associative_containers::insert_data()
 {
-    QTest::addColumn<bool>("useHash");
+    QTest::addColumn<int>("container");
     QTest::addColumn<int>("size");
 
     for (int size = 10; size < 20000; size += 100) {
     
         const QByteArray sizeString = QByteArray::number(size);
 
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
+        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << int(Hash) << size;
+        QTest::newRow(QByteArray("map--" + sizeString).constData()) << int(Map) << size;
+        QTest::newRow(QByteArray("flathash--" + sizeString).constData()) << int(FlatHash) << size;
     }
 }
 
 void tst_associative_containers::insert()
 {
-    QFETCH(bool, useHash);
+    QFETCH(int, container);
     QFETCH(int, size);
 
-    QHash<int, int> testHash;
-    QMap<int, int> testMap;
-
-    if (useHash) {
-        testInsert<QHash<int, int> >(size);        
-    } else {
-        testInsert<QMap<int, int> >(size);        
+    switch (container) {
+        case Hash:
+            testInsert<QHash<int, int> >(size);
+            break;
+        case Map:
+            testInsert<QMap<int, int> >(size);
+            break;
+        case FlatHash:
+            testInsert<QFlatHash<int, int> >(size);
+            break;
     }
 }
 
@@ -79,15 +95,16 @@ void tst_associative_containers::lookup_data()
 //    setReportType(LineChartReport);
 //    setChartTitle("Time to call value(), with an increasing number of items in the container");
 
-    QTest::addColumn<bool>("useHash");
+    QTest::addColumn<int>("container");
     QTest::addColumn<int>("size");
 
     for (int size = 10; size < 20000; size += 100) {
     
         const QByteArray sizeString = QByteArray::number(size);
 
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
+        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << int(Hash) << size;
+        QTest::newRow(QByteArray("map--" + sizeString).constData()) << int(Map) << size;
+        QTest::newRow(QByteArray("flathash--" + sizeString).constData()) << int(FlatHash) << size;
     }
 }
 
@@ -99,24 +116,120 @@ void testLookup(int size)
     for (int i = 0; i < size; ++i)
         container.insert(i, i);
 
-    int val;
+    uint val = 0;
 
     QBENCHMARK {
         for (int i = 0; i < size; ++i)
-            val = container.value(i);
+            val += container.value(i);
     }
-    Q_UNUSED(val);
+    // keep the lookups from being optimized away
+    QVERIFY(val != 1);
 }
 
 void tst_associative_containers::lookup()
 {
-    QFETCH(bool, useHash);
+    QFETCH(int, container);
+    QFETCH(int, size);
+
+    switch (container) {
+        case Hash:
+            testLookup<QHash<int, int> >(size);
+            break;
+        case Map:
+            testLookup<QMap<int, int> >(size);
+            break;
+        case FlatHash:
+            testLookup<QFlatHash<int, int> >(size);
+            break;
+    }
+}
+
+// sparse 64-bit keys in random order, too many to stay in cache
+static QVector<quint64> largeKeys(int size)
+{
+    QVector<quint64> keys(size);
+    qsrand(size);
+    for (int i = 0; i < size; ++i)
+        keys[i] = (quint64(qrand()) << 32 | quint64(i)) << 4;
+    return keys;
+}
+
+template <typename T>
+void testInsertLarge(int size)
+{
+    const QVector<quint64> keys = largeKeys(size);
+
+    QBENCHMARK {
+        T container;
+        for (int i = 0; i < size; ++i)
+            container.insert(keys.at(i), i);
+    }
+}
+
+void tst_associative_containers::insertLarge_data()
+{
+    lookupLarge_data();
+}
+
+void tst_associative_containers::insertLarge()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+
+    switch (container) {
+        case Hash:
+            testInsertLarge<QHash<quint64, int> >(size);
+            break;
+        case FlatHash:
+            testInsertLarge<QFlatHash<quint64, int> >(size);
+            break;
+    }
+}
+
+void tst_associative_containers::lookupLarge_data()
+{
+    QTest::addColumn<int>("container");
+    QTest::addColumn<int>("size");
+
+    for (int size = 100000; size <= 1000000; size *= 10) {
+        const QByteArray sizeString = QByteArray::number(size);
+
+        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << int(Hash) << size;
+        QTest::newRow(QByteArray("flathash--" + sizeString).constData()) << int(FlatHash) << size;
+    }
+}
+
+template <typename T>
+void testLookupLarge(int size)
+{
+    QVector<quint64> keys = largeKeys(size);
+    T container;
+    for (int i = 0; i < size; ++i)
+        container.insert(keys.at(i), i);
+    for (int i = size - 1; i > 0; --i)
+        qSwap(keys[i], keys[qrand() % (i + 1)]);
+
+    uint val = 0;
+    QBENCHMARK {
+        for (int i = 0; i < size; ++i)
+            val += container.value(keys.at(i));
+    }
+    // keep the lookups from being optimized away
+    QVERIFY(val != 1);
+}
+
+void tst_associative_containers::lookupLarge()
+{
+    QFETCH(int, container);
     QFETCH(int, size);
 
-    if (useHash) {
-        testLookup<QHash<int, int> >(size);
-    } else {
-        testLookup<QMap<int, int> >(size);
+    switch (container) {
+        case Hash:
+            testLookupLarge<QHash<quint64, int> >(size);
+            break;
+        case FlatHash:
+            testLookupLarge<QFlatHash<quint64, int> >(size);
+            break;
     }
 }
 
@@ -0,0 +1,196 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// This file contains benchmarks for comparing the parallel algorithms against
+// their sequential counterparts
+
+#include <QtCore>
+#include <QVector>
+#include <qtest.h>
+#include <qparallelalgorithms.h>
+
+QT_USE_NAMESPACE
+
+static int cheap(int value)
+{
+    return value + 1;
+}
+
+static int expensive(int value)
+{
+    qreal result = value;
+    for (int i = 0; i < 200; ++i) {
+        result = qSqrt(result + i);
+    }
+    return int(result);
+}
+
+static QVector<int> randomVector(int size)
+{
+    qsrand(size);
+    QVector<int> result(size);
+    for (int i = 0; i < size; ++i) {
+        result[i] = qrand();
+    }
+    return result;
+}
+
+class tst_ContainersParallel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void map_data();
+    void map();
+    void filter_data();
+    void filter();
+    void reduce_data();
+    void reduce();
+    void sort_data();
+    void sort();
+};
+
+void tst_ContainersParallel::map_data()
+{
+    QTest::addColumn<bool>("parallel");
+    QTest::addColumn<bool>("heavy");
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("sequential cheap 100") << false << false << 100;
+    QTest::newRow("parallel cheap 100") << true << false << 100;
+    QTest::newRow("sequential cheap 1000000") << false << false << 1000000;
+    QTest::newRow("parallel cheap 1000000") << true << false << 1000000;
+    QTest::newRow("sequential expensive 100") << false << true << 100;
+    QTest::newRow("parallel expensive 100") << true << true << 100;
+    QTest::newRow("sequential expensive 100000") << false << true << 100000;
+    QTest::newRow("parallel expensive 100000") << true << true << 100000;
+}
+
+void tst_ContainersParallel::map()
+{
+    QFETCH(bool, parallel);
+    QFETCH(bool, heavy);
+    QFETCH(int, size);
+
+    const QVector<int> vector = randomVector(size);
+    int (*function)(int) = (heavy ? expensive : cheap);
+    QVector<int> result;
+    if (parallel) {
+        QBENCHMARK {
+            result = qParallelMap(vector, function);
+        }
+    } else {
+        QBENCHMARK {
+            result = vector;
+            for (int i = 0; i < size; ++i)
+                result[i] = function(vector.at(i));
+        }
+    }
+    QCOMPARE(result.size(), size);
+}
+
+void tst_ContainersParallel::filter_data()
+{
+    QTest::addColumn<bool>("parallel");
+
+    QTest::newRow("sequential") << false;
+    QTest::newRow("parallel") << true;
+}
+
+void tst_ContainersParallel::filter()
+{
+    QFETCH(bool, parallel);
+
+    const QVector<int> vector = randomVector(100000);
+    QVector<int> result;
+    if (parallel) {
+        QBENCHMARK {
+            result = qParallelFilter(vector, [](int value) { return (expensive(value) % 2 == 0); });
+        }
+    } else {
+        QBENCHMARK {
+            result.clear();
+            for (int i = 0; i < vector.size(); ++i) {
+                if (expensive(vector.at(i)) % 2 == 0)
+                    result.append(vector.at(i));
+            }
+        }
+    }
+    QVERIFY(!result.isEmpty());
+}
+
+void tst_ContainersParallel::reduce_data()
+{
+    filter_data();
+}
+
+void tst_ContainersParallel::reduce()
+{
+    QFETCH(bool, parallel);
+
+    QVector<qint64> vector;
+    for (int i = 0; i < 10000000; ++i)
+        vector.append(i);
+    qint64 result = 0;
+    if (parallel) {
+        QBENCHMARK {
+            result = qParallelReduce(vector, qint64(0), [](qint64 left, qint64 right) { return left + right; });
+        }
+    } else {
+        QBENCHMARK {
+            result = 0;
+            for (int i = 0; i < vector.size(); ++i)
+                result += vector.at(i);
+        }
+    }
+    QVERIFY(result > 0);
+}
+
+void tst_ContainersParallel::sort_data()
+{
+    QTest::addColumn<bool>("parallel");
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("qSort 10000") << false << 10000;
+    QTest::newRow("qParallelSort 10000") << true << 10000;
+    QTest::newRow("qSort 1000000") << false << 1000000;
+    QTest::newRow("qParallelSort 1000000") << true << 1000000;
+}
+
+void tst_ContainersParallel::sort()
+{
+    QFETCH(bool, parallel);
+    QFETCH(int, size);
+
+    const QVector<int> vector = randomVector(size);
+    QVector<int> result;
+    QBENCHMARK {
+        result = vector;
+        if (parallel)
+            qParallelSort(result);
+        else
+            qSort(result);
+    }
+    QCOMPARE(result.size(), size);
+}
+
+QTEST_MAIN(tst_ContainersParallel)
+
+#include "moc_main.cpp"
@@ -63,6 +63,8 @@ private slots:
     void qhash_faster();
     void qhash_simple();
     void qhash_simple_reserve();
+    void qhash_keys_data();
+    void qhash_keys();
 
 private:
     QString data();
@@ -128,6 +130,49 @@ void tst_QHash::qhash_simple_reserve()
     }
 }
 
+void tst_QHash::qhash_keys_data()
+{
+    QTest::addColumn<bool>("byteArray");
+    QTest::addColumn<int>("length");
+
+    static const int lengths[] = { 4, 16, 64, 256, 4096 };
+    for (int i = 0; i < 5; ++i) {
+        QTest::newRow(qPrintable(QString::fromLatin1("QString, %1 chars").arg(lengths[i])))
+            << false << lengths[i];
+        QTest::newRow(qPrintable(QString::fromLatin1("QByteArray, %1 chars").arg(lengths[i])))
+            << true << lengths[i];
+    }
+}
+
+// hashes 1000 distinct keys of the given length
+void tst_QHash::qhash_keys()
+{
+    QFETCH(bool, byteArray);
+    QFETCH(int, length);
+
+    QList<QByteArray> byteArrays;
+    QList<QString> strings;
+    for (int i = 0; i < 1000; ++i) {
+        QByteArray key = QByteArray::number(i).rightJustified(length, 'x', true);
+        byteArrays.append(key);
+        strings.append(QString::fromLatin1(key));
+    }
+
+    uint result = 0;
+    if (byteArray) {
+        QBENCHMARK {
+            for (int i = 0; i < byteArrays.size(); ++i)
+                result += qHash(byteArrays.at(i));
+        }
+    } else {
+        QBENCHMARK {
+            for (int i = 0; i < strings.size(); ++i)
+                result += qHash(strings.at(i));
+        }
+    }
+    Q_UNUSED(result);
+}
+
 QTEST_MAIN(tst_QHash)
 
 #include "moc_qhash_string.cpp"
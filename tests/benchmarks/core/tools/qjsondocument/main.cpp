@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QJsonDocument>
+#include <QJsonStreamReader>
+#include <QBuffer>
+
+QT_USE_NAMESPACE
+
+// objects nested depth levels deep, each level with a few scalars and an array
+static QByteArray nestedJson(const int depth)
+{
+    QByteArray result;
+    for (int i = 0; i < depth; i++) {
+        result += "{\"name\": \"level\", \"index\": " + QByteArray::number(i) + ", \"list\": [1, 2.5, true, null], \"child\": ";
+    }
+    result += "null";
+    for (int i = 0; i < depth; i++) {
+        result += "}";
+    }
+    return result;
+}
+
+// flat array of count small objects
+static QByteArray largeJson(const int count)
+{
+    QByteArray result("[");
+    for (int i = 0; i < count; i++) {
+        if (i != 0) {
+            result += ",";
+        }
+        result += "{\"id\": " + QByteArray::number(i) + ", \"text\": \"lorem ipsum dolor sit amet\", \"values\": [1, 2, 3]}";
+    }
+    result += "]";
+    return result;
+}
+
+class tst_qjsondocument : public QObject
+{
+    Q_OBJECT
+private slots:
+    void fromJson_data();
+    void fromJson();
+    void streamReader_data();
+    void streamReader();
+    void streamReaderDevice();
+};
+
+void tst_qjsondocument::fromJson_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("nested 10") << nestedJson(10);
+    QTest::newRow("nested 100") << nestedJson(100);
+    QTest::newRow("nested 1000") << nestedJson(1000);
+    QTest::newRow("large 1000") << largeJson(1000);
+    QTest::newRow("large 50000") << largeJson(50000);
+}
+
+void tst_qjsondocument::fromJson()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        const QJsonDocument jsondoc = QJsonDocument::fromJson(json);
+        QVERIFY(!jsondoc.isNull());
+    }
+}
+
+void tst_qjsondocument::streamReader_data()
+{
+    fromJson_data();
+}
+
+void tst_qjsondocument::streamReader()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        QJsonStreamReader reader(json);
+        while (!reader.atEnd()) {
+            reader.readNext();
+        }
+        QVERIFY(!reader.hasError());
+    }
+}
+
+void tst_qjsondocument::streamReaderDevice()
+{
+    QByteArray json = largeJson(50000);
+
+    QBENCHMARK {
+        QBuffer buffer(&json);
+        buffer.open(QIODevice::ReadOnly);
+        QJsonStreamReader reader(&buffer);
+        while (!reader.atEnd()) {
+            reader.readNext();
+        }
+        QVERIFY(!reader.hasError());
+    }
+}
+
+QTEST_MAIN(tst_qjsondocument)
+
+#include "moc_main.cpp"
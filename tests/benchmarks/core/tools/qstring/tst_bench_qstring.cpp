@@ -32,7 +32,14 @@ public:
 private slots:
     void equals() const;
     void equals_data() const;
+    void fromUtf8_data() const;
     void fromUtf8() const;
+    void toUtf8_data() const;
+    void toUtf8() const;
+    void fromAscii_data() const;
+    void fromAscii() const;
+    void toAscii_data() const;
+    void toAscii() const;
     void fromLatin1_data() const;
     void fromLatin1() const;
     void toLower() const;
@@ -113,19 +120,131 @@ void tst_QString::equals_data() const
             << QString::fromRawData(ptr + 1, 58) << QString::fromRawData(ptr + 3, 58);
 }
 
-void tst_QString::fromUtf8() const
+static QByteArray utf8Data()
 {
     QFile file(QLatin1String(SRCDIR "utf-8.txt"));
     if (!file.open(QFile::ReadOnly)) {
         qFatal("Cannot open input file");
-        return;
+        return QByteArray();
     }
-    QByteArray data = file.readAll();
+    return file.readAll();
+}
+
+static QByteArray asciiData()
+{
+    QByteArray data;
+    while (data.size() < 1500) {
+        data += "Language: English, Langage : Francais, Sprak: Norsk\n";
+    }
+    return data;
+}
+
+// the "icu" rows go through QTextCodec which still uses the ICU converters, the "native" rows
+// use the built-in QString conversions
+static void addConversionRows()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<bool>("icu");
+
+    const QByteArray utf8 = utf8Data();
+    const QByteArray ascii = asciiData();
+    QTest::newRow("mixed-native") << utf8 << false;
+    QTest::newRow("mixed-icu") << utf8 << true;
+    QTest::newRow("ascii-native") << ascii << false;
+    QTest::newRow("ascii-icu") << ascii << true;
+}
+
+void tst_QString::fromUtf8_data() const
+{
+    addConversionRows();
+}
+
+void tst_QString::fromUtf8() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
     const char *d = data.constData();
     int size = data.size();
+    if (icu) {
+        QTextCodec *codec = QTextCodec::codecForName("UTF-8");
+        QBENCHMARK {
+            (void)codec->toUnicode(d, size);
+        }
+    } else {
+        QBENCHMARK {
+            (void)QString::fromUtf8(d, size);
+        }
+    }
+}
 
-    QBENCHMARK {
-        QString::fromUtf8(d, size);
+void tst_QString::toUtf8_data() const
+{
+    addConversionRows();
+}
+
+void tst_QString::toUtf8() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    const QString s = QString::fromUtf8(data);
+    if (icu) {
+        QTextCodec *codec = QTextCodec::codecForName("UTF-8");
+        QBENCHMARK {
+            (void)codec->fromUnicode(s);
+        }
+    } else {
+        QBENCHMARK {
+            (void)s.toUtf8();
+        }
+    }
+}
+
+void tst_QString::fromAscii_data() const
+{
+    addConversionRows();
+}
+
+void tst_QString::fromAscii() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    const char *d = data.constData();
+    int size = data.size();
+    if (icu) {
+        QTextCodec *codec = QTextCodec::codecForName("US-ASCII");
+        QBENCHMARK {
+            (void)codec->toUnicode(d, size);
+        }
+    } else {
+        QBENCHMARK {
+            (void)QString::fromAscii(d, size);
+        }
+    }
+}
+
+void tst_QString::toAscii_data() const
+{
+    addConversionRows();
+}
+
+void tst_QString::toAscii() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    const QString s = QString::fromUtf8(data);
+    if (icu) {
+        QTextCodec *codec = QTextCodec::codecForName("US-ASCII");
+        QBENCHMARK {
+            (void)codec->fromUnicode(s);
+        }
+    } else {
+        QBENCHMARK {
+            (void)s.toAscii();
+        }
     }
 }
 
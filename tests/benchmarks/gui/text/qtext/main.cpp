@@ -61,6 +61,8 @@ private slots:
     void formattedLayout();
     void paintLayoutToPixmap();
     void paintLayoutToPixmap_painterFill();
+    void paintLayoutToImage_data();
+    void paintLayoutToImage();
 
     void document();
     void paintDocToPixmap();
@@ -302,6 +304,31 @@ void tst_QText::paintLayoutToPixmap_painterFill()
     }
 }
 
+void tst_QText::paintLayoutToImage_data()
+{
+    QTest::addColumn<qreal>("scale");
+
+    // untransformed text is drawn from cached glyph masks, scaled text from outlines
+    QTest::newRow("untransformed") << qreal(1.0);
+    QTest::newRow("scaled") << qreal(1.5);
+}
+
+void tst_QText::paintLayoutToImage()
+{
+    QFETCH(qreal, scale);
+
+    QTextLayout layout(m_shortLorem);
+    QSize size = setupTextLayout(&layout);
+    QImage img(size * scale, QImage::Format_ARGB32_Premultiplied);
+
+    QBENCHMARK {
+        img.fill(Qt::transparent);
+        QPainter p(&img);
+        p.scale(scale, scale);
+        layout.draw(&p, QPointF(0, 0));
+    }
+}
+
 void tst_QText::document()
 {
     QBENCHMARK {